@@ -7,5 +7,6 @@ library dartcv.calib3d;
 export 'src/calib3d/calib3d.dart';
 export 'src/calib3d/calib3d_async.dart';
 export 'src/calib3d/fisheye.dart';
+export 'src/calib3d/remap_cache.dart';
 export 'src/calib3d/stereo.dart';
 export 'src/calib3d/usac_params.dart';
@@ -5,22 +5,30 @@
 library dartcv.core;
 
 export 'src/core/base.dart';
+export 'src/core/batched_linalg.dart';
 export 'src/core/contours.dart';
 export 'src/core/core.dart';
 export 'src/core/core_async.dart';
 export 'src/core/cv_vec.dart';
+export 'src/core/dft_plan.dart';
 export 'src/core/dmatch.dart';
+export 'src/core/elem_expr.dart';
 export 'src/core/error_code.dart';
 export 'src/core/exception.dart';
 export 'src/core/float16.dart';
+export 'src/core/image_stats.dart';
+export 'src/core/incremental_pca.dart';
 export 'src/core/keypoint.dart';
 export 'src/core/mat.dart';
 export 'src/core/mat_async.dart';
+export 'src/core/mat_io.dart';
 export 'src/core/mat_type.dart';
+export 'src/core/minibatch_kmeans.dart';
 export 'src/core/moments.dart';
 export 'src/core/point.dart';
 export 'src/core/rect.dart';
 export 'src/core/rng.dart';
+export 'src/core/rng_stream.dart';
 export 'src/core/scalar.dart';
 export 'src/core/size.dart';
 export 'src/core/svd.dart';
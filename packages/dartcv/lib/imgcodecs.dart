@@ -4,4 +4,7 @@
 
 library dartcv.imgcodecs;
 
+export 'src/imgcodecs/batch_codec.dart';
+export 'src/imgcodecs/image_encoder.dart';
+export 'src/imgcodecs/image_probe.dart';
 export 'src/imgcodecs/imgcodecs.dart';
@@ -5,8 +5,14 @@
 library dartcv.imgproc;
 
 export 'src/imgproc/clahe.dart';
+export 'src/imgproc/component_labeler.dart';
+export 'src/imgproc/image_pyramid.dart';
 export 'src/imgproc/imgproc.dart';
 export 'src/imgproc/imgproc_async.dart';
+export 'src/imgproc/integral_image.dart';
 export 'src/imgproc/subdiv2d.dart';
 export 'src/imgproc/subdiv2d_async.dart';
+export 'src/imgproc/template_matcher.dart';
 export 'src/imgproc/linesegmentdetector.dart';
+export 'src/imgproc/sliding_histogram.dart';
+export 'src/imgproc/video_clahe.dart';
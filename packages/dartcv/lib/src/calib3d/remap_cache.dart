@@ -0,0 +1,182 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.calib3d;
+
+import 'dart:ffi' as ffi;
+
+import 'package:ffi/ffi.dart';
+
+import '../core/base.dart';
+import '../core/mat.dart';
+import '../core/scalar.dart';
+import '../core/size.dart';
+import '../g/calib3d.g.dart' as cvg;
+import '../g/constants.g.dart';
+
+/// Cached remap tables for a fixed geometric transform.
+///
+/// Fixed cameras usually call `initUndistortRectifyMap` + `remap` or `warpPerspective`
+/// with the same parameters for every frame, [RemapCache] builds fixed-point
+/// (`CV_16SC2` + `CV_16UC1`) maps once and only rebuilds them when the key
+/// (matrices and output size) changes, so [apply] is a single remap with the fast
+/// fixed-point path.
+class RemapCache extends CvStruct<cvg.RemapCache> {
+  RemapCache._(cvg.RemapCachePtr ptr, [bool attach = true]) : super.fromPointer(ptr) {
+    if (attach) {
+      finalizer.attach(this, ptr.cast(), detach: this);
+    }
+  }
+
+  factory RemapCache.fromPointer(cvg.RemapCachePtr ptr, [bool attach = true]) => RemapCache._(ptr, attach);
+
+  /// Creates an empty [RemapCache].
+  ///
+  /// [interpolation], [borderMode] and [borderValue] are used by every [apply] call,
+  /// see `remap` for details.
+  factory RemapCache({
+    int interpolation = INTER_LINEAR,
+    int borderMode = BORDER_CONSTANT,
+    Scalar? borderValue,
+  }) {
+    final p = calloc<cvg.RemapCache>();
+    borderValue ??= Scalar();
+    cvRun(() => cvg.cv_RemapCache_create(interpolation, borderMode, borderValue!.ref, p));
+    return RemapCache._(p);
+  }
+
+  static final finalizer = OcvFinalizer<cvg.RemapCachePtr>(cvg.addresses.cv_RemapCache_close);
+
+  void dispose() {
+    finalizer.detach(this);
+    cvg.cv_RemapCache_close(ptr);
+  }
+
+  @override
+  cvg.RemapCache get ref => ptr.ref;
+
+  /// Builds the undistortion and rectification maps, see `cv.initUndistortRectifyMap`.
+  ///
+  /// Returns true if the maps were rebuilt, false if the cached maps are reused.
+  bool initUndistortRectifyMap(
+    InputArray cameraMatrix,
+    InputArray distCoeffs,
+    (int, int) size, {
+    InputArray? R,
+    InputArray? newCameraMatrix,
+  }) {
+    R ??= Mat.empty();
+    newCameraMatrix ??= Mat.empty();
+    final prval = calloc<ffi.Bool>();
+    cvRun(
+      () => cvg.cv_RemapCache_initUndistortRectifyMap(
+        ref,
+        cameraMatrix.ref,
+        distCoeffs.ref,
+        R!.ref,
+        newCameraMatrix!.ref,
+        size.cvd.ref,
+        prval,
+        ffi.nullptr,
+      ),
+    );
+    final rval = prval.value;
+    calloc.free(prval);
+    return rval;
+  }
+
+  /// async version of [initUndistortRectifyMap]
+  Future<bool> initUndistortRectifyMapAsync(
+    InputArray cameraMatrix,
+    InputArray distCoeffs,
+    (int, int) size, {
+    InputArray? R,
+    InputArray? newCameraMatrix,
+  }) async {
+    R ??= Mat.empty();
+    newCameraMatrix ??= Mat.empty();
+    final prval = calloc<ffi.Bool>();
+    return cvRunAsync0(
+      (callback) => cvg.cv_RemapCache_initUndistortRectifyMap(
+        ref,
+        cameraMatrix.ref,
+        distCoeffs.ref,
+        R!.ref,
+        newCameraMatrix!.ref,
+        size.cvd.ref,
+        prval,
+        callback,
+      ),
+      (c) {
+        final rval = prval.value;
+        calloc.free(prval);
+        return c.complete(rval);
+      },
+    );
+  }
+
+  /// Builds the maps of `warpAffine` with the 2x3 matrix [M] and output size [dsize].
+  ///
+  /// If [inverseMap] is true, [M] is treated as the inverse transformation (dst->src),
+  /// i.e., the same as [WARP_INVERSE_MAP] flag of `warpAffine`.
+  ///
+  /// Returns true if the maps were rebuilt, false if the cached maps are reused.
+  bool initWarpAffine(InputArray M, (int, int) dsize, {bool inverseMap = false}) {
+    final prval = calloc<ffi.Bool>();
+    cvRun(() => cvg.cv_RemapCache_initWarpAffine(ref, M.ref, dsize.cvd.ref, inverseMap, prval, ffi.nullptr));
+    final rval = prval.value;
+    calloc.free(prval);
+    return rval;
+  }
+
+  /// Builds the maps of `warpPerspective` with the 3x3 matrix [M] and output size [dsize].
+  ///
+  /// If [inverseMap] is true, [M] is treated as the inverse transformation (dst->src),
+  /// i.e., the same as [WARP_INVERSE_MAP] flag of `warpPerspective`.
+  ///
+  /// Returns true if the maps were rebuilt, false if the cached maps are reused.
+  bool initWarpPerspective(InputArray M, (int, int) dsize, {bool inverseMap = false}) {
+    final prval = calloc<ffi.Bool>();
+    cvRun(
+      () => cvg.cv_RemapCache_initWarpPerspective(ref, M.ref, dsize.cvd.ref, inverseMap, prval, ffi.nullptr),
+    );
+    final rval = prval.value;
+    calloc.free(prval);
+    return rval;
+  }
+
+  /// Remaps [src] with the cached maps.
+  Mat apply(InputArray src, {OutputArray? dst}) {
+    dst ??= Mat.empty();
+    cvRun(() => cvg.cv_RemapCache_apply(ref, src.ref, dst!.ref, ffi.nullptr));
+    return dst;
+  }
+
+  /// async version of [apply]
+  Future<Mat> applyAsync(InputArray src, {OutputArray? dst}) async {
+    dst ??= Mat.empty();
+    return cvRunAsync0((callback) => cvg.cv_RemapCache_apply(ref, src.ref, dst!.ref, callback), (c) {
+      return c.complete(dst);
+    });
+  }
+
+  /// The cached maps, `map1` is `CV_16SC2` and `map2` is `CV_16UC1`
+  /// (empty for [INTER_NEAREST] warps), the data is shared with the cache.
+  (Mat map1, Mat map2) get maps {
+    final map1 = Mat.empty();
+    final map2 = Mat.empty();
+    cvRun(() => cvg.cv_RemapCache_getMaps(ref, map1.ref, map2.ref));
+    return (map1, map2);
+  }
+
+  bool get isEmpty => cvg.cv_RemapCache_empty(ref);
+
+  /// Releases the cached maps and key.
+  void release() => cvg.cv_RemapCache_release(ref);
+
+  @override
+  String toString() {
+    return "RemapCache(address=0x${ptr.address.toRadixString(16)})";
+  }
+}
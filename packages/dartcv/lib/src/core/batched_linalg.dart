@@ -0,0 +1,148 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+// ignore_for_file: non_constant_identifier_names
+
+/// Linear algebra over batches of small matrices, in one call.
+///
+/// A batch is a continuous, single channel [MatType.CV_32F] or [MatType.CV_64F] [Mat] of
+/// 3 dims (n, rows, cols), e.g., n 3x3 matrices are packed with
+/// `Mat.fromList(n, 9, MatType.CV_64FC1, data).reshapeTo(1, [n, 3, 3])`. A 2-D [Mat] is a
+/// batch of one, and a batch of one is broadcast against the other operands. Items are
+/// processed in parallel, square 2x2, 3x3 and 4x4 items with the default flags by fixed-size
+/// kernels.
+library cv.core.batched_linalg;
+
+import 'dart:ffi' as ffi;
+
+import '../g/constants.g.dart';
+import '../g/core.g.dart' as ccore;
+import 'base.dart';
+import 'mat.dart';
+import 'mat_type.dart';
+
+/// [dst] i = [alpha] * op([src1] i) * op([src2] i) + [beta] * op([src3] i), see `gemm`,
+/// [src3] may be empty.
+Mat gemmBatched(
+  InputArray src1,
+  InputArray src2,
+  double alpha,
+  InputArray src3,
+  double beta, {
+  OutputArray? dst,
+  int flags = 0,
+}) {
+  dst ??= Mat.empty();
+  cvRun(
+    () => ccore.cv_gemmBatched(src1.ref, src2.ref, alpha, src3.ref, beta, dst!.ref, flags, ffi.nullptr),
+  );
+  return dst;
+}
+
+/// async version of [gemmBatched]
+Future<Mat> gemmBatchedAsync(
+  InputArray src1,
+  InputArray src2,
+  double alpha,
+  InputArray src3,
+  double beta, {
+  OutputArray? dst,
+  int flags = 0,
+}) async {
+  dst ??= Mat.empty();
+  return cvRunAsync0(
+    (callback) => ccore.cv_gemmBatched(src1.ref, src2.ref, alpha, src3.ref, beta, dst!.ref, flags, callback),
+    (c) => c.complete(dst),
+  );
+}
+
+/// Inverts every matrix of [src], see `invert`.
+///
+/// [status] is (n x 1) [MatType.CV_64F] with the value `invert` returns for every item,
+/// 0 for singular items, whose inverse is set to zeros.
+(Mat status, Mat dst) invertBatched(InputArray src, {OutputArray? dst, int flags = DECOMP_LU}) {
+  dst ??= Mat.empty();
+  final status = Mat.empty();
+  cvRun(() => ccore.cv_invertBatched(src.ref, dst!.ref, status.ref, flags, ffi.nullptr));
+  return (status, dst);
+}
+
+/// async version of [invertBatched]
+Future<(Mat status, Mat dst)> invertBatchedAsync(
+  InputArray src, {
+  OutputArray? dst,
+  int flags = DECOMP_LU,
+}) async {
+  dst ??= Mat.empty();
+  final status = Mat.empty();
+  return cvRunAsync0(
+    (callback) => ccore.cv_invertBatched(src.ref, dst!.ref, status.ref, flags, callback),
+    (c) => c.complete((status, dst!)),
+  );
+}
+
+/// Solves [src1] i * [dst] i = [src2] i for every item, see `solve`.
+///
+/// [status] is (n x 1) [MatType.CV_8U], 0 for singular items, whose solution is set to zeros.
+(Mat status, Mat dst) solveBatched(
+  InputArray src1,
+  InputArray src2, {
+  OutputArray? dst,
+  int flags = DECOMP_LU,
+}) {
+  dst ??= Mat.empty();
+  final status = Mat.empty();
+  cvRun(() => ccore.cv_solveBatched(src1.ref, src2.ref, dst!.ref, status.ref, flags, ffi.nullptr));
+  return (status, dst);
+}
+
+/// async version of [solveBatched]
+Future<(Mat status, Mat dst)> solveBatchedAsync(
+  InputArray src1,
+  InputArray src2, {
+  OutputArray? dst,
+  int flags = DECOMP_LU,
+}) async {
+  dst ??= Mat.empty();
+  final status = Mat.empty();
+  return cvRunAsync0(
+    (callback) => ccore.cv_solveBatched(src1.ref, src2.ref, dst!.ref, status.ref, flags, callback),
+    (c) => c.complete((status, dst!)),
+  );
+}
+
+/// Singular value decomposition of every matrix of [src], see `SVDecomp`.
+///
+/// [w] is (n, k, 1) with k = min(rows, cols), [u] and [vt] are empty with the
+/// `SVD::NO_UV` flag (2).
+(Mat w, Mat u, Mat vt) SVDecompBatched(
+  InputArray src, {
+  OutputArray? w,
+  OutputArray? u,
+  OutputArray? vt,
+  int flags = 0,
+}) {
+  w ??= Mat.empty();
+  u ??= Mat.empty();
+  vt ??= Mat.empty();
+  cvRun(() => ccore.cv_SVDecompBatched(src.ref, w!.ref, u!.ref, vt!.ref, flags, ffi.nullptr));
+  return (w, u, vt);
+}
+
+/// async version of [SVDecompBatched]
+Future<(Mat w, Mat u, Mat vt)> SVDecompBatchedAsync(
+  InputArray src, {
+  OutputArray? w,
+  OutputArray? u,
+  OutputArray? vt,
+  int flags = 0,
+}) async {
+  w ??= Mat.empty();
+  u ??= Mat.empty();
+  vt ??= Mat.empty();
+  return cvRunAsync0(
+    (callback) => ccore.cv_SVDecompBatched(src.ref, w!.ref, u!.ref, vt!.ref, flags, callback),
+    (c) => c.complete((w!, u!, vt!)),
+  );
+}
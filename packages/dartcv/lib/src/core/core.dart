@@ -18,6 +18,7 @@ import 'mat.dart';
 import 'mat_type.dart';
 import 'point.dart';
 import 'rng.dart';
+import 'rng_stream.dart';
 import 'scalar.dart';
 import 'termcriteria.dart';
 import 'vec.dart';
@@ -1066,10 +1067,15 @@ Mat randn(InputOutputArray dst, Scalar mean, Scalar stddev) {
 
 /// RandShuffle Shuffles the array elements randomly.
 ///
+/// With [stream] the permutation is drawn from the [RngStream] in parallel and is
+/// reproducible, [iterFactor] and [rng] are ignored.
+///
 /// For further details, please see:
 /// https://docs.opencv.org/master/d2/de8/group__core__array.html#ga6a789c8a5cb56c6dd62506179808f763
-Mat randShuffle(InputOutputArray dst, {double iterFactor = 1, Rng? rng}) {
-  if (rng == null) {
+Mat randShuffle(InputOutputArray dst, {double iterFactor = 1, Rng? rng, RngStream? stream}) {
+  if (stream != null) {
+    cvRun(() => ccore.cv_RNGStream_shuffle(stream.ref, dst.ref, ffi.nullptr));
+  } else if (rng == null) {
     cvRun(() => ccore.cv_randShuffle(dst.ref, ffi.nullptr));
   } else {
     cvRun(() => ccore.cv_randShuffle_1(dst.ref, iterFactor, rng.ref, ffi.nullptr));
@@ -1195,7 +1201,7 @@ Mat setIdentity(InputOutputArray mtx, {Scalar? s}) {
   return (rval, roots);
 }
 
-/// Sort sorts each row or each column of a matrix.
+/// Sort sorts each row or each column of a matrix, the rows or columns are sorted in parallel.
 ///
 /// For further details, please see:
 /// https://docs.opencv.org/master/d2/de8/group__core__array.html#ga45dd56da289494ce874be2324856898f
@@ -1207,6 +1213,7 @@ Mat sort(InputArray src, int flags, {OutputArray? dst}) {
 
 /// SortIdx sorts each row or each column of a matrix.
 /// Instead of reordering the elements themselves, it stores the indices of sorted elements in the output array
+/// Equal elements keep their order.
 ///
 /// For further details, please see:
 /// https://docs.opencv.org/master/d2/de8/group__core__array.html#gadf35157cbf97f3cb85a545380e383506
@@ -1285,6 +1292,25 @@ Mat SVBackSubst(InputArray w, InputArray u, InputArray vh, InputArray rhs, {Outp
   return (w, u, vt);
 }
 
+/// TopK selects the [k] largest ([SORT_DESCENDING]) or smallest ([SORT_ASCENDING]) elements of each
+/// row ([SORT_EVERY_ROW]) or column ([SORT_EVERY_COLUMN]) of a single channel matrix, sorted, without
+/// sorting the whole rows or columns.
+///
+/// [values] has the type of [src] and [indices] is [MatType.CV_32S], both rows x [k] or [k] x cols.
+/// Equal elements go to the lower index.
+(Mat values, Mat indices) topK(
+  InputArray src,
+  int k, {
+  int flags = SORT_EVERY_ROW | SORT_DESCENDING,
+  OutputArray? values,
+  OutputArray? indices,
+}) {
+  values ??= Mat.empty();
+  indices ??= Mat.empty();
+  cvRun(() => ccore.cv_topK(src.ref, k, values!.ref, indices!.ref, flags, ffi.nullptr));
+  return (values, indices);
+}
+
 /// Trace returns the trace of a matrix.
 ///
 /// For further details, please see:
@@ -18,6 +18,7 @@ import 'mat.dart';
 import 'mat_type.dart';
 import 'point.dart';
 import 'rng.dart';
+import 'rng_stream.dart';
 import 'scalar.dart';
 import 'termcriteria.dart';
 import 'vec.dart';
@@ -1189,7 +1190,7 @@ Future<Mat> setIdentityAsync(InputOutputArray mtx, {Scalar? s}) async {
   });
 }
 
-/// Sort sorts each row or each column of a matrix.
+/// Sort sorts each row or each column of a matrix, the rows or columns are sorted in parallel.
 ///
 /// For further details, please see:
 /// https://docs.opencv.org/master/d2/de8/group__core__array.html#ga45dd56da289494ce874be2324856898f
@@ -1202,6 +1203,7 @@ Future<Mat> sortAsync(InputArray src, int flags, {OutputArray? dst}) async {
 
 /// SortIdx sorts each row or each column of a matrix.
 /// Instead of reordering the elements themselves, it stores the indices of sorted elements in the output array
+/// Equal elements keep their order.
 ///
 /// For further details, please see:
 /// https://docs.opencv.org/master/d2/de8/group__core__array.html#gadf35157cbf97f3cb85a545380e383506
@@ -1272,6 +1274,27 @@ Future<Scalar> sumAsync(Mat src) async {
   });
 }
 
+/// TopK selects the [k] largest ([SORT_DESCENDING]) or smallest ([SORT_ASCENDING]) elements of each
+/// row ([SORT_EVERY_ROW]) or column ([SORT_EVERY_COLUMN]) of a single channel matrix, sorted, without
+/// sorting the whole rows or columns.
+///
+/// [values] has the type of [src] and [indices] is [MatType.CV_32S], both rows x [k] or [k] x cols.
+/// Equal elements go to the lower index.
+Future<(Mat values, Mat indices)> topKAsync(
+  InputArray src,
+  int k, {
+  int flags = SORT_EVERY_ROW | SORT_DESCENDING,
+  OutputArray? values,
+  OutputArray? indices,
+}) async {
+  values ??= Mat.empty();
+  indices ??= Mat.empty();
+  return cvRunAsync0(
+    (callback) => ccore.cv_topK(src.ref, k, values!.ref, indices!.ref, flags, callback),
+    (c) => c.complete((values!, indices!)),
+  );
+}
+
 /// Trace returns the trace of a matrix.
 ///
 /// For further details, please see:
@@ -1375,8 +1398,17 @@ Future<Mat> randnAsync(InputOutputArray dst, Scalar mean, Scalar stddev) async {
 ///
 /// For further details, please see:
 /// https://docs.opencv.org/master/d2/de8/group__core__array.html#ga6a789c8a5cb56c6dd62506179808f763
-Future<Mat> randShuffleAsync(InputOutputArray dst, {double iterFactor = 1, Rng? rng}) async {
-  if (rng == null) {
+Future<Mat> randShuffleAsync(
+  InputOutputArray dst, {
+  double iterFactor = 1,
+  Rng? rng,
+  RngStream? stream,
+}) async {
+  if (stream != null) {
+    return cvRunAsync0((callback) => ccore.cv_RNGStream_shuffle(stream.ref, dst.ref, callback), (c) {
+      return c.complete(dst);
+    });
+  } else if (rng == null) {
     return cvRunAsync0((callback) => ccore.cv_randShuffle(dst.ref, callback), (c) {
       return c.complete(dst);
     });
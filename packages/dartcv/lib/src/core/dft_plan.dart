@@ -0,0 +1,109 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.core.dft_plan;
+
+import 'dart:ffi' as ffi;
+
+import 'package:ffi/ffi.dart';
+
+import '../g/core.g.dart' as ccore;
+import 'base.dart';
+import 'mat.dart';
+import 'mat_type.dart';
+import 'size.dart';
+import 'vec.dart';
+
+/// A reusable `dft` of a fixed size, type and flags.
+///
+/// `dft` prepares the transform (twiddle factors and scratch buffers) on every call,
+/// the plan prepares it once, which matters when the same transform runs many times,
+/// e.g., phase correlation or frequency filtering of every frame of a video.
+/// A plan can be used from several isolates at the same time.
+///
+/// With `pad: true` the size is rounded up to `getOptimalDFTSize` and smaller inputs are
+/// zero padded at the bottom-right.
+class DFTPlan extends CvStruct<ccore.DFTPlan> {
+  DFTPlan._(ccore.DFTPlanPtr ptr, [bool attach = true]) : super.fromPointer(ptr) {
+    if (attach) {
+      finalizer.attach(this, ptr.cast(), detach: this);
+    }
+  }
+
+  factory DFTPlan.fromPointer(ccore.DFTPlanPtr ptr, [bool attach = true]) => DFTPlan._(ptr, attach);
+
+  /// [size] is (width, height), [type] is one of CV_32FC1, CV_32FC2, CV_64FC1, CV_64FC2,
+  /// [flags] and [nonzeroRows] are the same as `dft`, use `DFT_INVERSE` for an inverse plan.
+  factory DFTPlan(
+    (int, int) size,
+    MatType type, {
+    int flags = 0,
+    int nonzeroRows = 0,
+    bool pad = false,
+  }) {
+    final p = calloc<ccore.DFTPlan>();
+    cvRun(() => ccore.cv_DFTPlan_create(size.cvd.ref, type.value, flags, nonzeroRows, pad, p));
+    return DFTPlan._(p);
+  }
+
+  static final finalizer = OcvFinalizer<ccore.DFTPlanPtr>(ccore.addresses.cv_DFTPlan_close);
+
+  void dispose() {
+    finalizer.detach(this);
+    ccore.cv_DFTPlan_close(ptr);
+  }
+
+  @override
+  ccore.DFTPlan get ref => ptr.ref;
+
+  /// Transforms [src], same as `dft(src, flags: flags, nonzeroRows: nonzeroRows)`.
+  Mat execute(Mat src, {Mat? dst}) {
+    dst ??= Mat.empty();
+    cvRun(() => ccore.cv_DFTPlan_execute(ref, src.ref, dst!.ref, ffi.nullptr));
+    return dst;
+  }
+
+  /// async version of [execute]
+  Future<Mat> executeAsync(Mat src, {Mat? dst}) async {
+    dst ??= Mat.empty();
+    return cvRunAsync0(
+      (callback) => ccore.cv_DFTPlan_execute(ref, src.ref, dst!.ref, callback),
+      (c) => c.complete(dst),
+    );
+  }
+
+  /// Transforms all of [src] in parallel.
+  VecMat executeBatch(VecMat src) {
+    final dst = VecMat();
+    cvRun(() => ccore.cv_DFTPlan_executeBatch(ref, src.ref, dst.ptr, ffi.nullptr));
+    return dst;
+  }
+
+  /// async version of [executeBatch]
+  Future<VecMat> executeBatchAsync(VecMat src) async {
+    final dst = VecMat();
+    return cvRunAsync0(
+      (callback) => ccore.cv_DFTPlan_executeBatch(ref, src.ref, dst.ptr, callback),
+      (c) => c.complete(dst),
+    );
+  }
+
+  /// The (padded) size of the transforms, (width, height).
+  (int width, int height) get size {
+    final s = ccore.cv_DFTPlan_getSize(ref);
+    return (s.width, s.height);
+  }
+
+  MatType get type => MatType(ccore.cv_DFTPlan_getType(ref));
+
+  /// The type of the results.
+  MatType get dstType => MatType(ccore.cv_DFTPlan_getDstType(ref));
+
+  int get flags => ccore.cv_DFTPlan_getFlags(ref);
+
+  @override
+  String toString() {
+    return "DFTPlan(address=0x${ptr.address.toRadixString(16)})";
+  }
+}
@@ -0,0 +1,169 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+// ignore_for_file: constant_identifier_names
+library cv.core.elem_expr;
+
+import 'dart:ffi' as ffi;
+
+import 'package:ffi/ffi.dart';
+
+import '../g/constants.g.dart';
+import '../g/core.g.dart' as ccore;
+import '../g/types.g.dart' as cvg;
+import 'base.dart';
+import 'mat.dart';
+import 'scalar.dart';
+
+/// Elementwise expression over [Mat]s and scalars, evaluated in a single pass.
+///
+/// Chains like `subtract` -> `multiply` -> `add` -> `convertScaleAbs` allocate a
+/// full temporary per step and walk the memory once per step. An [ElemExpr] is
+/// built from [ElemExprNode]s instead and [evaluate]d block by block over the rows,
+/// in parallel, without any full-size intermediate.
+///
+/// Values are computed in float (double if an input is 32S/64F or the output is
+/// 32S/64F) and saturated to the output depth at the end, like `convertScaleAbs`.
+///
+/// ```dart
+/// final expr = ElemExpr();
+/// final a = expr.input(matA), b = expr.input(matB);
+/// // convertScaleAbs((a - b) * 2 + 10)
+/// final dst = expr.evaluate(((a - b) * 2 + 10).abs(), dtype: MatType.CV_8U);
+/// ```
+class ElemExpr extends CvStruct<ccore.ElemExpr> {
+  ElemExpr._(ccore.ElemExprPtr ptr, [bool attach = true]) : super.fromPointer(ptr) {
+    if (attach) {
+      finalizer.attach(this, ptr.cast(), detach: this);
+    }
+  }
+
+  factory ElemExpr.fromPointer(ccore.ElemExprPtr ptr, [bool attach = true]) => ElemExpr._(ptr, attach);
+
+  factory ElemExpr() {
+    final p = calloc<ccore.ElemExpr>();
+    cvRun(() => ccore.cv_ElemExpr_create(p));
+    return ElemExpr._(p);
+  }
+
+  static final finalizer = OcvFinalizer<ccore.ElemExprPtr>(ccore.addresses.cv_ElemExpr_close);
+
+  void dispose() {
+    finalizer.detach(this);
+    ccore.cv_ElemExpr_close(ptr);
+  }
+
+  @override
+  ccore.ElemExpr get ref => ptr.ref;
+
+  static const int OP_ADD = 2;
+  static const int OP_SUB = 3;
+  static const int OP_MUL = 4;
+  static const int OP_DIV = 5;
+  static const int OP_MIN = 7;
+  static const int OP_MAX = 8;
+
+  int _node(ffi.Pointer<cvg.CvStatus> Function(ffi.Pointer<ffi.Int> p) func) {
+    final p = calloc<ffi.Int>();
+    cvRun(() => func(p));
+    final rval = p.value;
+    calloc.free(p);
+    return rval;
+  }
+
+  /// Adds [m] as an input, all inputs of an evaluation must have the same size and channels.
+  ///
+  /// [m] is referenced, not copied, use [setInput] to evaluate the same expression on
+  /// another [Mat], e.g., the next video frame.
+  ElemExprNode input(Mat m) => ElemExprNode._(this, _node((p) => ccore.cv_ElemExpr_input(ref, m.ref, p)));
+
+  /// Replaces the [Mat] of the input [node].
+  void setInput(ElemExprNode node, Mat m) {
+    cvRun(() => ccore.cv_ElemExpr_setInput(ref, node.id, m.ref));
+  }
+
+  /// Adds a per-channel constant.
+  ElemExprNode scalar(Scalar value) =>
+      ElemExprNode._(this, _node((p) => ccore.cv_ElemExpr_constant(ref, value.ref, p)));
+
+  /// Adds a constant for all channels.
+  ElemExprNode constant(num value) => scalar(Scalar.all(value.toDouble()));
+
+  /// [op] is one of [OP_ADD], [OP_SUB], [OP_MUL], [OP_DIV], [OP_MIN], [OP_MAX].
+  ElemExprNode binary(int op, ElemExprNode a, ElemExprNode b) =>
+      ElemExprNode._(this, _node((p) => ccore.cv_ElemExpr_binary(ref, op, a.id, b.id, p)));
+
+  /// 255 where `a cmpop b` holds, else 0, like `compare`.
+  ElemExprNode compare(ElemExprNode a, ElemExprNode b, int cmpop) =>
+      ElemExprNode._(this, _node((p) => ccore.cv_ElemExpr_compare(ref, cmpop, a.id, b.id, p)));
+
+  ElemExprNode abs(ElemExprNode a) => ElemExprNode._(this, _node((p) => ccore.cv_ElemExpr_abs(ref, a.id, p)));
+
+  /// Saturates (and rounds for integer depths) [a] to [depth], i.e., one of `MatType.CV_8U`...
+  ElemExprNode cast(ElemExprNode a, int depth) =>
+      ElemExprNode._(this, _node((p) => ccore.cv_ElemExpr_cast(ref, a.id, depth, p)));
+
+  /// Evaluates [root] into [dst] of depth [dtype] (the depth of the first input if -1).
+  Mat evaluate(ElemExprNode root, {int dtype = -1, Mat? dst}) {
+    dst ??= Mat.empty();
+    cvRun(() => ccore.cv_ElemExpr_evaluate(ref, root.id, dtype, dst!.ref, ffi.nullptr));
+    return dst;
+  }
+
+  /// async version of [evaluate]
+  Future<Mat> evaluateAsync(ElemExprNode root, {int dtype = -1, Mat? dst}) async {
+    dst ??= Mat.empty();
+    return cvRunAsync0(
+      (callback) => ccore.cv_ElemExpr_evaluate(ref, root.id, dtype, dst!.ref, callback),
+      (c) => c.complete(dst),
+    );
+  }
+
+  /// Number of nodes.
+  int get length => ccore.cv_ElemExpr_size(ref);
+
+  /// Removes all nodes and inputs.
+  void clear() => ccore.cv_ElemExpr_clear(ref);
+
+  @override
+  String toString() {
+    return "ElemExpr(address=0x${ptr.address.toRadixString(16)})";
+  }
+}
+
+/// A node of an [ElemExpr], operands can be [ElemExprNode], [num] or [Scalar].
+class ElemExprNode {
+  ElemExprNode._(this.expr, this.id);
+
+  final ElemExpr expr;
+  final int id;
+
+  ElemExprNode _operand(Object other) => switch (other) {
+    final ElemExprNode node => node,
+    final num v => expr.constant(v),
+    final Scalar s => expr.scalar(s),
+    _ => throw ArgumentError.value(other, "other", "must be ElemExprNode, num or Scalar"),
+  };
+
+  ElemExprNode operator +(Object other) => expr.binary(ElemExpr.OP_ADD, this, _operand(other));
+  ElemExprNode operator -(Object other) => expr.binary(ElemExpr.OP_SUB, this, _operand(other));
+  ElemExprNode operator *(Object other) => expr.binary(ElemExpr.OP_MUL, this, _operand(other));
+
+  /// Like `divide`, division by zero gives 0 for an integer result and inf or NaN for a float one.
+  ElemExprNode operator /(Object other) => expr.binary(ElemExpr.OP_DIV, this, _operand(other));
+
+  ElemExprNode min(Object other) => expr.binary(ElemExpr.OP_MIN, this, _operand(other));
+  ElemExprNode max(Object other) => expr.binary(ElemExpr.OP_MAX, this, _operand(other));
+  ElemExprNode abs() => expr.abs(this);
+  ElemExprNode compare(Object other, int cmpop) => expr.compare(this, _operand(other), cmpop);
+  ElemExprNode cast(int depth) => expr.cast(this, depth);
+
+  ElemExprNode operator >(Object other) => compare(other, CMP_GT);
+  ElemExprNode operator >=(Object other) => compare(other, CMP_GE);
+  ElemExprNode operator <(Object other) => compare(other, CMP_LT);
+  ElemExprNode operator <=(Object other) => compare(other, CMP_LE);
+
+  @override
+  String toString() => "ElemExprNode(id=$id)";
+}
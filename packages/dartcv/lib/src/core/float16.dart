@@ -4,10 +4,7 @@
 
 import 'dart:collection';
 import 'dart:ffi' as ffi;
-
-import 'package:ffi/ffi.dart';
-
-import '../g/types.g.dart' as cvg;
+import 'dart:typed_data';
 
 extension type Float16P(ffi.Pointer<ffi.Uint16> ptr) {
   double get value => float16(ptr.value);
@@ -49,52 +46,45 @@ class Float16List with ListMixin<double> {
   set length(int newLength) => throw UnsupportedError('Float16List does not support setting length');
 }
 
-double float16(int w) {
-  final t = calloc<ffi.UnsignedInt>()..value = ((w & 0x7fff) << 13) + 0x38000000;
-  final sign = calloc<ffi.UnsignedInt>()..value = (w & 0x8000) << 16;
-  final e = calloc<ffi.UnsignedInt>()..value = w & 0x7c00;
+// float32 bits of the conversions, shares the buffer of _f32
+final _f32 = Float32List(1);
+final _u32 = _f32.buffer.asUint32List();
 
-  final out = calloc<cvg.Cv32suf_C>()..ref.u = t.value + (1 << 23);
-  if (e.value >= 0x7c00) {
-    out.ref.u = t.value + 0x38000000;
+/// Converts the IEEE 754 binary16 bits [w] to a double, same as `cv::hfloat` without hardware support.
+double float16(int w) {
+  final t = ((w & 0x7fff) << 13) + 0x38000000;
+  final sign = (w & 0x8000) << 16;
+  final e = w & 0x7c00;
+
+  _u32[0] = t + (1 << 23);
+  if (e >= 0x7c00) {
+    _u32[0] = t + 0x38000000;
+  } else if (e == 0) {
+    _f32[0] -= 6.103515625e-05;
   } else {
-    if (e.value == 0) {
-      out.ref.f -= 6.103515625e-05;
-    } else {
-      out.ref.u = t.value;
-    }
+    _u32[0] = t;
   }
-  out.ref.u |= sign.value;
-  final rval = out.ref.f;
-  calloc.free(out);
-  calloc.free(t);
-  calloc.free(sign);
-  calloc.free(e);
-  return rval;
+  _u32[0] |= sign;
+  return _f32[0];
 }
 
+/// Converts [x] to IEEE 754 binary16 bits (round to nearest even).
 int float16Inv(double x) {
-  final in_ = calloc<cvg.Cv32suf_C>()..ref.f = x;
-  final sign = calloc<ffi.UnsignedInt>()..value = in_.ref.u & 0x80000000;
-  final w = calloc<ffi.UnsignedInt>();
-  in_.ref.u ^= sign.value;
-  if (in_.ref.u > 0x47800000) {
-    w.value = in_.ref.u > 0x7f800000 ? 0x7e00 : 0x7c00;
+  _f32[0] = x;
+  final sign = _u32[0] & 0x80000000;
+  _u32[0] ^= sign;
+  final u = _u32[0];
+  final int w;
+  if (u > 0x47800000) {
+    w = u > 0x7f800000 ? 0x7e00 : 0x7c00;
+  } else if (u < 0x38800000) {
+    _f32[0] += 0.5;
+    w = _u32[0] - 0x3f000000;
   } else {
-    if (in_.ref.u < 0x38800000) {
-      in_.ref.f += 0.5;
-      w.value = in_.ref.u - 0x3f000000;
-    } else {
-      final t = calloc<ffi.UnsignedInt>()..value = in_.ref.u + 0xc8000fff;
-      w.value = (t.value + ((in_.ref.u >> 13) & 1)) >> 13;
-      calloc.free(t);
-    }
+    final t = (u + 0xc8000fff) & 0xffffffff;
+    w = (t + ((u >> 13) & 1)) >> 13;
   }
-  final rval = w.value | (sign.value >> 16);
-  calloc.free(in_);
-  calloc.free(sign);
-  calloc.free(w);
-  return rval;
+  return w | (sign >> 16);
 }
 
 extension PointerUint16Extension on ffi.Pointer<ffi.Uint16> {
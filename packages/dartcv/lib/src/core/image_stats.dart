@@ -0,0 +1,169 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+// ignore_for_file: constant_identifier_names
+library cv.core.image_stats;
+
+import 'dart:ffi' as ffi;
+
+import '../g/core.g.dart' as ccore;
+import 'base.dart';
+import 'mat.dart';
+import 'point.dart';
+import 'size.dart';
+
+/// Flags of [imageStats].
+const int STATS_SUM = 1;
+const int STATS_MEAN = 2;
+const int STATS_STDDEV = 4;
+const int STATS_MINMAX = 8;
+const int STATS_NONZERO = 16;
+const int STATS_NORM_L1 = 32;
+const int STATS_NORM_L2 = 64;
+const int STATS_HIST = 128;
+const int STATS_ALL = 255;
+
+/// Columns of [ImageStats.stats].
+const int STAT_COUNT = 0;
+const int STAT_SUM = 1;
+const int STAT_MEAN = 2;
+const int STAT_STDDEV = 3;
+const int STAT_MIN = 4;
+const int STAT_MAX = 5;
+const int STAT_MIN_X = 6;
+const int STAT_MIN_Y = 7;
+const int STAT_MAX_X = 8;
+const int STAT_MAX_Y = 9;
+const int STAT_NONZERO = 10;
+const int STAT_NORM_L1 = 11;
+const int STAT_NORM_L2 = 12;
+
+/// Result of [imageStats].
+///
+/// [stats] has a row per channel of every grid cell (row `cell * channels + c`,
+/// cells in row-major order) and the `STAT_*` columns, [hist] has the same rows
+/// and `histBins` columns, it is empty without [STATS_HIST].
+class ImageStats {
+  ImageStats(this.stats, this.hist, this.grid, this.channels);
+
+  final Mat stats;
+  final Mat hist;
+  final (int, int) grid;
+  final int channels;
+
+  int _row(int channel, int cellX, int cellY) => (cellY * grid.$1 + cellX) * channels + channel;
+
+  /// Value of the [stat] column (`STAT_*`) of [channel] in cell ([cellX], [cellY]).
+  double get(int stat, {int channel = 0, int cellX = 0, int cellY = 0}) =>
+      stats.at<double>(_row(channel, cellX, cellY), stat);
+
+  int count({int channel = 0, int cellX = 0, int cellY = 0}) =>
+      get(STAT_COUNT, channel: channel, cellX: cellX, cellY: cellY).toInt();
+  double sum({int channel = 0, int cellX = 0, int cellY = 0}) =>
+      get(STAT_SUM, channel: channel, cellX: cellX, cellY: cellY);
+  double mean({int channel = 0, int cellX = 0, int cellY = 0}) =>
+      get(STAT_MEAN, channel: channel, cellX: cellX, cellY: cellY);
+  double stddev({int channel = 0, int cellX = 0, int cellY = 0}) =>
+      get(STAT_STDDEV, channel: channel, cellX: cellX, cellY: cellY);
+  double min({int channel = 0, int cellX = 0, int cellY = 0}) =>
+      get(STAT_MIN, channel: channel, cellX: cellX, cellY: cellY);
+  double max({int channel = 0, int cellX = 0, int cellY = 0}) =>
+      get(STAT_MAX, channel: channel, cellX: cellX, cellY: cellY);
+  int nonZero({int channel = 0, int cellX = 0, int cellY = 0}) =>
+      get(STAT_NONZERO, channel: channel, cellX: cellX, cellY: cellY).toInt();
+  double normL1({int channel = 0, int cellX = 0, int cellY = 0}) =>
+      get(STAT_NORM_L1, channel: channel, cellX: cellX, cellY: cellY);
+  double normL2({int channel = 0, int cellX = 0, int cellY = 0}) =>
+      get(STAT_NORM_L2, channel: channel, cellX: cellX, cellY: cellY);
+
+  /// Location of the first minimum, in image coordinates.
+  Point minLoc({int channel = 0, int cellX = 0, int cellY = 0}) {
+    final row = _row(channel, cellX, cellY);
+    return Point(stats.at<double>(row, STAT_MIN_X).toInt(), stats.at<double>(row, STAT_MIN_Y).toInt());
+  }
+
+  /// Location of the first maximum, in image coordinates.
+  Point maxLoc({int channel = 0, int cellX = 0, int cellY = 0}) {
+    final row = _row(channel, cellX, cellY);
+    return Point(stats.at<double>(row, STAT_MAX_X).toInt(), stats.at<double>(row, STAT_MAX_Y).toInt());
+  }
+
+  /// Histogram of [channel] in cell ([cellX], [cellY]).
+  List<int> histogram({int channel = 0, int cellX = 0, int cellY = 0}) {
+    final row = _row(channel, cellX, cellY);
+    return List.generate(hist.cols, (i) => hist.at<int>(row, i));
+  }
+
+  void dispose() {
+    stats.dispose();
+    hist.dispose();
+  }
+}
+
+/// Computes the statistics requested by [flags] (`STATS_*`) of every channel of [src] in one
+/// parallel pass, instead of scanning it once per `mean`, `meanStdDev`, `minMaxLoc`,
+/// `countNonZero`, `norm` and `calcHist`.
+///
+/// With [grid] `(cols, rows)` the statistics are computed for every cell of the grid.
+/// The histogram (with [STATS_HIST]) has [histBins] uniform bins over [histRange]
+/// `[min, max)` and values outside of it are not counted.
+///
+/// Norms are per channel, i.e., `norm` of a multi-channel image is
+/// `sqrt(sum of normL2^2)` for L2 and the sum of normL1 for L1.
+ImageStats imageStats(
+  InputArray src, {
+  int flags = STATS_ALL,
+  InputArray? mask,
+  (int, int) grid = (1, 1),
+  int histBins = 16,
+  (double, double) histRange = (0, 256),
+}) {
+  mask ??= Mat.empty();
+  final stats = Mat.empty();
+  final hist = Mat.empty();
+  cvRun(
+    () => ccore.cv_imageStats(
+      src.ref,
+      mask!.ref,
+      flags,
+      grid.cvd.ref,
+      histBins,
+      histRange.$1,
+      histRange.$2,
+      stats.ref,
+      hist.ref,
+      ffi.nullptr,
+    ),
+  );
+  return ImageStats(stats, hist, grid, src.channels);
+}
+
+/// async version of [imageStats]
+Future<ImageStats> imageStatsAsync(
+  InputArray src, {
+  int flags = STATS_ALL,
+  InputArray? mask,
+  (int, int) grid = (1, 1),
+  int histBins = 16,
+  (double, double) histRange = (0, 256),
+}) async {
+  mask ??= Mat.empty();
+  final stats = Mat.empty();
+  final hist = Mat.empty();
+  return cvRunAsync0(
+    (callback) => ccore.cv_imageStats(
+      src.ref,
+      mask!.ref,
+      flags,
+      grid.cvd.ref,
+      histBins,
+      histRange.$1,
+      histRange.$2,
+      stats.ref,
+      hist.ref,
+      callback,
+    ),
+    (c) => c.complete(ImageStats(stats, hist, grid, src.channels)),
+  );
+}
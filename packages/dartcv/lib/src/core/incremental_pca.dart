@@ -0,0 +1,149 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.core.incremental_pca;
+
+import 'dart:ffi' as ffi;
+
+import 'package:ffi/ffi.dart';
+
+import '../g/core.g.dart' as ccore;
+import 'base.dart';
+import 'mat.dart';
+
+/// PCA of samples fed in batches, for descriptor sets that do not fit in memory at once.
+///
+/// Only the sample count, the mean and the d x d scatter matrix are kept, so the memory
+/// depends on the dimension d only. After any number of [partialFit] calls the components
+/// are the same as `PCACompute` on all the samples stacked together.
+class IncrementalPCA extends CvStruct<ccore.IncrementalPCA> {
+  IncrementalPCA._(ccore.IncrementalPCAPtr ptr, [bool attach = true]) : super.fromPointer(ptr) {
+    if (attach) {
+      finalizer.attach(this, ptr.cast(), detach: this);
+    }
+  }
+
+  factory IncrementalPCA.fromPointer(ccore.IncrementalPCAPtr ptr, [bool attach = true]) =>
+      IncrementalPCA._(ptr, attach);
+
+  /// Keeps [maxComponents] components, all of them if 0.
+  factory IncrementalPCA({int maxComponents = 0}) {
+    final p = calloc<ccore.IncrementalPCA>();
+    cvRun(() => ccore.cv_IncrementalPCA_create(maxComponents, p));
+    return IncrementalPCA._(p);
+  }
+
+  /// Loads a model written by [save], which can then be used or fitted further.
+  factory IncrementalPCA.load(String filename) => IncrementalPCA()..loadFrom(filename);
+
+  static final finalizer = OcvFinalizer<ccore.IncrementalPCAPtr>(
+    ccore.addresses.cv_IncrementalPCA_close,
+  );
+
+  void dispose() {
+    finalizer.detach(this);
+    ccore.cv_IncrementalPCA_close(ptr);
+  }
+
+  @override
+  ccore.IncrementalPCA get ref => ptr.ref;
+
+  /// Adds a batch of samples, one per row, of any depth.
+  void partialFit(Mat batch) =>
+      cvRun(() => ccore.cv_IncrementalPCA_partialFit(ref, batch.ref, ffi.nullptr));
+
+  /// async version of [partialFit]
+  Future<void> partialFitAsync(Mat batch) async => cvRunAsync0(
+    (callback) => ccore.cv_IncrementalPCA_partialFit(ref, batch.ref, callback),
+    (c) => c.complete(),
+  );
+
+  /// Projects [data] (one sample per row) onto the components, see `PCAProject`.
+  Mat project(Mat data, {Mat? result}) {
+    result ??= Mat.empty();
+    cvRun(() => ccore.cv_IncrementalPCA_project(ref, data.ref, result!.ref, ffi.nullptr));
+    return result;
+  }
+
+  /// async version of [project]
+  Future<Mat> projectAsync(Mat data, {Mat? result}) async {
+    result ??= Mat.empty();
+    return cvRunAsync0(
+      (callback) => ccore.cv_IncrementalPCA_project(ref, data.ref, result!.ref, callback),
+      (c) => c.complete(result),
+    );
+  }
+
+  /// Reconstructs samples from their projections, see `PCABackProject`.
+  Mat backProject(Mat data, {Mat? result}) {
+    result ??= Mat.empty();
+    cvRun(() => ccore.cv_IncrementalPCA_backProject(ref, data.ref, result!.ref, ffi.nullptr));
+    return result;
+  }
+
+  /// async version of [backProject]
+  Future<Mat> backProjectAsync(Mat data, {Mat? result}) async {
+    result ??= Mat.empty();
+    return cvRunAsync0(
+      (callback) => ccore.cv_IncrementalPCA_backProject(ref, data.ref, result!.ref, callback),
+      (c) => c.complete(result),
+    );
+  }
+
+  /// The mean of all samples (1 x d, CV_64F).
+  Mat get mean {
+    final rval = Mat.empty();
+    cvRun(() => ccore.cv_IncrementalPCA_getMean(ref, rval.ref));
+    return rval;
+  }
+
+  /// The components, one per row, by descending eigenvalue (maxComponents x d, CV_64F).
+  Mat get eigenvectors {
+    final rval = Mat.empty();
+    cvRun(() => ccore.cv_IncrementalPCA_getEigenvectors(ref, rval.ref));
+    return rval;
+  }
+
+  /// The variances along the components (maxComponents x 1, CV_64F).
+  Mat get eigenvalues {
+    final rval = Mat.empty();
+    cvRun(() => ccore.cv_IncrementalPCA_getEigenvalues(ref, rval.ref));
+    return rval;
+  }
+
+  /// Writes the model to a `FileStorage` file (.yml, .xml or .json).
+  ///
+  /// The file also has the "mean", "vectors" and "values" nodes read by `cv::PCA::read`.
+  void save(String filename) {
+    final cname = filename.toNativeUtf8().cast<ffi.Char>();
+    try {
+      cvRun(() => ccore.cv_IncrementalPCA_save(ref, cname, ffi.nullptr));
+    } finally {
+      calloc.free(cname);
+    }
+  }
+
+  /// Replaces this model by the one in [filename], written by [save].
+  void loadFrom(String filename) {
+    final cname = filename.toNativeUtf8().cast<ffi.Char>();
+    try {
+      cvRun(() => ccore.cv_IncrementalPCA_load(ref, cname, ffi.nullptr));
+    } finally {
+      calloc.free(cname);
+    }
+  }
+
+  /// Samples seen by [partialFit] so far.
+  int get numSamples => ccore.cv_IncrementalPCA_getNumSamples(ref);
+
+  int get maxComponents => ccore.cv_IncrementalPCA_getMaxComponents(ref);
+
+  /// The dimension d of the samples, 0 before the first [partialFit].
+  int get dims => ccore.cv_IncrementalPCA_getDims(ref);
+
+  @override
+  String toString() {
+    return "IncrementalPCA(address=0x${ptr.address.toRadixString(16)})";
+  }
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.core.mat_io;
+
+import 'dart:ffi' as ffi;
+
+import 'package:ffi/ffi.dart';
+
+import '../g/core.g.dart' as ccore;
+import 'base.dart';
+import 'mat.dart';
+import 'vec.dart';
+
+/// Saves [mat] to [filename] as raw binary, lossless for any depth, channels and dimensions.
+///
+/// Every payload is 64-byte aligned in the file so it can be loaded with `mmap: true`
+/// by [loadMat] without parsing or copying.
+void saveMat(String filename, Mat mat) {
+  final cname = filename.toNativeUtf8().cast<ffi.Char>();
+  try {
+    cvRun(() => ccore.cv_saveMat(cname, mat.ref, ffi.nullptr));
+  } finally {
+    calloc.free(cname);
+  }
+}
+
+/// async version of [saveMat]
+Future<void> saveMatAsync(String filename, Mat mat) async {
+  final cname = filename.toNativeUtf8().cast<ffi.Char>();
+  return cvRunAsync0((callback) => ccore.cv_saveMat(cname, mat.ref, callback), (c) {
+    calloc.free(cname);
+    return c.complete();
+  });
+}
+
+/// Saves all of [mats] to one file, see [saveMat].
+void saveMats(String filename, VecMat mats) {
+  final cname = filename.toNativeUtf8().cast<ffi.Char>();
+  try {
+    cvRun(() => ccore.cv_saveMats(cname, mats.ref, ffi.nullptr));
+  } finally {
+    calloc.free(cname);
+  }
+}
+
+/// async version of [saveMats]
+Future<void> saveMatsAsync(String filename, VecMat mats) async {
+  final cname = filename.toNativeUtf8().cast<ffi.Char>();
+  return cvRunAsync0((callback) => ccore.cv_saveMats(cname, mats.ref, callback), (c) {
+    calloc.free(cname);
+    return c.complete();
+  });
+}
+
+/// Loads the first [Mat] of a file written by [saveMat] or [saveMats].
+///
+/// With [mmap] the data is not read but mapped copy-on-write, pages are loaded on first
+/// access and modifications of the [Mat] never reach the file. The mapping is released
+/// with the last [Mat] using it.
+Mat loadMat(String filename, {bool mmap = false}) {
+  final cname = filename.toNativeUtf8().cast<ffi.Char>();
+  final rval = Mat.empty();
+  try {
+    cvRun(() => ccore.cv_loadMat(cname, mmap, rval.ref, ffi.nullptr));
+  } finally {
+    calloc.free(cname);
+  }
+  return rval;
+}
+
+/// async version of [loadMat]
+Future<Mat> loadMatAsync(String filename, {bool mmap = false}) async {
+  final cname = filename.toNativeUtf8().cast<ffi.Char>();
+  final rval = Mat.empty();
+  return cvRunAsync0((callback) => ccore.cv_loadMat(cname, mmap, rval.ref, callback), (c) {
+    calloc.free(cname);
+    return c.complete(rval);
+  });
+}
+
+/// Loads all [Mat]s of a file written by [saveMat] or [saveMats], see [loadMat].
+VecMat loadMats(String filename, {bool mmap = false}) {
+  final cname = filename.toNativeUtf8().cast<ffi.Char>();
+  final rval = VecMat();
+  try {
+    cvRun(() => ccore.cv_loadMats(cname, mmap, rval.ptr, ffi.nullptr));
+  } finally {
+    calloc.free(cname);
+  }
+  return rval;
+}
+
+/// async version of [loadMats]
+Future<VecMat> loadMatsAsync(String filename, {bool mmap = false}) async {
+  final cname = filename.toNativeUtf8().cast<ffi.Char>();
+  final rval = VecMat();
+  return cvRunAsync0((callback) => ccore.cv_loadMats(cname, mmap, rval.ptr, callback), (c) {
+    calloc.free(cname);
+    return c.complete(rval);
+  });
+}
@@ -0,0 +1,159 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.core.minibatch_kmeans;
+
+import 'dart:ffi' as ffi;
+
+import 'package:ffi/ffi.dart';
+
+import '../g/constants.g.dart';
+import '../g/core.g.dart' as ccore;
+import 'base.dart';
+import 'mat.dart';
+import 'termcriteria.dart';
+
+/// Mini-batch k-means, a much faster alternative to `kmeans` for large data such as
+/// the color quantization of high resolution images.
+///
+/// Samples are the rows of a 1-channel [Mat] (N x d), or the pixels of a multi-channel
+/// [Mat] (N = rows * cols, d = channels), of any depth, so an image can be passed as is.
+///
+/// Centers are seeded by k-means++ on [seedSamples] random samples, every iteration
+/// assigns [batchSize] random samples to the nearest centers in parallel and moves the
+/// centers towards them, labels of all samples are assigned in parallel at the end.
+///
+/// Pass `warmStart: true` to [fit] to refine the previous centers instead of seeding
+/// new ones, e.g., to update a video palette frame by frame with stable labels.
+class MiniBatchKMeans extends CvStruct<ccore.MiniBatchKMeans> {
+  MiniBatchKMeans._(ccore.MiniBatchKMeansPtr ptr, [bool attach = true]) : super.fromPointer(ptr) {
+    if (attach) {
+      finalizer.attach(this, ptr.cast(), detach: this);
+    }
+  }
+
+  factory MiniBatchKMeans.fromPointer(ccore.MiniBatchKMeansPtr ptr, [bool attach = true]) =>
+      MiniBatchKMeans._(ptr, attach);
+
+  /// [criteria] limits the iterations and stops when no center moves more than its epsilon.
+  factory MiniBatchKMeans(
+    int k, {
+    int batchSize = 1024,
+    (int, int, double) criteria = (TERM_COUNT + TERM_EPS, 100, 1e-3),
+    int seedSamples = 10000,
+    int seed = 0x12345789,
+  }) {
+    final p = calloc<ccore.MiniBatchKMeans>();
+    cvRun(
+      () => ccore.cv_MiniBatchKMeans_create(
+        k,
+        batchSize,
+        TermCriteria.fromRecord(criteria).ref,
+        seedSamples,
+        seed,
+        p,
+      ),
+    );
+    return MiniBatchKMeans._(p);
+  }
+
+  static final finalizer = OcvFinalizer<ccore.MiniBatchKMeansPtr>(
+    ccore.addresses.cv_MiniBatchKMeans_close,
+  );
+
+  void dispose() {
+    finalizer.detach(this);
+    ccore.cv_MiniBatchKMeans_close(ptr);
+  }
+
+  @override
+  ccore.MiniBatchKMeans get ref => ptr.ref;
+
+  /// Clusters [data], returns the compactness, the labels (N x 1, CV_32S) and the centers (k x d, CV_32F).
+  (double compactness, Mat labels, Mat centers) fit(
+    Mat data, {
+    bool warmStart = false,
+    Mat? labels,
+    Mat? centers,
+  }) {
+    labels ??= Mat.empty();
+    centers ??= Mat.empty();
+    final p = calloc<ffi.Double>();
+    cvRun(
+      () => ccore.cv_MiniBatchKMeans_fit(ref, data.ref, warmStart, labels!.ref, centers!.ref, p, ffi.nullptr),
+    );
+    final rval = p.value;
+    calloc.free(p);
+    return (rval, labels, centers);
+  }
+
+  /// async version of [fit]
+  Future<(double compactness, Mat labels, Mat centers)> fitAsync(
+    Mat data, {
+    bool warmStart = false,
+    Mat? labels,
+    Mat? centers,
+  }) async {
+    labels ??= Mat.empty();
+    centers ??= Mat.empty();
+    final p = calloc<ffi.Double>();
+    return cvRunAsync0(
+      (callback) =>
+          ccore.cv_MiniBatchKMeans_fit(ref, data.ref, warmStart, labels!.ref, centers!.ref, p, callback),
+      (c) {
+        final rval = p.value;
+        calloc.free(p);
+        return c.complete((rval, labels!, centers!));
+      },
+    );
+  }
+
+  /// Assigns every sample of [data] to the nearest center, returns the compactness and the labels.
+  (double compactness, Mat labels) predict(Mat data, {Mat? labels}) {
+    labels ??= Mat.empty();
+    final p = calloc<ffi.Double>();
+    cvRun(() => ccore.cv_MiniBatchKMeans_predict(ref, data.ref, labels!.ref, p, ffi.nullptr));
+    final rval = p.value;
+    calloc.free(p);
+    return (rval, labels);
+  }
+
+  /// async version of [predict]
+  Future<(double compactness, Mat labels)> predictAsync(Mat data, {Mat? labels}) async {
+    labels ??= Mat.empty();
+    final p = calloc<ffi.Double>();
+    return cvRunAsync0(
+      (callback) => ccore.cv_MiniBatchKMeans_predict(ref, data.ref, labels!.ref, p, callback),
+      (c) {
+        final rval = p.value;
+        calloc.free(p);
+        return c.complete((rval, labels!));
+      },
+    );
+  }
+
+  /// The centers of the last [fit] (k x d, CV_32F).
+  ///
+  /// Set them (e.g., a known palette) to start the next warm-started [fit] from,
+  /// they weigh as much as one mini-batch of samples.
+  Mat get centers {
+    final rval = Mat.empty();
+    cvRun(() => ccore.cv_MiniBatchKMeans_getCenters(ref, rval.ref));
+    return rval;
+  }
+
+  set centers(Mat value) => cvRun(() => ccore.cv_MiniBatchKMeans_setCenters(ref, value.ref));
+
+  int get k => ccore.cv_MiniBatchKMeans_getK(ref);
+
+  int get batchSize => ccore.cv_MiniBatchKMeans_getBatchSize(ref);
+
+  /// Iterations done by the last [fit].
+  int get iterations => ccore.cv_MiniBatchKMeans_getIterations(ref);
+
+  @override
+  String toString() {
+    return "MiniBatchKMeans(address=0x${ptr.address.toRadixString(16)})";
+  }
+}
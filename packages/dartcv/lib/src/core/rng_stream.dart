@@ -0,0 +1,88 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.core.rng_stream;
+
+import 'dart:ffi' as ffi;
+
+import 'package:ffi/ffi.dart';
+
+import '../g/constants.g.dart';
+import '../g/core.g.dart' as ccore;
+import 'base.dart';
+import 'mat.dart';
+import 'scalar.dart';
+
+/// A counter-based random stream (Philox4x32-10) for parallel and reproducible random fills.
+///
+/// Unlike `Rng`, the n-th number of a stream only depends on ([seed], [stream], n), so [fill]
+/// and [shuffle] run in parallel and give the same result for any number of threads.
+/// Streams with the same seed and different ids are independent, e.g., use the index of
+/// a sample in an augmentation batch as its stream id.
+///
+/// Every value drawn advances [position] by one, set it to replay or skip values.
+class RngStream extends CvStruct<ccore.RNGStream> {
+  RngStream._(ccore.RNGStreamPtr ptr, [bool attach = true]) : super.fromPointer(ptr) {
+    if (attach) {
+      finalizer.attach(this, ptr.cast(), detach: this);
+    }
+  }
+
+  factory RngStream.fromPointer(ccore.RNGStreamPtr ptr, [bool attach = true]) => RngStream._(ptr, attach);
+
+  factory RngStream(int seed, {int stream = 0}) {
+    final p = calloc<ccore.RNGStream>();
+    cvRun(() => ccore.cv_RNGStream_create(seed, stream, p));
+    return RngStream._(p);
+  }
+
+  static final finalizer = OcvFinalizer<ccore.RNGStreamPtr>(ccore.addresses.cv_RNGStream_close);
+
+  void dispose() {
+    finalizer.detach(this);
+    ccore.cv_RNGStream_close(ptr);
+  }
+
+  @override
+  ccore.RNGStream get ref => ptr.ref;
+
+  /// Fills [mat] in place, with [RNG_DIST_UNIFORM] values in \[a, b) or [RNG_DIST_NORMAL]
+  /// values of mean a and standard deviation b, per channel, for any depth.
+  Mat fill(Mat mat, int distType, Scalar a, Scalar b) {
+    cvRun(() => ccore.cv_RNGStream_fill(ref, mat.ref, distType, a.ref, b.ref, ffi.nullptr));
+    return mat;
+  }
+
+  /// async version of [fill]
+  Future<Mat> fillAsync(Mat mat, int distType, Scalar a, Scalar b) async => cvRunAsync0(
+    (callback) => ccore.cv_RNGStream_fill(ref, mat.ref, distType, a.ref, b.ref, callback),
+    (c) => c.complete(mat),
+  );
+
+  /// Shuffles the elements of [mat] in place, see `randShuffle`.
+  Mat shuffle(Mat mat) {
+    cvRun(() => ccore.cv_RNGStream_shuffle(ref, mat.ref, ffi.nullptr));
+    return mat;
+  }
+
+  /// async version of [shuffle]
+  Future<Mat> shuffleAsync(Mat mat) async => cvRunAsync0(
+    (callback) => ccore.cv_RNGStream_shuffle(ref, mat.ref, callback),
+    (c) => c.complete(mat),
+  );
+
+  int get seed => ccore.cv_RNGStream_getSeed(ref);
+
+  int get stream => ccore.cv_RNGStream_getStream(ref);
+
+  /// The number of values drawn so far.
+  int get position => ccore.cv_RNGStream_getPosition(ref);
+
+  set position(int value) => ccore.cv_RNGStream_setPosition(ref, value);
+
+  @override
+  String toString() {
+    return "RngStream(address=0x${ptr.address.toRadixString(16)})";
+  }
+}
@@ -741,6 +741,9 @@ class VecF32 extends Vec<cvg.VecF32, double> {
 
   @override
   int size() => ccore.std_VecF32_length(ptr);
+
+  /// Converts to float16 natively (vectorized).
+  VecF16 toVecF16() => VecF16.fromVecF32(this);
 }
 
 class VecF32Iterator extends VecIterator<double> {
@@ -862,15 +865,30 @@ class VecF16 extends Vec<cvg.VecF16, double> {
     }
   }
 
-  factory VecF16([int length = 0, double value = 0.0]) => VecF16.generate(length, (i) => value);
+  factory VecF16([int length = 0, double value = 0.0]) =>
+      VecF16.fromPointer(ccore.std_VecF16_new_1(length, value.fp16), length: length);
+
+  /// Converts [pts] to float16 natively (vectorized), see [VecF16.fromVecF32].
+  factory VecF16.fromList(List<double> pts) {
+    final length = pts.length;
+    final src = calloc<ffi.Float>(length);
+    src.asTypedList(length).setAll(0, pts);
+    final p = ccore.std_VecF16_new_f32(length, src);
+    calloc.free(src);
+    return VecF16.fromPointer(p, length: length);
+  }
 
-  // TODO: use setRange if dart ffi supports float16
-  factory VecF16.fromList(List<double> pts) => VecF16.generate(pts.length, (i) => pts[i]);
+  /// Converts [vec] to float16 natively (vectorized), without a copy on the dart side.
+  factory VecF16.fromVecF32(VecF32 vec) {
+    final length = vec.length;
+    return VecF16.fromPointer(ccore.std_VecF16_new_f32(length, vec.dataPtr), length: length);
+  }
 
   factory VecF16.generate(int length, double Function(int i) generator) {
     final p = ccore.std_VecF16_new(length);
+    final pdata = ccore.std_VecF16_data(p);
     for (var i = 0; i < length; i++) {
-      ccore.std_VecF16_set(p, i, generator(i).fp16);
+      pdata[i] = generator(i).fp16;
     }
     return VecF16.fromPointer(p, length: length);
   }
@@ -888,6 +906,23 @@ class VecF16 extends Vec<cvg.VecF16, double> {
   Uint16List get data => dataPtr.cast<ffi.Uint16>().asTypedList(length);
   Iterable<double> get dataFp16 => data.map(float16);
 
+  /// Converts to float32 natively (vectorized).
+  VecF32 toVecF32() {
+    final rval = VecF32(length);
+    ccore.std_VecF16_to_f32(ptr, rval.dataPtr);
+    return rval;
+  }
+
+  /// Converts to a dart [Float32List] natively (vectorized).
+  Float32List toFloat32List() {
+    final length = this.length;
+    final dst = calloc<ffi.Float>(length);
+    ccore.std_VecF16_to_f32(ptr, dst);
+    final rval = Float32List.fromList(dst.asTypedList(length));
+    calloc.free(dst);
+    return rval;
+  }
+
   @override
   Iterator<double> get iterator => VecF16Iterator(data);
   @override
@@ -903,10 +938,10 @@ class VecF16 extends Vec<cvg.VecF16, double> {
   ffi.Pointer<ffi.Void> asVoid() => dataPtr.cast<ffi.Void>();
 
   @override
-  void operator []=(int idx, double value) => ccore.std_VecF16_set(ptr, idx, value.fp16);
+  void operator []=(int idx, double value) => data[idx] = value.fp16;
 
   @override
-  double operator [](int idx) => ccore.std_VecF16_get(ptr, idx).fp16;
+  double operator [](int idx) => data[idx].fp16;
 
   @override
   void add(double element) => ccore.std_VecF16_push_back(ptr, element.fp16);
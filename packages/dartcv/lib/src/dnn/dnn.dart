@@ -425,6 +425,9 @@ List<int> getAvailableTargets(int backend) {
 /// Optionally resizes and crops image from center,
 /// subtract mean values, scales values by scalefactor, swap Blue and Red channels.
 ///
+/// [ddepth] can be [MatType.CV_32F], [MatType.CV_8U] or [MatType.CV_16F],
+/// the latter halves the size of the blob for FP16 models.
+///
 /// For further details, please see:
 /// https://docs.opencv.org/4.x/d6/d0f/group__dnn.html#ga29f34df9376379a603acd8df581ac8d7
 Mat blobFromImage(
@@ -20,6 +20,7 @@ import '../core/vec.dart';
 import '../g/constants.g.dart';
 import '../g/features2d.g.dart' as cvg;
 import '../g/features2d.g.dart' as cfeatures2d;
+import '../imgproc/image_pyramid.dart';
 import 'features2d_base.dart';
 import 'features2d_enum.dart';
 
@@ -1049,6 +1050,37 @@ class ORB extends Feature2D<cvg.ORB> {
     return (keypoints, descriptors);
   }
 
+  /// Detects keypoints and computes descriptors on the levels of a prebuilt [ImagePyramid]
+  /// instead of building ORB's own pyramid, so the pyramid can be shared with other detectors.
+  ///
+  /// [maxFeatures] is distributed over the levels the same way as ORB, the keypoints are in
+  /// level 0 coordinates and their `octave` is the pyramid level. [nLevels], [firstLevel]
+  /// and [scaleFactor] of this ORB are ignored, those of [pyramid] are used instead.
+  (VecKeyPoint, Mat) detectAndComputePyramid(
+    ImagePyramid pyramid, {
+    Mat? mask,
+    VecKeyPoint? keypoints,
+    Mat? descriptors,
+  }) {
+    mask ??= Mat.empty();
+    keypoints ??= VecKeyPoint();
+    descriptors ??= Mat.empty();
+    final levels = pyramid.levels;
+    cvRun(
+      () => cfeatures2d.cv_ORB_detectAndComputePyramid(
+        ref,
+        levels.ref,
+        pyramid.scaleFactor,
+        mask!.ref,
+        descriptors!.ref,
+        keypoints!.ptr,
+        ffi.nullptr,
+      ),
+    );
+    levels.dispose();
+    return (keypoints, descriptors);
+  }
+
   static final finalizer = OcvFinalizer<cvg.ORBPtr>(cfeatures2d.addresses.cv_ORB_close);
 
   void dispose() {
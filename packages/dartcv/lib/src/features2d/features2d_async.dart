@@ -13,6 +13,7 @@ import '../core/mat.dart';
 import '../core/scalar.dart';
 import '../core/vec.dart';
 import '../g/features2d.g.dart' as cfeatures2d;
+import '../imgproc/image_pyramid.dart';
 import './features2d.dart';
 import 'features2d_enum.dart';
 
@@ -324,6 +325,39 @@ extension ORBAsync on ORB {
       },
     );
   }
+
+  /// Detects keypoints and computes descriptors on the levels of a prebuilt [ImagePyramid]
+  /// instead of building ORB's own pyramid, so the pyramid can be shared with other detectors.
+  ///
+  /// [ORB.maxFeatures] is distributed over the levels the same way as ORB, the keypoints are in
+  /// level 0 coordinates and their `octave` is the pyramid level. [ORB.nLevels], [ORB.firstLevel]
+  /// and [ORB.scaleFactor] are ignored, those of [pyramid] are used instead.
+  Future<(VecKeyPoint, Mat)> detectAndComputePyramidAsync(
+    ImagePyramid pyramid, {
+    Mat? mask,
+    VecKeyPoint? keypoints,
+    Mat? descriptors,
+  }) async {
+    mask ??= Mat.empty();
+    keypoints ??= VecKeyPoint();
+    descriptors ??= Mat.empty();
+    final levels = pyramid.levels;
+    return cvRunAsync0(
+      (callback) => cfeatures2d.cv_ORB_detectAndComputePyramid(
+        ref,
+        levels.ref,
+        pyramid.scaleFactor,
+        mask!.ref,
+        descriptors!.ref,
+        keypoints!.ptr,
+        callback,
+      ),
+      (c) {
+        levels.dispose();
+        return c.complete((keypoints!, descriptors!));
+      },
+    );
+  }
 }
 
 extension SimpleBlobDetectorAsync on SimpleBlobDetector {
@@ -39,6 +39,91 @@ external ffi.Pointer<CvStatus> cv_RQDecomp3x3(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<ffi.Pointer<CvStatus> Function(RemapCache, Mat, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_RemapCache_apply(
+  RemapCache self$1,
+  Mat src,
+  Mat dst,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Void Function(RemapCachePtr)>()
+external void cv_RemapCache_close(
+  RemapCachePtr self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ffi.Int, ffi.Int, Scalar, ffi.Pointer<RemapCache>)>()
+external ffi.Pointer<CvStatus> cv_RemapCache_create(
+  int interpolation,
+  int borderMode,
+  Scalar borderValue,
+  ffi.Pointer<RemapCache> rval,
+);
+
+@ffi.Native<ffi.Bool Function(RemapCache)>()
+external bool cv_RemapCache_empty(
+  RemapCache self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(RemapCache, Mat, Mat)>()
+external ffi.Pointer<CvStatus> cv_RemapCache_getMaps(
+  RemapCache self$1,
+  Mat map1,
+  Mat map2,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    RemapCache,
+    Mat,
+    Mat,
+    Mat,
+    Mat,
+    CvSize,
+    ffi.Pointer<ffi.Bool>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_RemapCache_initUndistortRectifyMap(
+  RemapCache self$1,
+  Mat cameraMatrix,
+  Mat distCoeffs,
+  Mat r,
+  Mat newCameraMatrix,
+  CvSize size,
+  ffi.Pointer<ffi.Bool> rval,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(RemapCache, Mat, CvSize, ffi.Bool, ffi.Pointer<ffi.Bool>, imp$1.CvCallback_0)
+>()
+external ffi.Pointer<CvStatus> cv_RemapCache_initWarpAffine(
+  RemapCache self$1,
+  Mat M,
+  CvSize dsize,
+  bool inverseMap,
+  ffi.Pointer<ffi.Bool> rval,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(RemapCache, Mat, CvSize, ffi.Bool, ffi.Pointer<ffi.Bool>, imp$1.CvCallback_0)
+>()
+external ffi.Pointer<CvStatus> cv_RemapCache_initWarpPerspective(
+  RemapCache self$1,
+  Mat M,
+  CvSize dsize,
+  bool inverseMap,
+  ffi.Pointer<ffi.Bool> rval,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Void Function(RemapCache)>()
+external void cv_RemapCache_release(
+  RemapCache self$1,
+);
+
 @ffi.Native<ffi.Pointer<CvStatus> Function(imp$1.MatIn, imp$1.MatOut, imp$1.MatOut, imp$1.CvCallback_0)>()
 external ffi.Pointer<CvStatus> cv_Rodrigues(
   imp$1.MatIn src,
@@ -1825,6 +1910,8 @@ const addresses = _SymbolAddresses();
 
 class _SymbolAddresses {
   const _SymbolAddresses();
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(RemapCachePtr)>> get cv_RemapCache_close =>
+      ffi.Native.addressOf(self.cv_RemapCache_close);
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(StereoBMPtr)>> get cv_StereoBM_close =>
       ffi.Native.addressOf(self.cv_StereoBM_close);
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(StereoSGBMPtr)>> get cv_StereoSGBM_close =>
@@ -1836,6 +1923,12 @@ typedef CvRect = imp$1.CvRect;
 typedef CvSize = imp$1.CvSize;
 typedef CvStatus = imp$1.CvStatus;
 typedef Mat = imp$1.Mat;
+
+final class RemapCache extends ffi.Struct {
+  external ffi.Pointer<ffi.Void> ptr;
+}
+
+typedef RemapCachePtr = ffi.Pointer<RemapCache>;
 typedef Scalar = imp$1.Scalar;
 
 final class StereoBM extends ffi.Struct {
@@ -21,6 +21,223 @@ external void CvStatus_close(
   ffi.Pointer<CvStatus> self$1,
 );
 
+@ffi.Native<ffi.Void Function(DFTPlanPtr)>()
+external void cv_DFTPlan_close(
+  DFTPlanPtr self$1,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(CvSize, ffi.Int, ffi.Int, ffi.Int, ffi.Bool, ffi.Pointer<DFTPlan>)
+>()
+external ffi.Pointer<CvStatus> cv_DFTPlan_create(
+  CvSize size,
+  int type,
+  int flags,
+  int nonzeroRows,
+  bool pad,
+  ffi.Pointer<DFTPlan> rval,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(DFTPlan, Mat, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_DFTPlan_execute(
+  DFTPlan self$1,
+  Mat src,
+  Mat dst,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(DFTPlan, VecMat, ffi.Pointer<VecMat>, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_DFTPlan_executeBatch(
+  DFTPlan self$1,
+  VecMat src,
+  ffi.Pointer<VecMat> dst,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Int Function(DFTPlan)>()
+external int cv_DFTPlan_getDstType(
+  DFTPlan self$1,
+);
+
+@ffi.Native<ffi.Int Function(DFTPlan)>()
+external int cv_DFTPlan_getFlags(
+  DFTPlan self$1,
+);
+
+@ffi.Native<CvSize Function(DFTPlan)>()
+external CvSize cv_DFTPlan_getSize(
+  DFTPlan self$1,
+);
+
+@ffi.Native<ffi.Int Function(DFTPlan)>()
+external int cv_DFTPlan_getType(
+  DFTPlan self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ElemExpr, ffi.Int, ffi.Pointer<ffi.Int>)>()
+external ffi.Pointer<CvStatus> cv_ElemExpr_abs(
+  ElemExpr self$1,
+  int a,
+  ffi.Pointer<ffi.Int> rval,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ElemExpr, ffi.Int, ffi.Int, ffi.Int, ffi.Pointer<ffi.Int>)>()
+external ffi.Pointer<CvStatus> cv_ElemExpr_binary(
+  ElemExpr self$1,
+  int op,
+  int a,
+  int b,
+  ffi.Pointer<ffi.Int> rval,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ElemExpr, ffi.Int, ffi.Int, ffi.Pointer<ffi.Int>)>()
+external ffi.Pointer<CvStatus> cv_ElemExpr_cast(
+  ElemExpr self$1,
+  int a,
+  int depth,
+  ffi.Pointer<ffi.Int> rval,
+);
+
+@ffi.Native<ffi.Void Function(ElemExpr)>()
+external void cv_ElemExpr_clear(
+  ElemExpr self$1,
+);
+
+@ffi.Native<ffi.Void Function(ElemExprPtr)>()
+external void cv_ElemExpr_close(
+  ElemExprPtr self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ElemExpr, ffi.Int, ffi.Int, ffi.Int, ffi.Pointer<ffi.Int>)>()
+external ffi.Pointer<CvStatus> cv_ElemExpr_compare(
+  ElemExpr self$1,
+  int cmpop,
+  int a,
+  int b,
+  ffi.Pointer<ffi.Int> rval,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ElemExpr, Scalar, ffi.Pointer<ffi.Int>)>()
+external ffi.Pointer<CvStatus> cv_ElemExpr_constant(
+  ElemExpr self$1,
+  Scalar value,
+  ffi.Pointer<ffi.Int> rval,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ffi.Pointer<ElemExpr>)>()
+external ffi.Pointer<CvStatus> cv_ElemExpr_create(
+  ffi.Pointer<ElemExpr> rval,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ElemExpr, ffi.Int, ffi.Int, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_ElemExpr_evaluate(
+  ElemExpr self$1,
+  int root,
+  int dtype,
+  Mat dst,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ElemExpr, Mat, ffi.Pointer<ffi.Int>)>()
+external ffi.Pointer<CvStatus> cv_ElemExpr_input(
+  ElemExpr self$1,
+  Mat m,
+  ffi.Pointer<ffi.Int> rval,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ElemExpr, ffi.Int, Mat)>()
+external ffi.Pointer<CvStatus> cv_ElemExpr_setInput(
+  ElemExpr self$1,
+  int node,
+  Mat m,
+);
+
+@ffi.Native<ffi.Int Function(ElemExpr)>()
+external int cv_ElemExpr_size(
+  ElemExpr self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IncrementalPCA, Mat, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_IncrementalPCA_backProject(
+  IncrementalPCA self$1,
+  Mat data,
+  Mat result,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Void Function(IncrementalPCAPtr)>()
+external void cv_IncrementalPCA_close(
+  IncrementalPCAPtr self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ffi.Int, ffi.Pointer<IncrementalPCA>)>()
+external ffi.Pointer<CvStatus> cv_IncrementalPCA_create(
+  int maxComponents,
+  ffi.Pointer<IncrementalPCA> rval,
+);
+
+@ffi.Native<ffi.Int Function(IncrementalPCA)>()
+external int cv_IncrementalPCA_getDims(
+  IncrementalPCA self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IncrementalPCA, Mat)>()
+external ffi.Pointer<CvStatus> cv_IncrementalPCA_getEigenvalues(
+  IncrementalPCA self$1,
+  Mat rval,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IncrementalPCA, Mat)>()
+external ffi.Pointer<CvStatus> cv_IncrementalPCA_getEigenvectors(
+  IncrementalPCA self$1,
+  Mat rval,
+);
+
+@ffi.Native<ffi.Int Function(IncrementalPCA)>()
+external int cv_IncrementalPCA_getMaxComponents(
+  IncrementalPCA self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IncrementalPCA, Mat)>()
+external ffi.Pointer<CvStatus> cv_IncrementalPCA_getMean(
+  IncrementalPCA self$1,
+  Mat rval,
+);
+
+@ffi.Native<ffi.Int64 Function(IncrementalPCA)>()
+external int cv_IncrementalPCA_getNumSamples(
+  IncrementalPCA self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IncrementalPCA, ffi.Pointer<ffi.Char>, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_IncrementalPCA_load(
+  IncrementalPCA self$1,
+  ffi.Pointer<ffi.Char> filename,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IncrementalPCA, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_IncrementalPCA_partialFit(
+  IncrementalPCA self$1,
+  Mat batch,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IncrementalPCA, Mat, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_IncrementalPCA_project(
+  IncrementalPCA self$1,
+  Mat data,
+  Mat result,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IncrementalPCA, ffi.Pointer<ffi.Char>, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_IncrementalPCA_save(
+  IncrementalPCA self$1,
+  ffi.Pointer<ffi.Char> filename,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<ffi.Pointer<CvStatus> Function(Mat, Mat, Mat, imp$1.CvCallback_0)>()
 external ffi.Pointer<CvStatus> cv_LUT(
   Mat src,
@@ -1490,6 +1707,89 @@ external ffi.Pointer<CvStatus> cv_Mat_zeros(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<ffi.Void Function(MiniBatchKMeansPtr)>()
+external void cv_MiniBatchKMeans_close(
+  MiniBatchKMeansPtr self$1,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    ffi.Int,
+    ffi.Int,
+    TermCriteria,
+    ffi.Int,
+    ffi.Uint64,
+    ffi.Pointer<MiniBatchKMeans>,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_MiniBatchKMeans_create(
+  int k,
+  int batchSize,
+  TermCriteria criteria,
+  int seedSamples,
+  int seed,
+  ffi.Pointer<MiniBatchKMeans> rval,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    MiniBatchKMeans,
+    Mat,
+    ffi.Bool,
+    Mat,
+    Mat,
+    ffi.Pointer<ffi.Double>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_MiniBatchKMeans_fit(
+  MiniBatchKMeans self$1,
+  Mat data,
+  bool warmStart,
+  Mat labels,
+  Mat centers,
+  ffi.Pointer<ffi.Double> rval,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Int Function(MiniBatchKMeans)>()
+external int cv_MiniBatchKMeans_getBatchSize(
+  MiniBatchKMeans self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(MiniBatchKMeans, Mat)>()
+external ffi.Pointer<CvStatus> cv_MiniBatchKMeans_getCenters(
+  MiniBatchKMeans self$1,
+  Mat centers,
+);
+
+@ffi.Native<ffi.Int Function(MiniBatchKMeans)>()
+external int cv_MiniBatchKMeans_getIterations(
+  MiniBatchKMeans self$1,
+);
+
+@ffi.Native<ffi.Int Function(MiniBatchKMeans)>()
+external int cv_MiniBatchKMeans_getK(
+  MiniBatchKMeans self$1,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(MiniBatchKMeans, Mat, Mat, ffi.Pointer<ffi.Double>, imp$1.CvCallback_0)
+>()
+external ffi.Pointer<CvStatus> cv_MiniBatchKMeans_predict(
+  MiniBatchKMeans self$1,
+  Mat data,
+  Mat labels,
+  ffi.Pointer<ffi.Double> rval,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(MiniBatchKMeans, Mat)>()
+external ffi.Pointer<CvStatus> cv_MiniBatchKMeans_setCenters(
+  MiniBatchKMeans self$1,
+  Mat centers,
+);
+
 @ffi.Native<ffi.Pointer<CvStatus> Function(Mat, Mat, Mat, Mat, imp$1.CvCallback_0)>()
 external ffi.Pointer<CvStatus> cv_PCABackProject(
   Mat data,
@@ -1539,6 +1839,56 @@ external ffi.Pointer<CvStatus> cv_PSNR(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<ffi.Void Function(RNGStreamPtr)>()
+external void cv_RNGStream_close(
+  RNGStreamPtr self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ffi.Uint64, ffi.Uint64, ffi.Pointer<RNGStream>)>()
+external ffi.Pointer<CvStatus> cv_RNGStream_create(
+  int seed,
+  int stream,
+  ffi.Pointer<RNGStream> rval,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(RNGStream, Mat, ffi.Int, Scalar, Scalar, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_RNGStream_fill(
+  RNGStream self$1,
+  Mat mat,
+  int distType,
+  Scalar a,
+  Scalar b,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Uint64 Function(RNGStream)>()
+external int cv_RNGStream_getPosition(
+  RNGStream self$1,
+);
+
+@ffi.Native<ffi.Uint64 Function(RNGStream)>()
+external int cv_RNGStream_getSeed(
+  RNGStream self$1,
+);
+
+@ffi.Native<ffi.Uint64 Function(RNGStream)>()
+external int cv_RNGStream_getStream(
+  RNGStream self$1,
+);
+
+@ffi.Native<ffi.Void Function(RNGStream, ffi.Uint64)>()
+external void cv_RNGStream_setPosition(
+  RNGStream self$1,
+  int position,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(RNGStream, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_RNGStream_shuffle(
+  RNGStream self$1,
+  Mat mat,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<ffi.Void Function(imp$1.RNGPtr)>()
 external void cv_RNG_close(
   imp$1.RNGPtr rng,
@@ -1655,6 +2005,16 @@ external ffi.Pointer<CvStatus> cv_SVDecomp(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<ffi.Pointer<CvStatus> Function(Mat, Mat, Mat, Mat, ffi.Int, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_SVDecompBatched(
+  Mat src,
+  Mat w,
+  Mat u,
+  Mat vt,
+  int flags,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<ffi.Void Function(UMat)>()
 external void cv_UMat_addref(
   UMat self$1,
@@ -2452,6 +2812,20 @@ external ffi.Pointer<CvStatus> cv_gemm(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(Mat, Mat, ffi.Double, Mat, ffi.Double, Mat, ffi.Int, imp$1.CvCallback_0)
+>()
+external ffi.Pointer<CvStatus> cv_gemmBatched(
+  Mat src1,
+  Mat src2,
+  double alpha,
+  Mat src3,
+  double beta,
+  Mat dst,
+  int flags,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<ffi.Int Function()>()
 external int cv_getNumThreads();
 
@@ -2499,6 +2873,33 @@ external ffi.Pointer<CvStatus> cv_idft(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    Mat,
+    Mat,
+    ffi.Int,
+    CvSize,
+    ffi.Int,
+    ffi.Double,
+    ffi.Double,
+    Mat,
+    Mat,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_imageStats(
+  Mat src,
+  Mat mask,
+  int flags,
+  CvSize grid,
+  int histBins,
+  double histMin,
+  double histMax,
+  Mat stats,
+  Mat hist,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<ffi.Pointer<CvStatus> Function(Mat, Mat, Mat, Mat, imp$1.CvCallback_0)>()
 external ffi.Pointer<CvStatus> cv_inRange(
   Mat src,
@@ -2534,6 +2935,15 @@ external ffi.Pointer<CvStatus> cv_invert(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<ffi.Pointer<CvStatus> Function(Mat, Mat, Mat, ffi.Int, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_invertBatched(
+  Mat src,
+  Mat dst,
+  Mat status,
+  int flags,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<
   ffi.Pointer<CvStatus> Function(
     Mat,
@@ -2584,6 +2994,24 @@ external ffi.Pointer<CvStatus> cv_kmeans_points(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<ffi.Pointer<CvStatus> Function(ffi.Pointer<ffi.Char>, ffi.Bool, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_loadMat(
+  ffi.Pointer<ffi.Char> filename,
+  bool mmap,
+  Mat rval,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(ffi.Pointer<ffi.Char>, ffi.Bool, ffi.Pointer<VecMat>, imp$1.CvCallback_0)
+>()
+external ffi.Pointer<CvStatus> cv_loadMats(
+  ffi.Pointer<ffi.Char> filename,
+  bool mmap,
+  ffi.Pointer<VecMat> rval,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<ffi.Pointer<CvStatus> Function(Mat, Mat, imp$1.CvCallback_0)>()
 external ffi.Pointer<CvStatus> cv_log(
   Mat src,
@@ -2932,6 +3360,20 @@ external ffi.Pointer<CvStatus> cv_rowRange(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<ffi.Pointer<CvStatus> Function(ffi.Pointer<ffi.Char>, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_saveMat(
+  ffi.Pointer<ffi.Char> filename,
+  Mat mat,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ffi.Pointer<ffi.Char>, VecMat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_saveMats(
+  ffi.Pointer<ffi.Char> filename,
+  VecMat mats,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<ffi.Pointer<CvStatus> Function(Mat, ffi.Double, Mat, Mat, imp$1.CvCallback_0)>()
 external ffi.Pointer<CvStatus> cv_scaleAdd(
   Mat src1,
@@ -2970,6 +3412,16 @@ external ffi.Pointer<CvStatus> cv_solve(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<ffi.Pointer<CvStatus> Function(Mat, Mat, Mat, Mat, ffi.Int, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_solveBatched(
+  Mat src1,
+  Mat src2,
+  Mat dst,
+  Mat status,
+  int flags,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<ffi.Pointer<CvStatus> Function(Mat, Mat, ffi.Pointer<ffi.Int>, imp$1.CvCallback_0)>()
 external ffi.Pointer<CvStatus> cv_solveCubic(
   Mat coeffs,
@@ -3039,6 +3491,16 @@ external ffi.Pointer<CvStatus> cv_theRNG(
   imp$1.RNGPtr rval,
 );
 
+@ffi.Native<ffi.Pointer<CvStatus> Function(Mat, ffi.Int, Mat, Mat, ffi.Int, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_topK(
+  Mat src,
+  int k,
+  Mat values,
+  Mat indices,
+  int flags,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<ffi.Pointer<CvStatus> Function(Mat, ffi.Pointer<Scalar>, imp$1.CvCallback_0)>()
 external ffi.Pointer<CvStatus> cv_trace(
   Mat src,
@@ -3362,6 +3824,12 @@ external ffi.Pointer<VecF16> std_VecF16_new_2(
   ffi.Pointer<ffi.Uint16> val_ptr,
 );
 
+@ffi.Native<ffi.Pointer<VecF16> Function(ffi.Size, ffi.Pointer<float_t>)>()
+external ffi.Pointer<VecF16> std_VecF16_new_f32(
+  int length,
+  ffi.Pointer<float_t> val_ptr,
+);
+
 @ffi.Native<ffi.Void Function(ffi.Pointer<VecF16>, ffi.Uint16)>()
 external void std_VecF16_push_back(
   ffi.Pointer<VecF16> self$1,
@@ -3392,6 +3860,12 @@ external void std_VecF16_shrink_to_fit(
   ffi.Pointer<VecF16> self$1,
 );
 
+@ffi.Native<ffi.Void Function(ffi.Pointer<VecF16>, ffi.Pointer<float_t>)>()
+external void std_VecF16_to_f32(
+  ffi.Pointer<VecF16> self$1,
+  ffi.Pointer<float_t> dst,
+);
+
 @ffi.Native<ffi.Void Function(ffi.Pointer<VecF32>)>()
 external void std_VecF32_clear(
   ffi.Pointer<VecF32> self$1,
@@ -5945,10 +6419,20 @@ class _SymbolAddresses {
   const _SymbolAddresses();
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvStatus>)>> get CvStatus_close =>
       ffi.Native.addressOf(self.CvStatus_close);
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(DFTPlanPtr)>> get cv_DFTPlan_close =>
+      ffi.Native.addressOf(self.cv_DFTPlan_close);
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ElemExprPtr)>> get cv_ElemExpr_close =>
+      ffi.Native.addressOf(self.cv_ElemExpr_close);
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(IncrementalPCAPtr)>> get cv_IncrementalPCA_close =>
+      ffi.Native.addressOf(self.cv_IncrementalPCA_close);
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(imp$1.MatPtr)>> get cv_Mat_close =>
       ffi.Native.addressOf(self.cv_Mat_close);
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Void>)>> get cv_Mat_closeVoid =>
       ffi.Native.addressOf(self.cv_Mat_closeVoid);
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(MiniBatchKMeansPtr)>> get cv_MiniBatchKMeans_close =>
+      ffi.Native.addressOf(self.cv_MiniBatchKMeans_close);
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(RNGStreamPtr)>> get cv_RNGStream_close =>
+      ffi.Native.addressOf(self.cv_RNGStream_close);
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(imp$1.RNGPtr)>> get cv_RNG_close =>
       ffi.Native.addressOf(self.cv_RNG_close);
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(imp$1.UMatPtr)>> get cv_UMat_close =>
@@ -6027,7 +6511,19 @@ typedef CvRect = imp$1.CvRect;
 typedef CvRect2f = imp$1.CvRect2f;
 typedef CvSize = imp$1.CvSize;
 typedef CvStatus = imp$1.CvStatus;
+
+final class DFTPlan extends ffi.Struct {
+  external ffi.Pointer<ffi.Void> ptr;
+}
+
+typedef DFTPlanPtr = ffi.Pointer<DFTPlan>;
 typedef DMatch = imp$1.DMatch;
+
+final class ElemExpr extends ffi.Struct {
+  external ffi.Pointer<ffi.Void> ptr;
+}
+
+typedef ElemExprPtr = ffi.Pointer<ElemExpr>;
 typedef ErrorCallback = ffi.Pointer<ffi.NativeFunction<ErrorCallbackFunction>>;
 typedef ErrorCallbackFunction =
     ffi.Void Function(
@@ -6047,6 +6543,12 @@ typedef DartErrorCallbackFunction =
       int line,
       ffi.Pointer<ffi.Void> userdata,
     );
+
+final class IncrementalPCA extends ffi.Struct {
+  external ffi.Pointer<ffi.Void> ptr;
+}
+
+typedef IncrementalPCAPtr = ffi.Pointer<IncrementalPCA>;
 typedef KeyPoint = imp$1.KeyPoint;
 typedef LogCallback = ffi.Pointer<ffi.NativeFunction<LogCallbackFunction>>;
 typedef LogCallbackEx = ffi.Pointer<ffi.NativeFunction<LogCallbackExFunction>>;
@@ -6081,7 +6583,19 @@ typedef LogCallbackFunction =
 typedef DartLogCallbackFunction = void Function(int logLevel, ffi.Pointer<ffi.Char> message, int msgLen);
 typedef Mat = imp$1.Mat;
 typedef MatStep = imp$1.MatStep;
+
+final class MiniBatchKMeans extends ffi.Struct {
+  external ffi.Pointer<ffi.Void> ptr;
+}
+
+typedef MiniBatchKMeansPtr = ffi.Pointer<MiniBatchKMeans>;
 typedef RNG = imp$1.RNG;
+
+final class RNGStream extends ffi.Struct {
+  external ffi.Pointer<ffi.Void> ptr;
+}
+
+typedef RNGStreamPtr = ffi.Pointer<RNGStream>;
 typedef RotatedRect = imp$1.RotatedRect;
 typedef Scalar = imp$1.Scalar;
 typedef TermCriteria = imp$1.TermCriteria;
@@ -1100,6 +1100,27 @@ external ffi.Pointer<CvStatus> cv_ORB_detectAndCompute(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    ORB,
+    VecMat,
+    ffi.Double,
+    Mat,
+    Mat,
+    ffi.Pointer<VecKeyPoint>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_ORB_detectAndComputePyramid(
+  ORB self$1,
+  VecMat pyramid,
+  double scaleFactor,
+  Mat mask,
+  Mat desc,
+  ffi.Pointer<VecKeyPoint> out_keypoints,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<ffi.Bool Function(ORB)>()
 external bool cv_ORB_empty(
   ORB self$1,
@@ -1867,6 +1888,7 @@ typedef VecF32 = imp$1.VecF32;
 typedef VecF64 = imp$1.VecF64;
 typedef VecI32 = imp$1.VecI32;
 typedef VecKeyPoint = imp$1.VecKeyPoint;
+typedef VecMat = imp$1.VecMat;
 typedef VecRect = imp$1.VecRect;
 typedef VecVecChar = imp$1.VecVecChar;
 typedef VecVecDMatch = imp$1.VecVecDMatch;
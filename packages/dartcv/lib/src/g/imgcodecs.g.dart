@@ -14,6 +14,88 @@ library;
 
 import 'dart:ffi' as ffi;
 import 'package:dartcv4/src/g/types.g.dart' as imp$1;
+import '' as self;
+
+@ffi.Native<ffi.Void Function(ImageEncoderPtr)>()
+external void cv_ImageEncoder_close(
+  ImageEncoderPtr self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ffi.Pointer<ffi.Char>, VecI32, ffi.Pointer<ImageEncoder>)>()
+external ffi.Pointer<CvStatus> cv_ImageEncoder_create(
+  ffi.Pointer<ffi.Char> ext,
+  VecI32 params,
+  ffi.Pointer<ImageEncoder> rval,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    ImageEncoder,
+    Mat,
+    ffi.Pointer<ffi.Bool>,
+    ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+    ffi.Pointer<ffi.Size>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_ImageEncoder_encode(
+  ImageEncoder self$1,
+  Mat img,
+  ffi.Pointer<ffi.Bool> success,
+  ffi.Pointer<ffi.Pointer<ffi.Uint8>> data,
+  ffi.Pointer<ffi.Size> size,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    ImageEncoder,
+    VecMat,
+    ffi.Int,
+    ffi.Pointer<VecVecChar>,
+    ffi.Pointer<VecI32>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_ImageEncoder_encodeBatch(
+  ImageEncoder self$1,
+  VecMat imgs,
+  int numThreads,
+  ffi.Pointer<VecVecChar> rval,
+  ffi.Pointer<VecI32> status,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    ImageEncoder,
+    Mat,
+    ffi.Pointer<ffi.Uint8>,
+    ffi.Size,
+    ffi.Pointer<ffi.Bool>,
+    ffi.Pointer<ffi.Size>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_ImageEncoder_encodeTo(
+  ImageEncoder self$1,
+  Mat img,
+  ffi.Pointer<ffi.Uint8> dst,
+  int capacity,
+  ffi.Pointer<ffi.Bool> success,
+  ffi.Pointer<ffi.Size> size,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Size Function(ImageEncoder)>()
+external int cv_ImageEncoder_getCapacity(
+  ImageEncoder self$1,
+);
+
+@ffi.Native<ffi.Pointer<ffi.Char> Function(ImageEncoder)>()
+external ffi.Pointer<ffi.Char> cv_ImageEncoder_getExt(
+  ImageEncoder self$1,
+);
 
 @ffi.Native<ffi.Bool Function(ffi.Pointer<ffi.Char>)>()
 external bool cv_haveImageReader(
@@ -39,6 +121,61 @@ external ffi.Pointer<CvStatus> cv_imdecode(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    VecVecChar,
+    ffi.Int,
+    CvSize,
+    ffi.Int,
+    ffi.Int,
+    ffi.Pointer<VecMat>,
+    ffi.Pointer<VecI32>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_imdecodeBatch(
+  VecVecChar bufs,
+  int flags,
+  CvSize dsize,
+  int interpolation,
+  int numThreads,
+  ffi.Pointer<VecMat> rval,
+  ffi.Pointer<VecI32> status,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(ffi.Pointer<ffi.Uint8>, ffi.Size, ffi.Int, Mat, imp$1.CvCallback_0)
+>()
+external ffi.Pointer<CvStatus> cv_imdecode_1(
+  ffi.Pointer<ffi.Uint8> buf,
+  int size,
+  int flags,
+  Mat dst,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    ffi.Pointer<ffi.Uint8>,
+    ffi.Size,
+    ffi.Int,
+    CvRect,
+    ffi.Int,
+    Mat,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_imdecode_2(
+  ffi.Pointer<ffi.Uint8> buf,
+  int size,
+  int flags,
+  CvRect roi,
+  int reduce,
+  Mat dst,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<
   ffi.Pointer<CvStatus> Function(
     ffi.Pointer<ffi.Char>,
@@ -56,6 +193,31 @@ external ffi.Pointer<CvStatus> cv_imencode(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    ffi.Pointer<ffi.Char>,
+    VecMat,
+    VecI32,
+    CvSize,
+    ffi.Int,
+    ffi.Int,
+    ffi.Pointer<VecVecChar>,
+    ffi.Pointer<VecI32>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_imencodeBatch(
+  ffi.Pointer<ffi.Char> ext,
+  VecMat imgs,
+  VecI32 params,
+  CvSize dsize,
+  int interpolation,
+  int numThreads,
+  ffi.Pointer<VecVecChar> rval,
+  ffi.Pointer<VecI32> status,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<
   ffi.Pointer<CvStatus> Function(
     ffi.Pointer<ffi.Char>,
@@ -75,6 +237,38 @@ external ffi.Pointer<CvStatus> cv_imencode_1(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    ffi.Pointer<ffi.Char>,
+    ffi.Pointer<ffi.Bool>,
+    ffi.Pointer<CvImageHeader>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_improbe(
+  ffi.Pointer<ffi.Char> filename,
+  ffi.Pointer<ffi.Bool> success,
+  ffi.Pointer<CvImageHeader> rval,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    ffi.Pointer<ffi.Uint8>,
+    ffi.Size,
+    ffi.Pointer<ffi.Bool>,
+    ffi.Pointer<CvImageHeader>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_improbe_1(
+  ffi.Pointer<ffi.Uint8> buf,
+  int size,
+  ffi.Pointer<ffi.Bool> success,
+  ffi.Pointer<CvImageHeader> rval,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<
   ffi.Pointer<CvStatus> Function(ffi.Pointer<ffi.Char>, ffi.Int, ffi.Pointer<Mat>, imp$1.CvCallback_0)
 >()
@@ -85,6 +279,41 @@ external ffi.Pointer<CvStatus> cv_imread(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    VecVecChar,
+    ffi.Int,
+    CvSize,
+    ffi.Int,
+    ffi.Int,
+    ffi.Pointer<VecMat>,
+    ffi.Pointer<VecI32>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_imreadBatch(
+  VecVecChar filenames,
+  int flags,
+  CvSize dsize,
+  int interpolation,
+  int numThreads,
+  ffi.Pointer<VecMat> rval,
+  ffi.Pointer<VecI32> status,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(ffi.Pointer<ffi.Char>, ffi.Int, CvRect, ffi.Int, Mat, imp$1.CvCallback_0)
+>()
+external ffi.Pointer<CvStatus> cv_imread_1(
+  ffi.Pointer<ffi.Char> filename,
+  int flags,
+  CvRect roi,
+  int reduce,
+  Mat dst,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<
   ffi.Pointer<CvStatus> Function(ffi.Pointer<ffi.Char>, Mat, ffi.Pointer<ffi.Bool>, imp$1.CvCallback_0)
 >()
@@ -112,7 +341,45 @@ external ffi.Pointer<CvStatus> cv_imwrite_1(
   imp$1.CvCallback_0 callback,
 );
 
+const addresses = _SymbolAddresses();
+
+class _SymbolAddresses {
+  const _SymbolAddresses();
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ImageEncoderPtr)>> get cv_ImageEncoder_close =>
+      ffi.Native.addressOf(self.cv_ImageEncoder_close);
+}
+
+final class CvImageHeader extends ffi.Struct {
+  @ffi.Int()
+  external int width;
+
+  @ffi.Int()
+  external int height;
+
+  @ffi.Int()
+  external int channels;
+
+  @ffi.Int()
+  external int depth;
+
+  @ffi.Int()
+  external int orientation;
+
+  @ffi.Int()
+  external int pages;
+}
+
+typedef CvRect = imp$1.CvRect;
+typedef CvSize = imp$1.CvSize;
 typedef CvStatus = imp$1.CvStatus;
+
+final class ImageEncoder extends ffi.Struct {
+  external ffi.Pointer<ffi.Void> ptr;
+}
+
+typedef ImageEncoderPtr = ffi.Pointer<ImageEncoder>;
 typedef Mat = imp$1.Mat;
 typedef VecI32 = imp$1.VecI32;
+typedef VecMat = imp$1.VecMat;
 typedef VecUChar = imp$1.VecUChar;
+typedef VecVecChar = imp$1.VecVecChar;
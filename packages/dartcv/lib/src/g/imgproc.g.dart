@@ -69,6 +69,60 @@ external void cv_CLAHE_setTilesGridSize(
   CvSize size,
 );
 
+@ffi.Native<ffi.Void Function(ComponentLabelerPtr)>()
+external void cv_ComponentLabeler_close(
+  ComponentLabelerPtr self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ffi.Int, ffi.Int, ffi.Pointer<ComponentLabeler>)>()
+external ffi.Pointer<CvStatus> cv_ComponentLabeler_create(
+  int connectivity,
+  int minArea,
+  ffi.Pointer<ComponentLabeler> rval,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ComponentLabeler, Mat, ffi.Pointer<ffi.Int>, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_ComponentLabeler_finish(
+  ComponentLabeler self$1,
+  Mat stats,
+  ffi.Pointer<ffi.Int> rval,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Int Function(ComponentLabeler)>()
+external int cv_ComponentLabeler_getConnectivity(
+  ComponentLabeler self$1,
+);
+
+@ffi.Native<ffi.Int Function(ComponentLabeler)>()
+external int cv_ComponentLabeler_getMinArea(
+  ComponentLabeler self$1,
+);
+
+@ffi.Native<ffi.Int Function(ComponentLabeler)>()
+external int cv_ComponentLabeler_getRows(
+  ComponentLabeler self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ComponentLabeler, Mat, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_ComponentLabeler_push(
+  ComponentLabeler self$1,
+  Mat strip,
+  Mat intensity,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Void Function(ComponentLabeler)>()
+external void cv_ComponentLabeler_reset(
+  ComponentLabeler self$1,
+);
+
+@ffi.Native<ffi.Void Function(ComponentLabeler, ffi.Int)>()
+external void cv_ComponentLabeler_setMinArea(
+  ComponentLabeler self$1,
+  int minArea,
+);
+
 @ffi.Native<
   ffi.Pointer<CvStatus> Function(Mat, Mat, CvSize, ffi.Double, ffi.Double, ffi.Int, imp$1.CvCallback_0)
 >()
@@ -208,6 +262,154 @@ external ffi.Pointer<CvStatus> cv_HoughLinesPointSet(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<ffi.Pointer<CvStatus> Function(ImagePyramid, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_ImagePyramid_build(
+  ImagePyramid self$1,
+  Mat src,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Void Function(ImagePyramidPtr)>()
+external void cv_ImagePyramid_close(
+  ImagePyramidPtr self$1,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(ffi.Int, ffi.Double, ffi.Int, ffi.Int, ffi.Pointer<ImagePyramid>)
+>()
+external ffi.Pointer<CvStatus> cv_ImagePyramid_create(
+  int levels,
+  double scaleFactor,
+  int padding,
+  int borderType,
+  ffi.Pointer<ImagePyramid> rval,
+);
+
+@ffi.Native<ffi.Bool Function(ImagePyramid)>()
+external bool cv_ImagePyramid_empty(
+  ImagePyramid self$1,
+);
+
+@ffi.Native<ffi.Int Function(ImagePyramid)>()
+external int cv_ImagePyramid_getBorderType(
+  ImagePyramid self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ImagePyramid, ffi.Int, Mat)>()
+external ffi.Pointer<CvStatus> cv_ImagePyramid_getLevel(
+  ImagePyramid self$1,
+  int level,
+  Mat rval,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ImagePyramid, ffi.Pointer<VecMat>)>()
+external ffi.Pointer<CvStatus> cv_ImagePyramid_getLevels(
+  ImagePyramid self$1,
+  ffi.Pointer<VecMat> rval,
+);
+
+@ffi.Native<ffi.Int Function(ImagePyramid)>()
+external int cv_ImagePyramid_getNumLevels(
+  ImagePyramid self$1,
+);
+
+@ffi.Native<ffi.Int Function(ImagePyramid)>()
+external int cv_ImagePyramid_getPadding(
+  ImagePyramid self$1,
+);
+
+@ffi.Native<ffi.Double Function(ImagePyramid)>()
+external double cv_ImagePyramid_getScaleFactor(
+  ImagePyramid self$1,
+);
+
+@ffi.Native<ffi.Int Function(IntegralImage)>()
+external int cv_IntegralImage_channels(
+  IntegralImage self$1,
+);
+
+@ffi.Native<ffi.Void Function(IntegralImagePtr)>()
+external void cv_IntegralImage_close(
+  IntegralImagePtr self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IntegralImage, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_IntegralImage_compute(
+  IntegralImage self$1,
+  Mat src,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ffi.Bool, ffi.Pointer<IntegralImage>)>()
+external ffi.Pointer<CvStatus> cv_IntegralImage_create(
+  bool tilted,
+  ffi.Pointer<IntegralImage> rval,
+);
+
+@ffi.Native<ffi.Bool Function(IntegralImage)>()
+external bool cv_IntegralImage_empty(
+  IntegralImage self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IntegralImage, Mat)>()
+external ffi.Pointer<CvStatus> cv_IntegralImage_getSqsum(
+  IntegralImage self$1,
+  Mat rval,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IntegralImage, Mat)>()
+external ffi.Pointer<CvStatus> cv_IntegralImage_getSum(
+  IntegralImage self$1,
+  Mat rval,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IntegralImage, Mat)>()
+external ffi.Pointer<CvStatus> cv_IntegralImage_getTilted(
+  IntegralImage self$1,
+  Mat rval,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IntegralImage, VecRect, ffi.Pointer<VecF64>, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_IntegralImage_mean(
+  IntegralImage self$1,
+  VecRect rects,
+  ffi.Pointer<VecF64> rval,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IntegralImage, VecRect, ffi.Pointer<VecF64>, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_IntegralImage_sum(
+  IntegralImage self$1,
+  VecRect rects,
+  ffi.Pointer<VecF64> rval,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IntegralImage, VecRect, ffi.Pointer<VecF64>, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_IntegralImage_tiltedSum(
+  IntegralImage self$1,
+  VecRect rects,
+  ffi.Pointer<VecF64> rval,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IntegralImage, VecRect, ffi.Pointer<VecF64>, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_IntegralImage_variance(
+  IntegralImage self$1,
+  VecRect rects,
+  ffi.Pointer<VecF64> rval,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(IntegralImage, CvSize, ffi.Int, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_IntegralImage_windows(
+  IntegralImage self$1,
+  CvSize ksize,
+  int op,
+  Mat dst,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<
   ffi.Pointer<CvStatus> Function(
     Mat,
@@ -341,6 +543,79 @@ external ffi.Pointer<CvStatus> cv_Scharr(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<ffi.Void Function(SlidingHistogramPtr)>()
+external void cv_SlidingHistogram_close(
+  SlidingHistogramPtr self$1,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(SlidingHistogram, Mat, ffi.Int, ffi.Pointer<VecF64>, imp$1.CvCallback_0)
+>()
+external ffi.Pointer<CvStatus> cv_SlidingHistogram_compare(
+  SlidingHistogram self$1,
+  Mat reference,
+  int method,
+  ffi.Pointer<VecF64> rval,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    VecI32,
+    VecI32,
+    VecF32,
+    ffi.Int,
+    ffi.Int,
+    ffi.Int,
+    ffi.Pointer<SlidingHistogram>,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_SlidingHistogram_create(
+  VecI32 channels,
+  VecI32 histSize,
+  VecF32 ranges,
+  int window,
+  int gridCols,
+  int gridRows,
+  ffi.Pointer<SlidingHistogram> rval,
+);
+
+@ffi.Native<ffi.Int Function(SlidingHistogram)>()
+external int cv_SlidingHistogram_getCount(
+  SlidingHistogram self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(SlidingHistogram, ffi.Int, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_SlidingHistogram_getHist(
+  SlidingHistogram self$1,
+  int cell,
+  Mat dst,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Int Function(SlidingHistogram)>()
+external int cv_SlidingHistogram_getNumCells(
+  SlidingHistogram self$1,
+);
+
+@ffi.Native<ffi.Int Function(SlidingHistogram)>()
+external int cv_SlidingHistogram_getWindow(
+  SlidingHistogram self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(SlidingHistogram, Mat, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_SlidingHistogram_push(
+  SlidingHistogram self$1,
+  Mat frame,
+  Mat mask,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Void Function(SlidingHistogram)>()
+external void cv_SlidingHistogram_reset(
+  SlidingHistogram self$1,
+);
+
 @ffi.Native<
   ffi.Pointer<CvStatus> Function(
     Mat,
@@ -468,6 +743,13 @@ external ffi.Pointer<CvStatus> cv_Subdiv2D_getLeadingEdgeList(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<ffi.Pointer<CvStatus> Function(Subdiv2D, ffi.Pointer<VecI32>, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_Subdiv2D_getTriangleIndices(
+  Subdiv2D self$1,
+  ffi.Pointer<VecI32> rval,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<
   ffi.Pointer<CvStatus> Function(
     Subdiv2D,
@@ -517,6 +799,25 @@ external ffi.Pointer<CvStatus> cv_Subdiv2D_getVoronoiFacetList(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    Subdiv2D,
+    VecI32,
+    ffi.Pointer<VecF32>,
+    ffi.Pointer<VecI32>,
+    ffi.Pointer<VecF32>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_Subdiv2D_getVoronoiFacetListFlat(
+  Subdiv2D self$1,
+  VecI32 idx,
+  ffi.Pointer<VecF32> facets,
+  ffi.Pointer<VecI32> offsets,
+  ffi.Pointer<VecF32> centers,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<ffi.Pointer<CvStatus> Function(Subdiv2D, CvRect, imp$1.CvCallback_0)>()
 external ffi.Pointer<CvStatus> cv_Subdiv2D_initDelaunay(
   Subdiv2D self$1,
@@ -532,6 +833,14 @@ external ffi.Pointer<CvStatus> cv_Subdiv2D_insert(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<ffi.Pointer<CvStatus> Function(Subdiv2D, VecF32, ffi.Pointer<VecI32>, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_Subdiv2D_insertBulk(
+  Subdiv2D self$1,
+  VecF32 xy,
+  ffi.Pointer<VecI32> rval,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<ffi.Pointer<CvStatus> Function(Subdiv2D, VecPoint2f, imp$1.CvCallback_0)>()
 external ffi.Pointer<CvStatus> cv_Subdiv2D_insertVec(
   Subdiv2D self$1,
@@ -558,6 +867,17 @@ external ffi.Pointer<CvStatus> cv_Subdiv2D_locate(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(Subdiv2D, VecI32, VecF32, ffi.Pointer<ffi.Bool>, imp$1.CvCallback_0)
+>()
+external ffi.Pointer<CvStatus> cv_Subdiv2D_movePoints(
+  Subdiv2D self$1,
+  VecI32 vertices,
+  VecF32 xy,
+  ffi.Pointer<ffi.Bool> rval,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<ffi.Pointer<CvStatus> Function(Subdiv2D, ffi.Int, ffi.Pointer<ffi.Int>, imp$1.CvCallback_0)>()
 external ffi.Pointer<CvStatus> cv_Subdiv2D_nextEdge(
   Subdiv2D self$1,
@@ -585,6 +905,119 @@ external ffi.Pointer<CvStatus> cv_Subdiv2D_symEdge(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<ffi.Void Function(TemplateMatcherPtr)>()
+external void cv_TemplateMatcher_close(
+  TemplateMatcherPtr self$1,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(Mat, VecF64, VecF64, ffi.Int, ffi.Int, ffi.Int, ffi.Pointer<TemplateMatcher>)
+>()
+external ffi.Pointer<CvStatus> cv_TemplateMatcher_create(
+  Mat templ,
+  VecF64 scales,
+  VecF64 angles,
+  int method,
+  int levels,
+  int topK,
+  ffi.Pointer<TemplateMatcher> rval,
+);
+
+@ffi.Native<ffi.Int Function(TemplateMatcher)>()
+external int cv_TemplateMatcher_getLevels(
+  TemplateMatcher self$1,
+);
+
+@ffi.Native<ffi.Int Function(TemplateMatcher)>()
+external int cv_TemplateMatcher_getMethod(
+  TemplateMatcher self$1,
+);
+
+@ffi.Native<ffi.Int Function(TemplateMatcher)>()
+external int cv_TemplateMatcher_getTopK(
+  TemplateMatcher self$1,
+);
+
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    TemplateMatcher,
+    Mat,
+    ffi.Double,
+    ffi.Int,
+    ffi.Pointer<VecRotatedRect>,
+    ffi.Pointer<VecF32>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_TemplateMatcher_match(
+  TemplateMatcher self$1,
+  Mat image,
+  double threshold,
+  int maxMatches,
+  ffi.Pointer<VecRotatedRect> boxes,
+  ffi.Pointer<VecF32> scores,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(VideoCLAHE, Mat, Mat, imp$1.CvCallback_0)>()
+external ffi.Pointer<CvStatus> cv_VideoCLAHE_apply(
+  VideoCLAHE self$1,
+  Mat src,
+  Mat dst,
+  imp$1.CvCallback_0 callback,
+);
+
+@ffi.Native<ffi.Void Function(VideoCLAHEPtr)>()
+external void cv_VideoCLAHE_close(
+  VideoCLAHEPtr self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(ffi.Double, CvSize, ffi.Double, ffi.Pointer<VideoCLAHE>)>()
+external ffi.Pointer<CvStatus> cv_VideoCLAHE_create(
+  double clipLimit,
+  CvSize tileGridSize,
+  double smoothing,
+  ffi.Pointer<VideoCLAHE> rval,
+);
+
+@ffi.Native<ffi.Double Function(VideoCLAHE)>()
+external double cv_VideoCLAHE_getClipLimit(
+  VideoCLAHE self$1,
+);
+
+@ffi.Native<ffi.Int Function(VideoCLAHE)>()
+external int cv_VideoCLAHE_getFrames(
+  VideoCLAHE self$1,
+);
+
+@ffi.Native<ffi.Double Function(VideoCLAHE)>()
+external double cv_VideoCLAHE_getSmoothing(
+  VideoCLAHE self$1,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(VideoCLAHE, ffi.Pointer<CvSize>)>()
+external ffi.Pointer<CvStatus> cv_VideoCLAHE_getTilesGridSize(
+  VideoCLAHE self$1,
+  ffi.Pointer<CvSize> rval,
+);
+
+@ffi.Native<ffi.Void Function(VideoCLAHE)>()
+external void cv_VideoCLAHE_reset(
+  VideoCLAHE self$1,
+);
+
+@ffi.Native<ffi.Void Function(VideoCLAHE, ffi.Double)>()
+external void cv_VideoCLAHE_setClipLimit(
+  VideoCLAHE self$1,
+  double clipLimit,
+);
+
+@ffi.Native<ffi.Pointer<CvStatus> Function(VideoCLAHE, ffi.Double)>()
+external ffi.Pointer<CvStatus> cv_VideoCLAHE_setSmoothing(
+  VideoCLAHE self$1,
+  double smoothing,
+);
+
 @ffi.Native<ffi.Pointer<CvStatus> Function(Mat, Mat, imp$1.CvCallback_0)>()
 external ffi.Pointer<CvStatus> cv_accumulate(
   Mat src,
@@ -2015,6 +2448,29 @@ external ffi.Pointer<CvStatus> cv_warpAffine(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    Mat,
+    VecMat,
+    VecI32,
+    ffi.Int,
+    ffi.Int,
+    Scalar,
+    ffi.Pointer<VecMat>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_warpAffineBatch(
+  Mat src,
+  VecMat Ms,
+  VecI32 dsizes,
+  int flags,
+  int borderMode,
+  Scalar borderValue,
+  ffi.Pointer<VecMat> rval,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<
   ffi.Pointer<CvStatus> Function(Mat, Mat, Mat, CvSize, ffi.Int, ffi.Int, Scalar, imp$1.CvCallback_0)
 >()
@@ -2038,6 +2494,29 @@ external ffi.Pointer<CvStatus> cv_warpPerspective(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    Mat,
+    VecMat,
+    VecI32,
+    ffi.Int,
+    ffi.Int,
+    Scalar,
+    ffi.Pointer<VecMat>,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_warpPerspectiveBatch(
+  Mat src,
+  VecMat Ms,
+  VecI32 dsizes,
+  int flags,
+  int borderMode,
+  Scalar borderValue,
+  ffi.Pointer<VecMat> rval,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<
   ffi.Pointer<CvStatus> Function(Mat, Mat, Mat, CvSize, ffi.Int, ffi.Int, Scalar, imp$1.CvCallback_0)
 >()
@@ -2065,10 +2544,22 @@ class _SymbolAddresses {
   const _SymbolAddresses();
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(CLAHEPtr)>> get cv_CLAHE_close =>
       ffi.Native.addressOf(self.cv_CLAHE_close);
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ComponentLabelerPtr)>> get cv_ComponentLabeler_close =>
+      ffi.Native.addressOf(self.cv_ComponentLabeler_close);
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ImagePyramidPtr)>> get cv_ImagePyramid_close =>
+      ffi.Native.addressOf(self.cv_ImagePyramid_close);
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(IntegralImagePtr)>> get cv_IntegralImage_close =>
+      ffi.Native.addressOf(self.cv_IntegralImage_close);
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(LineSegmentDetectorPtr)>>
   get cv_LineSegmentDetector_close => ffi.Native.addressOf(self.cv_LineSegmentDetector_close);
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(SlidingHistogramPtr)>> get cv_SlidingHistogram_close =>
+      ffi.Native.addressOf(self.cv_SlidingHistogram_close);
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(Subdiv2DPtr)>> get cv_Subdiv2D_close =>
       ffi.Native.addressOf(self.cv_Subdiv2D_close);
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(TemplateMatcherPtr)>> get cv_TemplateMatcher_close =>
+      ffi.Native.addressOf(self.cv_TemplateMatcher_close);
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(VideoCLAHEPtr)>> get cv_VideoCLAHE_close =>
+      ffi.Native.addressOf(self.cv_VideoCLAHE_close);
 }
 
 final class CLAHE extends ffi.Struct {
@@ -2076,12 +2567,30 @@ final class CLAHE extends ffi.Struct {
 }
 
 typedef CLAHEPtr = ffi.Pointer<CLAHE>;
+
+final class ComponentLabeler extends ffi.Struct {
+  external ffi.Pointer<ffi.Void> ptr;
+}
+
+typedef ComponentLabelerPtr = ffi.Pointer<ComponentLabeler>;
 typedef CvPoint = imp$1.CvPoint;
 typedef CvPoint2f = imp$1.CvPoint2f;
 typedef CvRect = imp$1.CvRect;
 typedef CvSize = imp$1.CvSize;
 typedef CvStatus = imp$1.CvStatus;
 
+final class ImagePyramid extends ffi.Struct {
+  external ffi.Pointer<ffi.Void> ptr;
+}
+
+typedef ImagePyramidPtr = ffi.Pointer<ImagePyramid>;
+
+final class IntegralImage extends ffi.Struct {
+  external ffi.Pointer<ffi.Void> ptr;
+}
+
+typedef IntegralImagePtr = ffi.Pointer<IntegralImage>;
+
 final class LineSegmentDetector extends ffi.Struct {
   external ffi.Pointer<ffi.Void> ptr;
 }
@@ -2092,11 +2601,23 @@ typedef Moment = imp$1.Moment;
 typedef RotatedRect = imp$1.RotatedRect;
 typedef Scalar = imp$1.Scalar;
 
+final class SlidingHistogram extends ffi.Struct {
+  external ffi.Pointer<ffi.Void> ptr;
+}
+
+typedef SlidingHistogramPtr = ffi.Pointer<SlidingHistogram>;
+
 final class Subdiv2D extends ffi.Struct {
   external ffi.Pointer<ffi.Void> ptr;
 }
 
 typedef Subdiv2DPtr = ffi.Pointer<Subdiv2D>;
+
+final class TemplateMatcher extends ffi.Struct {
+  external ffi.Pointer<ffi.Void> ptr;
+}
+
+typedef TemplateMatcherPtr = ffi.Pointer<TemplateMatcher>;
 typedef TermCriteria = imp$1.TermCriteria;
 typedef Vec4f = imp$1.Vec4f;
 typedef Vec6f = imp$1.Vec6f;
@@ -2106,7 +2627,15 @@ typedef VecI32 = imp$1.VecI32;
 typedef VecMat = imp$1.VecMat;
 typedef VecPoint = imp$1.VecPoint;
 typedef VecPoint2f = imp$1.VecPoint2f;
+typedef VecRect = imp$1.VecRect;
+typedef VecRotatedRect = imp$1.VecRotatedRect;
 typedef VecVec4f = imp$1.VecVec4f;
 typedef VecVec4i = imp$1.VecVec4i;
 typedef VecVecPoint = imp$1.VecVecPoint;
 typedef VecVecPoint2f = imp$1.VecVecPoint2f;
+
+final class VideoCLAHE extends ffi.Struct {
+  external ffi.Pointer<ffi.Void> ptr;
+}
+
+typedef VideoCLAHEPtr = ffi.Pointer<VideoCLAHE>;
@@ -42,6 +42,27 @@ external ffi.Pointer<CvStatus> cv_CascadeClassifier_detectMultiScale(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    CascadeClassifier,
+    VecMat,
+    ffi.Double,
+    ffi.Pointer<VecRect>,
+    ffi.Int,
+    ffi.Int,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_CascadeClassifier_detectMultiScalePyramid(
+  CascadeClassifier self$1,
+  VecMat pyramid,
+  double scaleFactor,
+  ffi.Pointer<VecRect> objects,
+  int minNeighbors,
+  int flags,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<
   ffi.Pointer<CvStatus> Function(
     CascadeClassifier,
@@ -395,6 +395,37 @@ external ffi.Pointer<CvStatus> cv_calcOpticalFlowPyrLK_1(
   imp$1.CvCallback_0 callback,
 );
 
+@ffi.Native<
+  ffi.Pointer<CvStatus> Function(
+    VecMat,
+    VecMat,
+    VecPoint2f,
+    ffi.Pointer<VecPoint2f>,
+    ffi.Pointer<VecUChar>,
+    ffi.Pointer<VecF32>,
+    CvSize,
+    ffi.Int,
+    TermCriteria,
+    ffi.Int,
+    ffi.Double,
+    imp$1.CvCallback_0,
+  )
+>()
+external ffi.Pointer<CvStatus> cv_calcOpticalFlowPyrLK_2(
+  VecMat prevPyr,
+  VecMat nextPyr,
+  VecPoint2f prevPts,
+  ffi.Pointer<VecPoint2f> nextPts,
+  ffi.Pointer<VecUChar> status,
+  ffi.Pointer<VecF32> err,
+  CvSize winSize,
+  int maxLevel,
+  TermCriteria criteria,
+  int flags,
+  double minEigThreshold,
+  imp$1.CvCallback_0 callback,
+);
+
 @ffi.Native<
   ffi.Pointer<CvStatus> Function(
     Mat,
@@ -474,5 +505,6 @@ final class TrackerMIL extends ffi.Struct {
 typedef TrackerMILPtr = ffi.Pointer<TrackerMIL>;
 typedef TrackerPtr = ffi.Pointer<Tracker>;
 typedef VecF32 = imp$1.VecF32;
+typedef VecMat = imp$1.VecMat;
 typedef VecPoint2f = imp$1.VecPoint2f;
 typedef VecUChar = imp$1.VecUChar;
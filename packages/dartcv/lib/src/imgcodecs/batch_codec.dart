@@ -0,0 +1,213 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.imgcodecs.batch_codec;
+
+import 'dart:ffi' as ffi;
+import 'dart:typed_data';
+
+import 'package:ffi/ffi.dart';
+
+import '../core/base.dart';
+import '../core/mat.dart';
+import '../core/size.dart';
+import '../core/vec.dart';
+import '../g/constants.g.dart';
+import '../g/imgcodecs.g.dart' as cimgcodecs;
+
+/// The item was decoded or encoded.
+const int BATCH_CODEC_OK = 0;
+
+/// The data could not be decoded, e.g., a missing file or a corrupted image, or the encoder failed.
+const int BATCH_CODEC_FAILED = 1;
+
+/// OpenCV raised an error for the item, e.g., unsupported parameters.
+const int BATCH_CODEC_ERROR = 2;
+
+/// Decodes all of [bufs] in parallel on at most [numThreads] workers (0: `getNumThreads`),
+/// see `imdecode` for [flags].
+///
+/// Images are resized to [dsize] with [interpolation] unless it is (0, 0), a 0 width or height
+/// keeps the aspect ratio, e.g., `(256, 0)`. Returns the images and one status per item,
+/// [BATCH_CODEC_OK], [BATCH_CODEC_FAILED] or [BATCH_CODEC_ERROR], failed items are empty.
+(VecMat mats, List<int> status) imdecodeBatch(
+  List<Uint8List> bufs, {
+  int flags = IMREAD_COLOR,
+  (int, int) dsize = (0, 0),
+  int interpolation = INTER_AREA,
+  int numThreads = 0,
+}) {
+  final cbufs = VecVecChar.fromList(bufs);
+  final mats = VecMat();
+  final status = VecI32();
+  cvRun(
+    () => cimgcodecs.cv_imdecodeBatch(
+      cbufs.ref,
+      flags,
+      dsize.cvd.ref,
+      interpolation,
+      numThreads,
+      mats.ptr,
+      status.ptr,
+      ffi.nullptr,
+    ),
+  );
+  cbufs.dispose();
+  return (mats, status.toList());
+}
+
+/// async version of [imdecodeBatch]
+Future<(VecMat mats, List<int> status)> imdecodeBatchAsync(
+  List<Uint8List> bufs, {
+  int flags = IMREAD_COLOR,
+  (int, int) dsize = (0, 0),
+  int interpolation = INTER_AREA,
+  int numThreads = 0,
+}) async {
+  final cbufs = VecVecChar.fromList(bufs);
+  final mats = VecMat();
+  final status = VecI32();
+  return cvRunAsync0(
+    (callback) => cimgcodecs.cv_imdecodeBatch(
+      cbufs.ref,
+      flags,
+      dsize.cvd.ref,
+      interpolation,
+      numThreads,
+      mats.ptr,
+      status.ptr,
+      callback,
+    ),
+    (c) {
+      cbufs.dispose();
+      return c.complete((mats, status.toList()));
+    },
+  );
+}
+
+/// Same as [imdecodeBatch] but reads [filenames].
+(VecMat mats, List<int> status) imreadBatch(
+  List<String> filenames, {
+  int flags = IMREAD_COLOR,
+  (int, int) dsize = (0, 0),
+  int interpolation = INTER_AREA,
+  int numThreads = 0,
+}) {
+  final cnames = filenames.i8;
+  final mats = VecMat();
+  final status = VecI32();
+  cvRun(
+    () => cimgcodecs.cv_imreadBatch(
+      cnames.ref,
+      flags,
+      dsize.cvd.ref,
+      interpolation,
+      numThreads,
+      mats.ptr,
+      status.ptr,
+      ffi.nullptr,
+    ),
+  );
+  cnames.dispose();
+  return (mats, status.toList());
+}
+
+/// async version of [imreadBatch]
+Future<(VecMat mats, List<int> status)> imreadBatchAsync(
+  List<String> filenames, {
+  int flags = IMREAD_COLOR,
+  (int, int) dsize = (0, 0),
+  int interpolation = INTER_AREA,
+  int numThreads = 0,
+}) async {
+  final cnames = filenames.i8;
+  final mats = VecMat();
+  final status = VecI32();
+  return cvRunAsync0(
+    (callback) => cimgcodecs.cv_imreadBatch(
+      cnames.ref,
+      flags,
+      dsize.cvd.ref,
+      interpolation,
+      numThreads,
+      mats.ptr,
+      status.ptr,
+      callback,
+    ),
+    (c) {
+      cnames.dispose();
+      return c.complete((mats, status.toList()));
+    },
+  );
+}
+
+/// Encodes all of [imgs] to the format of [ext] with [params] in parallel, see [imdecodeBatch]
+/// for [dsize], [interpolation], [numThreads] and the status, failed items are empty.
+(List<Uint8List> bufs, List<int> status) imencodeBatch(
+  String ext,
+  VecMat imgs, {
+  VecI32? params,
+  (int, int) dsize = (0, 0),
+  int interpolation = INTER_AREA,
+  int numThreads = 0,
+}) {
+  final cext = ext.toNativeUtf8().cast<ffi.Char>();
+  final cparams = params ?? VecI32();
+  final bufs = VecVecChar();
+  final status = VecI32();
+  try {
+    cvRun(
+      () => cimgcodecs.cv_imencodeBatch(
+        cext,
+        imgs.ref,
+        cparams.ref,
+        dsize.cvd.ref,
+        interpolation,
+        numThreads,
+        bufs.ptr,
+        status.ptr,
+        ffi.nullptr,
+      ),
+    );
+  } finally {
+    calloc.free(cext);
+  }
+  final rval = bufs.map((e) => Uint8List.fromList(e.data)).toList(); // will copy data
+  bufs.dispose();
+  return (rval, status.toList());
+}
+
+/// async version of [imencodeBatch]
+Future<(List<Uint8List> bufs, List<int> status)> imencodeBatchAsync(
+  String ext,
+  VecMat imgs, {
+  VecI32? params,
+  (int, int) dsize = (0, 0),
+  int interpolation = INTER_AREA,
+  int numThreads = 0,
+}) async {
+  final cext = ext.toNativeUtf8().cast<ffi.Char>();
+  final cparams = params ?? VecI32();
+  final bufs = VecVecChar();
+  final status = VecI32();
+  return cvRunAsync0(
+    (callback) => cimgcodecs.cv_imencodeBatch(
+      cext,
+      imgs.ref,
+      cparams.ref,
+      dsize.cvd.ref,
+      interpolation,
+      numThreads,
+      bufs.ptr,
+      status.ptr,
+      callback,
+    ),
+    (c) {
+      calloc.free(cext);
+      final rval = bufs.map((e) => Uint8List.fromList(e.data)).toList(); // will copy data
+      bufs.dispose();
+      return c.complete((rval, status.toList()));
+    },
+  );
+}
@@ -0,0 +1,208 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.imgcodecs.image_encoder;
+
+import 'dart:ffi' as ffi;
+import 'dart:typed_data';
+
+import 'package:ffi/ffi.dart';
+
+import '../core/base.dart';
+import '../core/mat.dart';
+import '../core/vec.dart';
+import '../g/imgcodecs.g.dart' as cimgcodecs;
+
+/// An `imencode` with a fixed format and parameters, e.g., to stream MJPEG frames.
+///
+/// The parameters are converted once and the data is encoded to a buffer owned by the encoder,
+/// which keeps its capacity, so encoding frames of a similar size does not allocate natively.
+/// [encode] returns a copy, [encodeView] and [encodeTo] avoid it.
+/// Only one [encode], [encodeView] or [encodeTo] may run at a time, [encodeBatch] encodes in parallel.
+class ImageEncoder extends CvStruct<cimgcodecs.ImageEncoder> {
+  ImageEncoder._(cimgcodecs.ImageEncoderPtr ptr, [bool attach = true]) : super.fromPointer(ptr) {
+    if (attach) {
+      finalizer.attach(this, ptr.cast(), detach: this);
+    }
+  }
+
+  factory ImageEncoder.fromPointer(cimgcodecs.ImageEncoderPtr ptr, [bool attach = true]) =>
+      ImageEncoder._(ptr, attach);
+
+  /// [ext] is a file extension, e.g., `.jpg`, [params] are the same as `imencode`,
+  /// e.g., `VecI32.fromList([IMWRITE_JPEG_QUALITY, 80])`.
+  factory ImageEncoder(String ext, {VecI32? params}) {
+    final p = calloc<cimgcodecs.ImageEncoder>();
+    final cext = ext.toNativeUtf8().cast<ffi.Char>();
+    final cparams = params ?? VecI32();
+    try {
+      cvRun(() => cimgcodecs.cv_ImageEncoder_create(cext, cparams.ref, p));
+    } catch (e) {
+      calloc.free(p);
+      rethrow;
+    } finally {
+      calloc.free(cext);
+    }
+    return ImageEncoder._(p);
+  }
+
+  static final finalizer = OcvFinalizer<cimgcodecs.ImageEncoderPtr>(
+    cimgcodecs.addresses.cv_ImageEncoder_close,
+  );
+
+  void dispose() {
+    finalizer.detach(this);
+    cimgcodecs.cv_ImageEncoder_close(ptr);
+  }
+
+  @override
+  cimgcodecs.ImageEncoder get ref => ptr.ref;
+
+  /// Encodes [img], returns whether it succeeded and a copy of the encoded data.
+  (bool, Uint8List) encode(Mat img) {
+    final (success, view) = encodeView(img);
+    return (success, Uint8List.fromList(view)); // will copy data
+  }
+
+  /// async version of [encode]
+  Future<(bool, Uint8List)> encodeAsync(Mat img) async {
+    final (success, view) = await encodeViewAsync(img);
+    return (success, Uint8List.fromList(view)); // will copy data
+  }
+
+  /// Same as [encode] but returns a view of the buffer of the encoder instead of a copy.
+  ///
+  /// The view does not keep the encoder alive: it is overwritten by the next encode and
+  /// invalid once the encoder is disposed or garbage collected, so keep a reference to the
+  /// encoder while the view is used, e.g., to write it to a socket, and never return the view
+  /// of a temporary encoder.
+  (bool, Uint8List) encodeView(Mat img) {
+    final pSuccess = calloc<ffi.Bool>();
+    final pData = calloc<ffi.Pointer<ffi.Uint8>>();
+    final pSize = calloc<ffi.Size>();
+    try {
+      cvRun(() => cimgcodecs.cv_ImageEncoder_encode(ref, img.ref, pSuccess, pData, pSize, ffi.nullptr));
+      return (pSuccess.value, pData.value.asTypedList(pSize.value));
+    } finally {
+      calloc.free(pSuccess);
+      calloc.free(pData);
+      calloc.free(pSize);
+    }
+  }
+
+  /// async version of [encodeView]
+  Future<(bool, Uint8List)> encodeViewAsync(Mat img) async {
+    final pSuccess = calloc<ffi.Bool>();
+    final pData = calloc<ffi.Pointer<ffi.Uint8>>();
+    final pSize = calloc<ffi.Size>();
+    return cvRunAsync0(
+      (callback) => cimgcodecs.cv_ImageEncoder_encode(ref, img.ref, pSuccess, pData, pSize, callback),
+      (c) {
+        final rval = (pSuccess.value, pData.value.asTypedList(pSize.value));
+        calloc.free(pSuccess);
+        calloc.free(pData);
+        calloc.free(pSize);
+        return c.complete(rval);
+      },
+    );
+  }
+
+  /// Encodes [img] to [buf] of [capacity] bytes, e.g., a shared or pooled buffer.
+  ///
+  /// Returns whether it succeeded and the encoded size, which is also set when the data
+  /// does not fit in [capacity], so the caller can grow [buf] and retry.
+  (bool, int) encodeTo(Mat img, ffi.Pointer<ffi.Uint8> buf, int capacity) {
+    final pSuccess = calloc<ffi.Bool>();
+    final pSize = calloc<ffi.Size>();
+    try {
+      cvRun(
+        () => cimgcodecs.cv_ImageEncoder_encodeTo(
+          ref,
+          img.ref,
+          buf,
+          capacity,
+          pSuccess,
+          pSize,
+          ffi.nullptr,
+        ),
+      );
+      return (pSuccess.value, pSize.value);
+    } finally {
+      calloc.free(pSuccess);
+      calloc.free(pSize);
+    }
+  }
+
+  /// async version of [encodeTo]
+  Future<(bool, int)> encodeToAsync(Mat img, ffi.Pointer<ffi.Uint8> buf, int capacity) async {
+    final pSuccess = calloc<ffi.Bool>();
+    final pSize = calloc<ffi.Size>();
+    return cvRunAsync0(
+      (callback) => cimgcodecs.cv_ImageEncoder_encodeTo(
+        ref,
+        img.ref,
+        buf,
+        capacity,
+        pSuccess,
+        pSize,
+        callback,
+      ),
+      (c) {
+        final rval = (pSuccess.value, pSize.value);
+        calloc.free(pSuccess);
+        calloc.free(pSize);
+        return c.complete(rval);
+      },
+    );
+  }
+
+  /// Encodes all of [imgs] in parallel on at most [numThreads] workers (0: `getNumThreads`),
+  /// returns copies of the data and the status of every item, see `imencodeBatch`.
+  (List<Uint8List> bufs, List<int> status) encodeBatch(VecMat imgs, {int numThreads = 0}) {
+    final bufs = VecVecChar();
+    final status = VecI32();
+    cvRun(
+      () => cimgcodecs.cv_ImageEncoder_encodeBatch(
+        ref,
+        imgs.ref,
+        numThreads,
+        bufs.ptr,
+        status.ptr,
+        ffi.nullptr,
+      ),
+    );
+    final rval = bufs.map((e) => Uint8List.fromList(e.data)).toList(); // will copy data
+    bufs.dispose();
+    return (rval, status.toList());
+  }
+
+  /// async version of [encodeBatch]
+  Future<(List<Uint8List> bufs, List<int> status)> encodeBatchAsync(
+    VecMat imgs, {
+    int numThreads = 0,
+  }) async {
+    final bufs = VecVecChar();
+    final status = VecI32();
+    return cvRunAsync0(
+      (callback) =>
+          cimgcodecs.cv_ImageEncoder_encodeBatch(ref, imgs.ref, numThreads, bufs.ptr, status.ptr, callback),
+      (c) {
+        final rval = bufs.map((e) => Uint8List.fromList(e.data)).toList(); // will copy data
+        bufs.dispose();
+        return c.complete((rval, status.toList()));
+      },
+    );
+  }
+
+  /// The file extension of the format, e.g., `.jpg`.
+  String get ext => cimgcodecs.cv_ImageEncoder_getExt(ref).cast<Utf8>().toDartString();
+
+  /// The capacity of the buffer of the encoder in bytes.
+  int get capacity => cimgcodecs.cv_ImageEncoder_getCapacity(ref);
+
+  @override
+  String toString() {
+    return "ImageEncoder(address=0x${ptr.address.toRadixString(16)})";
+  }
+}
@@ -0,0 +1,141 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.imgcodecs.image_probe;
+
+import 'dart:ffi' as ffi;
+import 'dart:typed_data';
+
+import 'package:ffi/ffi.dart';
+
+import '../core/base.dart';
+import '../core/mat_type.dart';
+import '../g/imgcodecs.g.dart' as cimgcodecs;
+
+/// The header of an image, see [improbe].
+class ImageHeader {
+  const ImageHeader({
+    required this.width,
+    required this.height,
+    required this.channels,
+    required this.depth,
+    this.orientation = 1,
+    this.pages = 1,
+  });
+
+  factory ImageHeader.fromNative(cimgcodecs.CvImageHeader header) => ImageHeader(
+    width: header.width,
+    height: header.height,
+    channels: header.channels,
+    depth: header.depth,
+    orientation: header.orientation,
+    pages: header.pages,
+  );
+
+  /// The stored size, `imread` swaps width and height for an [orientation] of 5 to 8
+  /// unless `IMREAD_IGNORE_ORIENTATION` is set.
+  final int width;
+  final int height;
+
+  /// The channels and depth of the Mat `imread` returns with `IMREAD_UNCHANGED`.
+  final int channels;
+  final int depth;
+
+  /// The EXIF orientation, 1 to 8, 1 if the image has none.
+  final int orientation;
+
+  /// The pages of a TIFF (at most 1024, see [improbe]) or the frames of a GIF, an animated PNG
+  /// or WebP, 1 otherwise.
+  final int pages;
+
+  /// The type of the Mat `imread` returns with `IMREAD_UNCHANGED`.
+  MatType get type => MatType.makeType(depth, channels);
+
+  @override
+  String toString() {
+    return "ImageHeader(width=$width, height=$height, channels=$channels, depth=$depth, "
+        "orientation=$orientation, pages=$pages)";
+  }
+}
+
+/// Reads the size, channels, depth, EXIF orientation and page count of an image
+/// without decoding it, e.g., to reject or route images before `imread`.
+///
+/// Only the header segments are read, e.g., up to the start of frame of a JPEG,
+/// the pages of a TIFF or the frames of a GIF are counted by skipping their data.
+/// JPEG, PNG, BMP, GIF, WebP, TIFF and PNM/PAM are supported, returns null for other formats,
+/// missing files and truncated or malformed headers. TIFFs with more than 1024 pages also return
+/// null, their pages are not counted to the end, so treat null as a rejection for admission control.
+ImageHeader? improbe(String filename) {
+  final cname = filename.toNativeUtf8().cast<ffi.Char>();
+  final pSuccess = calloc<ffi.Bool>();
+  final pHeader = calloc<cimgcodecs.CvImageHeader>();
+  try {
+    cvRun(() => cimgcodecs.cv_improbe(cname, pSuccess, pHeader, ffi.nullptr));
+    return pSuccess.value ? ImageHeader.fromNative(pHeader.ref) : null;
+  } finally {
+    calloc.free(cname);
+    calloc.free(pSuccess);
+    calloc.free(pHeader);
+  }
+}
+
+/// async version of [improbe]
+Future<ImageHeader?> improbeAsync(String filename) async {
+  final cname = filename.toNativeUtf8().cast<ffi.Char>();
+  final pSuccess = calloc<ffi.Bool>();
+  final pHeader = calloc<cimgcodecs.CvImageHeader>();
+  return cvRunAsync0((callback) => cimgcodecs.cv_improbe(cname, pSuccess, pHeader, callback), (c) {
+    final rval = pSuccess.value ? ImageHeader.fromNative(pHeader.ref) : null;
+    calloc.free(cname);
+    calloc.free(pSuccess);
+    calloc.free(pHeader);
+    return c.complete(rval);
+  });
+}
+
+/// Same as [improbe] but reads the encoded image in [buf], which is copied to native memory,
+/// use [improbeBuffer] for bytes already there.
+ImageHeader? improbeBytes(Uint8List buf) {
+  if (buf.isEmpty) return null;
+  final p = malloc<ffi.Uint8>(buf.length);
+  p.asTypedList(buf.length).setAll(0, buf);
+  try {
+    return improbeBuffer(p, buf.length);
+  } finally {
+    malloc.free(p);
+  }
+}
+
+/// async version of [improbeBytes]
+Future<ImageHeader?> improbeBytesAsync(Uint8List buf) async {
+  if (buf.isEmpty) return null;
+  final p = malloc<ffi.Uint8>(buf.length);
+  p.asTypedList(buf.length).setAll(0, buf);
+  final pSuccess = calloc<ffi.Bool>();
+  final pHeader = calloc<cimgcodecs.CvImageHeader>();
+  return cvRunAsync0(
+    (callback) => cimgcodecs.cv_improbe_1(p, buf.length, pSuccess, pHeader, callback),
+    (c) {
+      final rval = pSuccess.value ? ImageHeader.fromNative(pHeader.ref) : null;
+      malloc.free(p);
+      calloc.free(pSuccess);
+      calloc.free(pHeader);
+      return c.complete(rval);
+    },
+  );
+}
+
+/// Same as [improbe] but reads the [length] bytes at [buf], which are not copied.
+ImageHeader? improbeBuffer(ffi.Pointer<ffi.Uint8> buf, int length) {
+  final pSuccess = calloc<ffi.Bool>();
+  final pHeader = calloc<cimgcodecs.CvImageHeader>();
+  try {
+    cvRun(() => cimgcodecs.cv_improbe_1(buf, length, pSuccess, pHeader, ffi.nullptr));
+    return pSuccess.value ? ImageHeader.fromNative(pHeader.ref) : null;
+  } finally {
+    calloc.free(pSuccess);
+    calloc.free(pHeader);
+  }
+}
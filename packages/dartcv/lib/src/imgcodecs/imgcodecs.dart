@@ -12,6 +12,7 @@ import 'package:ffi/ffi.dart';
 
 import '../core/base.dart';
 import '../core/mat.dart';
+import '../core/rect.dart';
 import '../core/vec.dart';
 import '../g/constants.g.dart';
 import '../g/imgcodecs.g.dart' as cimgcodecs;
@@ -73,6 +74,44 @@ Future<Mat> imreadAsync(String filename, {int flags = IMREAD_COLOR}) async {
   });
 }
 
+/// Reads the [roi] of an image reduced by [reduce] (1, 2, 4 or 8, see [IMREAD_REDUCED_COLOR_2] etc.)
+/// into [dst], e.g., for thumbnails and crops.
+///
+/// JPEGs are decoded at the reduced size directly, which is a fraction of the cost of a full decode
+/// followed by `resize`. [roi] is in full resolution coordinates of the (oriented) image, the region
+/// is cropped from the reduced image, `null` reads the whole image.
+Mat imreadRegion(String filename, {int flags = IMREAD_COLOR, Rect? roi, int reduce = 1, Mat? dst}) {
+  dst ??= Mat.empty();
+  final rect = roi ?? Rect(0, 0, 0, 0);
+  final cname = filename.toNativeUtf8().cast<ffi.Char>();
+  try {
+    cvRun(() => cimgcodecs.cv_imread_1(cname, flags, rect.ref, reduce, dst!.ref, ffi.nullptr));
+  } finally {
+    calloc.free(cname);
+  }
+  return dst;
+}
+
+/// async version of [imreadRegion]
+Future<Mat> imreadRegionAsync(
+  String filename, {
+  int flags = IMREAD_COLOR,
+  Rect? roi,
+  int reduce = 1,
+  Mat? dst,
+}) async {
+  dst ??= Mat.empty();
+  final rect = roi ?? Rect(0, 0, 0, 0);
+  final cname = filename.toNativeUtf8().cast<ffi.Char>();
+  return cvRunAsync0(
+    (callback) => cimgcodecs.cv_imread_1(cname, flags, rect.ref, reduce, dst!.ref, callback),
+    (c) {
+      calloc.free(cname);
+      return c.complete(dst);
+    },
+  );
+}
+
 /// write a Mat to an image file.
 ///
 /// For further details, please see:
@@ -202,8 +241,23 @@ Future<(bool, VecUChar)> imencodeVecAsync(String ext, InputArray img, {VecI32? p
 /// For further details, please see:
 /// https://docs.opencv.org/master/d4/da8/group__imgcodecs.html#ga26a67788faa58ade337f8d28ba0eb19e
 Mat imdecode(Uint8List buf, int flags, {Mat? dst}) {
-  final vec = VecUChar.fromList(buf);
-  return imdecodeVec(vec, flags, dst: dst);
+  final p = _copyToNative(buf);
+  try {
+    return imdecodeBuffer(p, buf.length, flags, dst: dst);
+  } finally {
+    if (p != ffi.nullptr) malloc.free(p);
+  }
+}
+
+/// Same as [imdecode] but decodes the [length] bytes at [buf] in place, without copying them,
+/// e.g., a buffer received by a native network layer, which must stay valid until it returns.
+///
+/// The buffer of [dst] is reused when the size and type of the decoded image match,
+/// [dst] is empty if the data cannot be decoded.
+Mat imdecodeBuffer(ffi.Pointer<ffi.Uint8> buf, int length, int flags, {Mat? dst}) {
+  dst ??= Mat.empty();
+  cvRun(() => cimgcodecs.cv_imdecode_1(buf, length, flags, dst!.ref, ffi.nullptr));
+  return dst;
 }
 
 /// Same as [imdecode] but accepts [VecUChar]
@@ -215,8 +269,20 @@ Mat imdecodeVec(VecUChar buf, int flags, {Mat? dst}) {
 
 /// async version of [imdecode]
 Future<Mat> imdecodeAsync(Uint8List buf, int flags, {Mat? dst}) async {
-  final vec = VecUChar.fromList(buf);
-  return imdecodeVecAsync(vec, flags, dst: dst);
+  final p = _copyToNative(buf);
+  dst ??= Mat.empty();
+  return cvRunAsync0((callback) => cimgcodecs.cv_imdecode_1(p, buf.length, flags, dst!.ref, callback), (c) {
+    if (p != ffi.nullptr) malloc.free(p);
+    return c.complete(dst);
+  });
+}
+
+/// async version of [imdecodeBuffer], [buf] must stay valid until the returned future completes.
+Future<Mat> imdecodeBufferAsync(ffi.Pointer<ffi.Uint8> buf, int length, int flags, {Mat? dst}) async {
+  dst ??= Mat.empty();
+  return cvRunAsync0((callback) => cimgcodecs.cv_imdecode_1(buf, length, flags, dst!.ref, callback), (c) {
+    return c.complete(dst);
+  });
 }
 
 /// Same as [imdecodeAsync] but accepts [VecUChar]
@@ -226,3 +292,43 @@ Future<Mat> imdecodeVecAsync(VecUChar vec, int flags, {Mat? dst}) async {
     return c.complete(dst);
   });
 }
+
+/// Same as [imreadRegion] but decodes [buf].
+Mat imdecodeRegion(Uint8List buf, {int flags = IMREAD_COLOR, Rect? roi, int reduce = 1, Mat? dst}) {
+  dst ??= Mat.empty();
+  final rect = roi ?? Rect(0, 0, 0, 0);
+  final p = _copyToNative(buf);
+  try {
+    cvRun(() => cimgcodecs.cv_imdecode_2(p, buf.length, flags, rect.ref, reduce, dst!.ref, ffi.nullptr));
+  } finally {
+    if (p != ffi.nullptr) malloc.free(p);
+  }
+  return dst;
+}
+
+/// async version of [imdecodeRegion]
+Future<Mat> imdecodeRegionAsync(
+  Uint8List buf, {
+  int flags = IMREAD_COLOR,
+  Rect? roi,
+  int reduce = 1,
+  Mat? dst,
+}) async {
+  dst ??= Mat.empty();
+  final rect = roi ?? Rect(0, 0, 0, 0);
+  final p = _copyToNative(buf);
+  return cvRunAsync0(
+    (callback) => cimgcodecs.cv_imdecode_2(p, buf.length, flags, rect.ref, reduce, dst!.ref, callback),
+    (c) {
+      if (p != ffi.nullptr) malloc.free(p);
+      return c.complete(dst);
+    },
+  );
+}
+
+ffi.Pointer<ffi.Uint8> _copyToNative(Uint8List buf) {
+  if (buf.isEmpty) return ffi.nullptr;
+  final p = malloc<ffi.Uint8>(buf.length);
+  p.asTypedList(buf.length).setAll(0, buf);
+  return p;
+}
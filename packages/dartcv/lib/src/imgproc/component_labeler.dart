@@ -0,0 +1,129 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.imgproc.component_labeler;
+
+import 'dart:ffi' as ffi;
+
+import 'package:ffi/ffi.dart';
+
+import '../core/base.dart';
+import '../core/mat.dart';
+import '../g/imgproc.g.dart' as cvg;
+
+/// Row of [ComponentLabeler] stats holding the x of the centroid,
+/// rows 0-4 are the same as `CC_STAT_LEFT` ... `CC_STAT_AREA`.
+const int CC_STAT_CX = 5;
+
+/// Row of [ComponentLabeler] stats holding the y of the centroid.
+const int CC_STAT_CY = 6;
+
+/// Row of [ComponentLabeler] stats holding the mean intensity.
+const int CC_STAT_MEAN = 7;
+
+/// Streaming connected-components labeling that only produces per-component statistics.
+///
+/// The binary image is pushed as row strips of any height, components are labeled by
+/// union-find over the runs of consecutive rows and their statistics are accumulated
+/// during the labeling itself, so no label image is ever written and memory only depends
+/// on the image width. Components with area < [minArea] are dropped natively.
+///
+/// [finish] returns a columnar `8 x N` `CV_64F` [Mat], one column per component in raster
+/// order of its first pixel (the background is not included), with rows
+/// `CC_STAT_LEFT`, `CC_STAT_TOP`, `CC_STAT_WIDTH`, `CC_STAT_HEIGHT`, `CC_STAT_AREA`,
+/// [CC_STAT_CX], [CC_STAT_CY] and [CC_STAT_MEAN].
+class ComponentLabeler extends CvStruct<cvg.ComponentLabeler> {
+  ComponentLabeler._(cvg.ComponentLabelerPtr ptr, [bool attach = true]) : super.fromPointer(ptr) {
+    if (attach) {
+      finalizer.attach(this, ptr.cast(), detach: this);
+    }
+  }
+
+  factory ComponentLabeler.fromPointer(cvg.ComponentLabelerPtr ptr, [bool attach = true]) =>
+      ComponentLabeler._(ptr, attach);
+
+  /// [connectivity] is 4 or 8.
+  factory ComponentLabeler({int connectivity = 8, int minArea = 0}) {
+    final p = calloc<cvg.ComponentLabeler>();
+    cvRun(() => cvg.cv_ComponentLabeler_create(connectivity, minArea, p));
+    return ComponentLabeler._(p);
+  }
+
+  /// Computes the stats of a whole [image], see [push] and [finish].
+  static (int, Mat) compute(Mat image, {Mat? intensity, int connectivity = 8, int minArea = 0}) {
+    final labeler = ComponentLabeler(connectivity: connectivity, minArea: minArea);
+    labeler.push(image, intensity: intensity);
+    final rval = labeler.finish();
+    labeler.dispose();
+    return rval;
+  }
+
+  static final finalizer = OcvFinalizer<cvg.ComponentLabelerPtr>(cvg.addresses.cv_ComponentLabeler_close);
+
+  void dispose() {
+    finalizer.detach(this);
+    cvg.cv_ComponentLabeler_close(ptr);
+  }
+
+  @override
+  cvg.ComponentLabeler get ref => ptr.ref;
+
+  /// Labels the next rows of the image.
+  ///
+  /// [strip] is `CV_8UC1`, non-zero pixels are foreground, all strips of an image must
+  /// have the same width. [intensity] is an optional single channel [Mat] of the same
+  /// size as [strip] whose values are averaged per component.
+  void push(Mat strip, {Mat? intensity}) {
+    intensity ??= Mat.empty();
+    cvRun(() => cvg.cv_ComponentLabeler_push(ref, strip.ref, intensity!.ref, ffi.nullptr));
+  }
+
+  /// async version of [push]
+  Future<void> pushAsync(Mat strip, {Mat? intensity}) async {
+    intensity ??= Mat.empty();
+    return cvRunAsync0(
+      (callback) => cvg.cv_ComponentLabeler_push(ref, strip.ref, intensity!.ref, callback),
+      (c) => c.complete(),
+    );
+  }
+
+  /// Finishes the image and returns the number of components and their stats,
+  /// the labeler is then ready for the next image.
+  (int, Mat) finish() {
+    final stats = Mat.empty();
+    final p = calloc<ffi.Int>();
+    cvRun(() => cvg.cv_ComponentLabeler_finish(ref, stats.ref, p, ffi.nullptr));
+    final rval = p.value;
+    calloc.free(p);
+    return (rval, stats);
+  }
+
+  /// async version of [finish]
+  Future<(int, Mat)> finishAsync() async {
+    final stats = Mat.empty();
+    final p = calloc<ffi.Int>();
+    return cvRunAsync0((callback) => cvg.cv_ComponentLabeler_finish(ref, stats.ref, p, callback), (c) {
+      final rval = p.value;
+      calloc.free(p);
+      return c.complete((rval, stats));
+    });
+  }
+
+  /// Drops the current image.
+  void reset() => cvg.cv_ComponentLabeler_reset(ref);
+
+  int get connectivity => cvg.cv_ComponentLabeler_getConnectivity(ref);
+
+  int get minArea => cvg.cv_ComponentLabeler_getMinArea(ref);
+
+  set minArea(int value) => cvg.cv_ComponentLabeler_setMinArea(ref, value);
+
+  /// Number of rows pushed since the last [finish] or [reset].
+  int get rows => cvg.cv_ComponentLabeler_getRows(ref);
+
+  @override
+  String toString() {
+    return "ComponentLabeler(address=0x${ptr.address.toRadixString(16)})";
+  }
+}
@@ -0,0 +1,101 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.imgproc.image_pyramid;
+
+import 'dart:ffi' as ffi;
+import 'dart:math' as math;
+
+import 'package:ffi/ffi.dart';
+
+import '../core/base.dart';
+import '../core/mat.dart';
+import '../g/constants.g.dart';
+import '../g/imgproc.g.dart' as cvg;
+
+/// Image pyramid built once per frame and shared by pyramid-consuming wrappers,
+/// i.e., `calcOpticalFlowPyrLKPyramid`, `ORB.detectAndComputePyramid` and
+/// `CascadeClassifier.detectMultiScalePyramid`.
+///
+/// Level `i` is `scaleFactor^i` times smaller than the source (level 0). With
+/// [scaleFactor] == 2 the levels are the Gaussian pyramid of `pyrDown`, otherwise
+/// each level is resized from the source with [INTER_AREA], in parallel.
+///
+/// Every level is a ROI inside a buffer padded by [padding] pixels filled with
+/// [borderType], which is what `calcOpticalFlowPyrLK` requires (padding >= winSize),
+/// and the buffers are reused by the next [build] of a frame of the same size.
+class ImagePyramid extends CvStruct<cvg.ImagePyramid> {
+  ImagePyramid._(cvg.ImagePyramidPtr ptr, [bool attach = true]) : super.fromPointer(ptr) {
+    if (attach) {
+      finalizer.attach(this, ptr.cast(), detach: this);
+    }
+  }
+
+  factory ImagePyramid.fromPointer(cvg.ImagePyramidPtr ptr, [bool attach = true]) =>
+      ImagePyramid._(ptr, attach);
+
+  /// Creates a pyramid of [levels] levels, including the source.
+  factory ImagePyramid({
+    int levels = 4,
+    double scaleFactor = 2,
+    int padding = 21,
+    int borderType = BORDER_REFLECT_101,
+  }) {
+    final p = calloc<cvg.ImagePyramid>();
+    cvRun(() => cvg.cv_ImagePyramid_create(levels, scaleFactor, padding, borderType, p));
+    return ImagePyramid._(p);
+  }
+
+  static final finalizer = OcvFinalizer<cvg.ImagePyramidPtr>(cvg.addresses.cv_ImagePyramid_close);
+
+  void dispose() {
+    finalizer.detach(this);
+    cvg.cv_ImagePyramid_close(ptr);
+  }
+
+  @override
+  cvg.ImagePyramid get ref => ptr.ref;
+
+  /// Builds the pyramid of [src].
+  void build(Mat src) {
+    cvRun(() => cvg.cv_ImagePyramid_build(ref, src.ref, ffi.nullptr));
+  }
+
+  /// async version of [build]
+  Future<void> buildAsync(Mat src) async {
+    return cvRunAsync0((callback) => cvg.cv_ImagePyramid_build(ref, src.ref, callback), (c) => c.complete());
+  }
+
+  /// The levels of the last [build], the data is shared with the pyramid.
+  VecMat get levels {
+    final rval = VecMat();
+    cvRun(() => cvg.cv_ImagePyramid_getLevels(ref, rval.ptr));
+    return rval;
+  }
+
+  /// The [i]-th level of the last [build], the data is shared with the pyramid.
+  Mat level(int i) {
+    final rval = Mat.empty();
+    cvRun(() => cvg.cv_ImagePyramid_getLevel(ref, i, rval.ref));
+    return rval;
+  }
+
+  /// The scale of [level] relative to level 0.
+  double scale(int level) => math.pow(scaleFactor, level).toDouble();
+
+  int get numLevels => cvg.cv_ImagePyramid_getNumLevels(ref);
+
+  double get scaleFactor => cvg.cv_ImagePyramid_getScaleFactor(ref);
+
+  int get padding => cvg.cv_ImagePyramid_getPadding(ref);
+
+  int get borderType => cvg.cv_ImagePyramid_getBorderType(ref);
+
+  bool get isEmpty => cvg.cv_ImagePyramid_empty(ref);
+
+  @override
+  String toString() {
+    return "ImagePyramid(address=0x${ptr.address.toRadixString(16)})";
+  }
+}
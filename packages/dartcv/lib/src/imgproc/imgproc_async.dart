@@ -1807,6 +1807,77 @@ Future<Mat> warpPerspectiveAsync(
   );
 }
 
+/// Applies a batch of affine transformations to one source image.
+///
+/// The i-th crop is the same as `warpAffine(src, M[i], dsizes[i])`, [dsizes] either has
+/// one size per transform or a single size shared by all crops.
+///
+/// The crops are warped in parallel and each one only reads the region of [src]
+/// that its transform maps to, so extracting many small rotated crops from a large
+/// image does not touch the full image for every crop.
+Future<VecMat> warpAffineBatchAsync(
+  InputArray src,
+  VecMat M,
+  List<(int, int)> dsizes, {
+  VecMat? dst,
+  int flags = INTER_LINEAR,
+  int borderMode = BORDER_CONSTANT,
+  Scalar? borderValue,
+}) {
+  dst ??= VecMat();
+  borderValue ??= Scalar();
+  final sizes = VecI32.fromList([for (final s in dsizes) ...[s.$1, s.$2]]);
+  return cvRunAsync0(
+    (callback) => cimgproc.cv_warpAffineBatch(
+      src.ref,
+      M.ref,
+      sizes.ref,
+      flags,
+      borderMode,
+      borderValue!.ref,
+      dst!.ptr,
+      callback,
+    ),
+    (c) {
+      sizes.dispose();
+      return c.complete(dst);
+    },
+  );
+}
+
+/// Applies a batch of perspective transformations to one source image.
+///
+/// The i-th crop is the same as `warpPerspective(src, M[i], dsizes[i])`, see [warpAffineBatchAsync].
+Future<VecMat> warpPerspectiveBatchAsync(
+  InputArray src,
+  VecMat M,
+  List<(int, int)> dsizes, {
+  VecMat? dst,
+  int flags = INTER_LINEAR,
+  int borderMode = BORDER_CONSTANT,
+  Scalar? borderValue,
+}) {
+  dst ??= VecMat();
+  borderValue ??= Scalar();
+  final sizes = VecI32.fromList([for (final s in dsizes) ...[s.$1, s.$2]]);
+  return cvRunAsync0(
+    (callback) => cimgproc.cv_warpPerspectiveBatch(
+      src.ref,
+      M.ref,
+      sizes.ref,
+      flags,
+      borderMode,
+      borderValue!.ref,
+      dst!.ptr,
+      callback,
+    ),
+    (c) {
+      sizes.dispose();
+      return c.complete(dst);
+    },
+  );
+}
+
 /// Watershed performs a marker-based image segmentation using the watershed algorithm.
 ///
 /// For further details, please see:
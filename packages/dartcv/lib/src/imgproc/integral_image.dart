@@ -0,0 +1,194 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.imgproc.integral_image;
+
+import 'dart:ffi' as ffi;
+
+import 'package:ffi/ffi.dart';
+
+import '../core/base.dart';
+import '../core/mat.dart';
+import '../core/rect.dart';
+import '../core/size.dart';
+import '../core/vec.dart';
+import '../g/imgproc.g.dart' as cvg;
+
+/// Integral image query engine.
+///
+/// Owns the integral, squared integral and optionally the tilted integral (all `CV_64F`)
+/// of an image and answers batches of box sum/mean/variance queries in one native call,
+/// instead of reading the integral element by element.
+///
+/// Results of batch queries contain [channels] values per rectangle, i.e.,
+/// `[rect0_ch0, rect0_ch1, ..., rect1_ch0, ...]`.
+class IntegralImage extends CvStruct<cvg.IntegralImage> {
+  IntegralImage._(cvg.IntegralImagePtr ptr, [bool attach = true]) : super.fromPointer(ptr) {
+    if (attach) {
+      finalizer.attach(this, ptr.cast(), detach: this);
+    }
+  }
+
+  factory IntegralImage.fromPointer(cvg.IntegralImagePtr ptr, [bool attach = true]) =>
+      IntegralImage._(ptr, attach);
+
+  /// Creates an empty engine, call [compute] before querying.
+  ///
+  /// The tilted integral is only computed if [tilted] is true.
+  factory IntegralImage.empty({bool tilted = false}) {
+    final p = calloc<cvg.IntegralImage>();
+    cvRun(() => cvg.cv_IntegralImage_create(tilted, p));
+    return IntegralImage._(p);
+  }
+
+  /// Creates an engine and computes the integrals of [src].
+  factory IntegralImage(InputArray src, {bool tilted = false}) {
+    final integral = IntegralImage.empty(tilted: tilted);
+    integral.compute(src);
+    return integral;
+  }
+
+  static final finalizer = OcvFinalizer<cvg.IntegralImagePtr>(cvg.addresses.cv_IntegralImage_close);
+
+  void dispose() {
+    finalizer.detach(this);
+    cvg.cv_IntegralImage_close(ptr);
+  }
+
+  @override
+  cvg.IntegralImage get ref => ptr.ref;
+
+  /// Recomputes the integrals of [src], the buffers are reused if the size does not change.
+  void compute(InputArray src) {
+    cvRun(() => cvg.cv_IntegralImage_compute(ref, src.ref, ffi.nullptr));
+  }
+
+  /// async version of [compute]
+  Future<void> computeAsync(InputArray src) async {
+    return cvRunAsync0(
+      (callback) => cvg.cv_IntegralImage_compute(ref, src.ref, callback),
+      (c) => c.complete(),
+    );
+  }
+
+  /// Sums of the pixels inside every rectangle.
+  VecF64 sum(VecRect rects) {
+    final rval = VecF64();
+    cvRun(() => cvg.cv_IntegralImage_sum(ref, rects.ref, rval.ptr, ffi.nullptr));
+    return rval;
+  }
+
+  /// async version of [sum]
+  Future<VecF64> sumAsync(VecRect rects) async {
+    final rval = VecF64();
+    return cvRunAsync0(
+      (callback) => cvg.cv_IntegralImage_sum(ref, rects.ref, rval.ptr, callback),
+      (c) => c.complete(rval),
+    );
+  }
+
+  /// Means of the pixels inside every rectangle, rectangles must not be empty.
+  VecF64 mean(VecRect rects) {
+    final rval = VecF64();
+    cvRun(() => cvg.cv_IntegralImage_mean(ref, rects.ref, rval.ptr, ffi.nullptr));
+    return rval;
+  }
+
+  /// async version of [mean]
+  Future<VecF64> meanAsync(VecRect rects) async {
+    final rval = VecF64();
+    return cvRunAsync0(
+      (callback) => cvg.cv_IntegralImage_mean(ref, rects.ref, rval.ptr, callback),
+      (c) => c.complete(rval),
+    );
+  }
+
+  /// Variances of the pixels inside every rectangle, rectangles must not be empty.
+  VecF64 variance(VecRect rects) {
+    final rval = VecF64();
+    cvRun(() => cvg.cv_IntegralImage_variance(ref, rects.ref, rval.ptr, ffi.nullptr));
+    return rval;
+  }
+
+  /// async version of [variance]
+  Future<VecF64> varianceAsync(VecRect rects) async {
+    final rval = VecF64();
+    return cvRunAsync0(
+      (callback) => cvg.cv_IntegralImage_variance(ref, rects.ref, rval.ptr, callback),
+      (c) => c.complete(rval),
+    );
+  }
+
+  /// Sums of 45 degree rotated rectangles, requires `tilted = true`.
+  ///
+  /// `(x, y)` of a rectangle is its top corner, `width` and `height` are the lengths
+  /// along the two diagonals, the same as the tilted Haar features.
+  VecF64 tiltedSum(VecRect rects) {
+    final rval = VecF64();
+    cvRun(() => cvg.cv_IntegralImage_tiltedSum(ref, rects.ref, rval.ptr, ffi.nullptr));
+    return rval;
+  }
+
+  /// async version of [tiltedSum]
+  Future<VecF64> tiltedSumAsync(VecRect rects) async {
+    final rval = VecF64();
+    return cvRunAsync0(
+      (callback) => cvg.cv_IntegralImage_tiltedSum(ref, rects.ref, rval.ptr, callback),
+      (c) => c.complete(rval),
+    );
+  }
+
+  /// Dense sum/mean/variance of every [ksize] window with stride 1.
+  ///
+  /// [op] is one of [OP_SUM], [OP_MEAN] and [OP_VARIANCE], the result is a
+  /// `(width - kw + 1) x (height - kh + 1)` `CV_64F` Mat with the same channels as the source.
+  Mat windows((int, int) ksize, {int op = OP_SUM, OutputArray? dst}) {
+    dst ??= Mat.empty();
+    cvRun(() => cvg.cv_IntegralImage_windows(ref, ksize.cvd.ref, op, dst!.ref, ffi.nullptr));
+    return dst;
+  }
+
+  /// async version of [windows]
+  Future<Mat> windowsAsync((int, int) ksize, {int op = OP_SUM, OutputArray? dst}) async {
+    dst ??= Mat.empty();
+    return cvRunAsync0(
+      (callback) => cvg.cv_IntegralImage_windows(ref, ksize.cvd.ref, op, dst!.ref, callback),
+      (c) => c.complete(dst),
+    );
+  }
+
+  /// The integral image, `(H+1) x (W+1)`, the data is shared with the engine.
+  Mat get sumImage {
+    final m = Mat.empty();
+    cvRun(() => cvg.cv_IntegralImage_getSum(ref, m.ref));
+    return m;
+  }
+
+  /// The integral of squared pixel values, the data is shared with the engine.
+  Mat get sqsumImage {
+    final m = Mat.empty();
+    cvRun(() => cvg.cv_IntegralImage_getSqsum(ref, m.ref));
+    return m;
+  }
+
+  /// The tilted integral, empty if it is not computed, the data is shared with the engine.
+  Mat get tiltedImage {
+    final m = Mat.empty();
+    cvRun(() => cvg.cv_IntegralImage_getTilted(ref, m.ref));
+    return m;
+  }
+
+  bool get isEmpty => cvg.cv_IntegralImage_empty(ref);
+
+  int get channels => cvg.cv_IntegralImage_channels(ref);
+
+  @override
+  String toString() {
+    return "IntegralImage(address=0x${ptr.address.toRadixString(16)})";
+  }
+
+  static const int OP_SUM = 0;
+  static const int OP_MEAN = 1;
+  static const int OP_VARIANCE = 2;
+}
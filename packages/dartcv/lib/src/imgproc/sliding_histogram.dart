@@ -0,0 +1,150 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.imgproc.sliding_histogram;
+
+import 'dart:ffi' as ffi;
+
+import 'package:ffi/ffi.dart';
+
+import '../core/base.dart';
+import '../core/mat.dart';
+import '../core/vec.dart';
+import '../g/imgproc.g.dart' as cvg;
+
+/// Running histogram of the last [window] frames of a video stream.
+///
+/// Each pushed frame is divided into a `grid` of cells and one histogram per cell is
+/// computed with the same [channels], [histSize] and [ranges] as `calcHist`. The running
+/// histograms are updated by adding the new frame and subtracting the evicted one, so
+/// old frames are never scanned again.
+class SlidingHistogram extends CvStruct<cvg.SlidingHistogram> {
+  SlidingHistogram._(cvg.SlidingHistogramPtr ptr, [bool attach = true]) : super.fromPointer(ptr) {
+    if (attach) {
+      finalizer.attach(this, ptr.cast(), detach: this);
+    }
+  }
+
+  factory SlidingHistogram.fromPointer(cvg.SlidingHistogramPtr ptr, [bool attach = true]) =>
+      SlidingHistogram._(ptr, attach);
+
+  /// Creates a sliding-window histogram.
+  ///
+  /// [ranges] contains the lower and upper boundaries of every dimension, i.e.,
+  /// `2 * histSize.length` values, [grid] is `(cols, rows)` of the cells.
+  factory SlidingHistogram(
+    List<int> channels,
+    List<int> histSize,
+    List<double> ranges, {
+    int window = 30,
+    (int, int) grid = (1, 1),
+  }) {
+    final p = calloc<cvg.SlidingHistogram>();
+    final vchannels = VecI32.fromList(channels);
+    final vhistSize = VecI32.fromList(histSize);
+    final vranges = VecF32.fromList(ranges);
+    cvRun(
+      () => cvg.cv_SlidingHistogram_create(
+        vchannels.ref,
+        vhistSize.ref,
+        vranges.ref,
+        window,
+        grid.$1,
+        grid.$2,
+        p,
+      ),
+    );
+    vchannels.dispose();
+    vhistSize.dispose();
+    vranges.dispose();
+    return SlidingHistogram._(p);
+  }
+
+  static final finalizer = OcvFinalizer<cvg.SlidingHistogramPtr>(cvg.addresses.cv_SlidingHistogram_close);
+
+  void dispose() {
+    finalizer.detach(this);
+    cvg.cv_SlidingHistogram_close(ptr);
+  }
+
+  @override
+  cvg.SlidingHistogram get ref => ptr.ref;
+
+  /// Adds the histograms of [frame], the oldest frame is evicted when the window is full.
+  ///
+  /// [mask] is an optional 8-bit mask of the same size as [frame].
+  void push(InputArray frame, {InputArray? mask}) {
+    mask ??= Mat.empty();
+    cvRun(() => cvg.cv_SlidingHistogram_push(ref, frame.ref, mask!.ref, ffi.nullptr));
+  }
+
+  /// async version of [push]
+  Future<void> pushAsync(InputArray frame, {InputArray? mask}) async {
+    mask ??= Mat.empty();
+    return cvRunAsync0(
+      (callback) => cvg.cv_SlidingHistogram_push(ref, frame.ref, mask!.ref, callback),
+      (c) => c.complete(),
+    );
+  }
+
+  /// Gets the running histogram (`CV_32F`) of a [cell], or of the whole frame if [cell] < 0.
+  ///
+  /// Cells are indexed in row-major order.
+  Mat hist({int cell = -1, OutputArray? dst}) {
+    dst ??= Mat.empty();
+    cvRun(() => cvg.cv_SlidingHistogram_getHist(ref, cell, dst!.ref, ffi.nullptr));
+    return dst;
+  }
+
+  /// async version of [hist]
+  Future<Mat> histAsync({int cell = -1, OutputArray? dst}) async {
+    dst ??= Mat.empty();
+    return cvRunAsync0(
+      (callback) => cvg.cv_SlidingHistogram_getHist(ref, cell, dst!.ref, callback),
+      (c) => c.complete(dst),
+    );
+  }
+
+  /// Compares [reference] with the running histogram of every cell,
+  /// see `compareHist` for [method].
+  ///
+  /// Returns one score per cell.
+  List<double> compare(InputArray reference, int method) {
+    final scores = VecF64();
+    cvRun(() => cvg.cv_SlidingHistogram_compare(ref, reference.ref, method, scores.ptr, ffi.nullptr));
+    final rval = scores.toList();
+    scores.dispose();
+    return rval;
+  }
+
+  /// async version of [compare]
+  Future<List<double>> compareAsync(InputArray reference, int method) async {
+    final scores = VecF64();
+    return cvRunAsync0(
+      (callback) => cvg.cv_SlidingHistogram_compare(ref, reference.ref, method, scores.ptr, callback),
+      (c) {
+        final rval = scores.toList();
+        scores.dispose();
+        return c.complete(rval);
+      },
+    );
+  }
+
+  /// Drops all frames in the window.
+  void reset() => cvg.cv_SlidingHistogram_reset(ref);
+
+  /// Maximum number of frames in the window.
+  int get window => cvg.cv_SlidingHistogram_getWindow(ref);
+
+  /// Number of frames currently in the window.
+  int get count => cvg.cv_SlidingHistogram_getCount(ref);
+
+  /// Number of grid cells.
+  int get numCells => cvg.cv_SlidingHistogram_getNumCells(ref);
+
+  @override
+  String toString() {
+    return "SlidingHistogram(address=0x${ptr.address.toRadixString(16)})";
+  }
+}
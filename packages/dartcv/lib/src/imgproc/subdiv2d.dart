@@ -256,6 +256,62 @@ class Subdiv2D extends CvStruct<cvg.Subdiv2D> {
     return rval;
   }
 
+  /// Inserts points given as a flat `[x0, y0, x1, y1, ...]` list.
+  ///
+  /// The points are inserted in Hilbert curve order so that every point location starts
+  /// next to the previous insertion, which is much faster than [insertVec] for large
+  /// unordered sets. Returns the vertex id of every point, in input order.
+  ///
+  /// Throws before inserting anything if a point is outside the rect.
+  VecI32 insertBulk(VecF32 xy) {
+    final rval = VecI32();
+    cvRun(() => cimgproc.cv_Subdiv2D_insertBulk(ref, xy.ref, rval.ptr, ffi.nullptr));
+    return rval;
+  }
+
+  /// Returns the triangles as 3 vertex ids each, `[a0, b0, c0, a1, b1, c1, ...]`.
+  ///
+  /// Same triangles as [getTriangleList], use [getVertex] to get the coordinates.
+  VecI32 getTriangleIndices() {
+    final rval = VecI32();
+    cvRun(() => cimgproc.cv_Subdiv2D_getTriangleIndices(ref, rval.ptr, ffi.nullptr));
+    return rval;
+  }
+
+  /// Flat version of [getVoronoiFacetList].
+  ///
+  /// [facets] holds the x, y of all facet points, facet `i` is the points
+  /// `offsets[i]` to `offsets[i + 1]`, [centers] holds the x, y of every facet center.
+  (VecF32 facets, VecI32 offsets, VecF32 centers) getVoronoiFacetListFlat(VecI32 idx) {
+    final facets = VecF32();
+    final offsets = VecI32();
+    final centers = VecF32();
+    cvRun(
+      () => cimgproc.cv_Subdiv2D_getVoronoiFacetListFlat(
+        ref,
+        idx.ref,
+        facets.ptr,
+        offsets.ptr,
+        centers.ptr,
+        ffi.nullptr,
+      ),
+    );
+    return (facets, offsets, centers);
+  }
+
+  /// Moves [vertices] to the new positions in [xy] (`[x0, y0, x1, y1, ...]`), vertex ids are kept.
+  ///
+  /// A vertex that stays inside the polygon of its neighbours is moved in place and the
+  /// triangulation is repaired by edge flips around it, otherwise the whole subdivision
+  /// is rebuilt. Returns true if it was rebuilt.
+  bool movePoints(VecI32 vertices, VecF32 xy) {
+    final p = calloc<ffi.Bool>();
+    cvRun(() => cimgproc.cv_Subdiv2D_movePoints(ref, vertices.ref, xy.ref, p, ffi.nullptr));
+    final rval = p.value;
+    calloc.free(p);
+    return rval;
+  }
+
   @override
   cvg.Subdiv2D get ref => ptr.ref;
 
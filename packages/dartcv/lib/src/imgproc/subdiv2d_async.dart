@@ -255,4 +255,53 @@ extension Subdiv2DAsync on Subdiv2D {
       return c.complete(rval);
     });
   }
+
+  /// async version of [insertBulk]
+  Future<VecI32> insertBulkAsync(VecF32 xy) async {
+    final rval = VecI32();
+    return cvRunAsync0((callback) => cimgproc.cv_Subdiv2D_insertBulk(ref, xy.ref, rval.ptr, callback), (c) {
+      return c.complete(rval);
+    });
+  }
+
+  /// async version of [getTriangleIndices]
+  Future<VecI32> getTriangleIndicesAsync() async {
+    final rval = VecI32();
+    return cvRunAsync0((callback) => cimgproc.cv_Subdiv2D_getTriangleIndices(ref, rval.ptr, callback), (c) {
+      return c.complete(rval);
+    });
+  }
+
+  /// async version of [getVoronoiFacetListFlat]
+  Future<(VecF32 facets, VecI32 offsets, VecF32 centers)> getVoronoiFacetListFlatAsync(VecI32 idx) async {
+    final facets = VecF32();
+    final offsets = VecI32();
+    final centers = VecF32();
+    return cvRunAsync0(
+      (callback) => cimgproc.cv_Subdiv2D_getVoronoiFacetListFlat(
+        ref,
+        idx.ref,
+        facets.ptr,
+        offsets.ptr,
+        centers.ptr,
+        callback,
+      ),
+      (c) {
+        return c.complete((facets, offsets, centers));
+      },
+    );
+  }
+
+  /// async version of [movePoints]
+  Future<bool> movePointsAsync(VecI32 vertices, VecF32 xy) async {
+    final p = calloc<ffi.Bool>();
+    return cvRunAsync0(
+      (callback) => cimgproc.cv_Subdiv2D_movePoints(ref, vertices.ref, xy.ref, p, callback),
+      (c) {
+        final rval = p.value;
+        calloc.free(p);
+        return c.complete(rval);
+      },
+    );
+  }
 }
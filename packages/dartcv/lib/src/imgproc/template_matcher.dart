@@ -0,0 +1,138 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.imgproc.template_matcher;
+
+import 'dart:ffi' as ffi;
+
+import 'package:ffi/ffi.dart';
+
+import '../core/base.dart';
+import '../core/mat.dart';
+import '../core/rect.dart';
+import '../core/vec.dart';
+import '../g/constants.g.dart';
+import '../g/core.g.dart' as ccore;
+import '../g/imgproc.g.dart' as cvg;
+
+/// Coarse-to-fine template matcher over multiple scales and rotations.
+///
+/// The scaled/rotated templates and their pyramids are built once by the constructor.
+/// For every image, the full `matchTemplate` correlation only runs at the coarsest
+/// pyramid level, then the best [topK] candidates of every scale/rotation are refined
+/// level by level inside small windows.
+///
+/// Use more [levels] and a smaller [topK] for speed, fewer levels and a larger [topK]
+/// for accuracy.
+class TemplateMatcher extends CvStruct<cvg.TemplateMatcher> {
+  TemplateMatcher._(cvg.TemplateMatcherPtr ptr, [bool attach = true]) : super.fromPointer(ptr) {
+    if (attach) {
+      finalizer.attach(this, ptr.cast(), detach: this);
+    }
+  }
+
+  factory TemplateMatcher.fromPointer(cvg.TemplateMatcherPtr ptr, [bool attach = true]) =>
+      TemplateMatcher._(ptr, attach);
+
+  /// Creates a matcher for [templ].
+  ///
+  /// [scales] and [angles] (degrees, clockwise, the same as [RotatedRect.angle]) define the
+  /// searched variants of the template, [method] must be one of [TM_SQDIFF_NORMED],
+  /// [TM_CCORR_NORMED] or [TM_CCOEFF_NORMED], [levels] is the number of pyramid levels
+  /// (1 disables the pyramid).
+  factory TemplateMatcher(
+    InputArray templ, {
+    List<double> scales = const [1.0],
+    List<double> angles = const [0.0],
+    int method = TM_CCOEFF_NORMED,
+    int levels = 3,
+    int topK = 5,
+  }) {
+    final p = calloc<cvg.TemplateMatcher>();
+    final vscales = VecF64.fromList(scales);
+    final vangles = VecF64.fromList(angles);
+    cvRun(() => cvg.cv_TemplateMatcher_create(templ.ref, vscales.ref, vangles.ref, method, levels, topK, p));
+    vscales.dispose();
+    vangles.dispose();
+    return TemplateMatcher._(p);
+  }
+
+  static final finalizer = OcvFinalizer<cvg.TemplateMatcherPtr>(cvg.addresses.cv_TemplateMatcher_close);
+
+  void dispose() {
+    finalizer.detach(this);
+    cvg.cv_TemplateMatcher_close(ptr);
+  }
+
+  @override
+  cvg.TemplateMatcher get ref => ptr.ref;
+
+  /// Finds at most [maxMatches] (all if <= 0) non-overlapping matches in [image].
+  ///
+  /// [threshold] is in the domain of [method], i.e., the maximum score for
+  /// [TM_SQDIFF_NORMED] and the minimum score for the others.
+  ///
+  /// Returns the boxes of the matches (centered on the match, with the size of the scaled
+  /// template and the rotation angle) and their scores, sorted from best to worst.
+  (List<RotatedRect> boxes, List<double> scores) match(
+    InputArray image, {
+    double threshold = 0.8,
+    int maxMatches = 0,
+  }) {
+    final boxes = ccore.std_VecRotatedRect_new(0);
+    final scores = VecF32();
+    cvRun(
+      () => cvg.cv_TemplateMatcher_match(
+        ref,
+        image.ref,
+        threshold,
+        maxMatches,
+        boxes,
+        scores.ptr,
+        ffi.nullptr,
+      ),
+    );
+    final rval = (_toList(boxes), scores.toList());
+    scores.dispose();
+    return rval;
+  }
+
+  /// async version of [match]
+  Future<(List<RotatedRect> boxes, List<double> scores)> matchAsync(
+    InputArray image, {
+    double threshold = 0.8,
+    int maxMatches = 0,
+  }) async {
+    final boxes = ccore.std_VecRotatedRect_new(0);
+    final scores = VecF32();
+    return cvRunAsync0(
+      (callback) =>
+          cvg.cv_TemplateMatcher_match(ref, image.ref, threshold, maxMatches, boxes, scores.ptr, callback),
+      (c) {
+        final rval = (_toList(boxes), scores.toList());
+        scores.dispose();
+        return c.complete(rval);
+      },
+    );
+  }
+
+  static List<RotatedRect> _toList(ffi.Pointer<cvg.VecRotatedRect> vec) {
+    final length = ccore.std_VecRotatedRect_length(vec);
+    final rval = List.generate(length, (i) => RotatedRect.fromNative(ccore.std_VecRotatedRect_get(vec, i)));
+    ccore.std_VecRotatedRect_free(vec);
+    return rval;
+  }
+
+  int get method => cvg.cv_TemplateMatcher_getMethod(ref);
+
+  int get levels => cvg.cv_TemplateMatcher_getLevels(ref);
+
+  /// Number of candidates refined per scale/rotation, fixed at construction.
+  int get topK => cvg.cv_TemplateMatcher_getTopK(ref);
+
+  @override
+  String toString() {
+    return "TemplateMatcher(address=0x${ptr.address.toRadixString(16)})";
+  }
+}
@@ -0,0 +1,98 @@
+// Copyright (c) 2026, rainyl and all contributors. All rights reserved.
+// Use of this source code is governed by a Apache-2.0 license
+// that can be found in the LICENSE file.
+
+library cv.imgproc.video_clahe;
+
+import 'dart:ffi' as ffi;
+
+import 'package:ffi/ffi.dart';
+
+import '../core/base.dart';
+import '../core/mat.dart';
+import '../core/size.dart';
+import '../g/imgproc.g.dart' as cvg;
+
+/// CLAHE for video streams.
+///
+/// Same algorithm as `CLAHE`, but tile histograms are computed in parallel, the buffers
+/// are reused between frames, and the clipped tile mappings are smoothed over time:
+/// `lut = smoothing * lutPrevious + (1 - smoothing) * lutCurrent`, which avoids the flicker
+/// of per-frame equalization. With [smoothing] == 0 the output is the same as `CLAHE.apply`.
+///
+/// The state is reset automatically when the frame size or type changes, call [reset] on
+/// scene cuts.
+class VideoCLAHE extends CvStruct<cvg.VideoCLAHE> {
+  VideoCLAHE._(cvg.VideoCLAHEPtr ptr, [bool attach = true]) : super.fromPointer(ptr) {
+    if (attach) {
+      finalizer.attach(this, ptr.cast(), detach: this);
+    }
+  }
+
+  factory VideoCLAHE.fromPointer(cvg.VideoCLAHEPtr ptr, [bool attach = true]) => VideoCLAHE._(ptr, attach);
+
+  /// [clipLimit] and [tileGridSize] are the same as `createCLAHE`, [smoothing] in `[0, 1)`
+  /// is the weight of the previous frames' tile mappings.
+  factory VideoCLAHE({
+    double clipLimit = 40,
+    (int width, int height) tileGridSize = (8, 8),
+    double smoothing = 0.8,
+  }) {
+    final p = calloc<cvg.VideoCLAHE>();
+    cvRun(() => cvg.cv_VideoCLAHE_create(clipLimit, tileGridSize.cvd.ref, smoothing, p));
+    return VideoCLAHE._(p);
+  }
+
+  static final finalizer = OcvFinalizer<cvg.VideoCLAHEPtr>(cvg.addresses.cv_VideoCLAHE_close);
+
+  void dispose() {
+    finalizer.detach(this);
+    cvg.cv_VideoCLAHE_close(ptr);
+  }
+
+  @override
+  cvg.VideoCLAHE get ref => ptr.ref;
+
+  /// Equalizes [src] (`CV_8UC1` or `CV_16UC1`) and updates the smoothed tile mappings,
+  /// [dst] may be [src].
+  Mat apply(Mat src, {Mat? dst}) {
+    dst ??= Mat.empty();
+    cvRun(() => cvg.cv_VideoCLAHE_apply(ref, src.ref, dst!.ref, ffi.nullptr));
+    return dst;
+  }
+
+  /// async version of [apply]
+  Future<Mat> applyAsync(Mat src, {Mat? dst}) async {
+    dst ??= Mat.empty();
+    return cvRunAsync0((callback) => cvg.cv_VideoCLAHE_apply(ref, src.ref, dst!.ref, callback), (c) {
+      return c.complete(dst);
+    });
+  }
+
+  /// Forgets the tile mappings of previous frames.
+  void reset() => cvg.cv_VideoCLAHE_reset(ref);
+
+  double get clipLimit => cvg.cv_VideoCLAHE_getClipLimit(ref);
+
+  set clipLimit(double value) => cvg.cv_VideoCLAHE_setClipLimit(ref, value);
+
+  double get smoothing => cvg.cv_VideoCLAHE_getSmoothing(ref);
+
+  set smoothing(double value) => cvRun(() => cvg.cv_VideoCLAHE_setSmoothing(ref, value));
+
+  (int width, int height) get tilesGridSize {
+    final p = calloc<cvg.CvSize>();
+    cvRun(() => cvg.cv_VideoCLAHE_getTilesGridSize(ref, p));
+    final rval = (p.ref.width, p.ref.height);
+    calloc.free(p);
+    return rval;
+  }
+
+  /// Number of frames accumulated since the last reset.
+  int get frames => cvg.cv_VideoCLAHE_getFrames(ref);
+
+  @override
+  String toString() {
+    return "VideoCLAHE(address=0x${ptr.address.toRadixString(16)})";
+  }
+}
@@ -19,6 +19,7 @@ import '../core/size.dart';
 import '../core/vec.dart';
 import '../g/objdetect.g.dart' as cvg;
 import '../g/objdetect.g.dart' as cobjdetect;
+import '../imgproc/image_pyramid.dart';
 
 class CascadeClassifier extends CvStruct<cvg.CascadeClassifier> {
   CascadeClassifier._(cvg.CascadeClassifierPtr ptr, [bool attach = true]) : super.fromPointer(ptr) {
@@ -145,6 +146,30 @@ class CascadeClassifier extends CvStruct<cvg.CascadeClassifier> {
     return (objects, rejectLevels, levelWeights);
   }
 
+  /// Detects objects on the levels of a prebuilt [ImagePyramid] instead of resizing
+  /// [image] for every scale, so the pyramid can be shared with other detectors.
+  ///
+  /// Every level is scanned at the classifier window size only, i.e., the scale step is
+  /// [ImagePyramid.scaleFactor], detections are mapped back to level 0 and grouped with
+  /// [minNeighbors] the same way as [detectMultiScale].
+  VecRect detectMultiScalePyramid(ImagePyramid pyramid, {int minNeighbors = 3, int flags = 0}) {
+    final ret = VecRect();
+    final levels = pyramid.levels;
+    cvRun(
+      () => cobjdetect.cv_CascadeClassifier_detectMultiScalePyramid(
+        ref,
+        levels.ref,
+        pyramid.scaleFactor,
+        ret.ptr,
+        minNeighbors,
+        flags,
+        ffi.nullptr,
+      ),
+    );
+    levels.dispose();
+    return ret;
+  }
+
   /// Checks whether the classifier has been loaded.
   ///
   /// https://docs.opencv.org/4.x/d1/de5/classcv_1_1CascadeClassifier.html#a1753ebe58554fe0673ce46cb4e83f08a
@@ -15,6 +15,7 @@ import '../core/rect.dart';
 import '../core/size.dart';
 import '../core/vec.dart';
 import '../g/objdetect.g.dart' as cobjdetect;
+import '../imgproc/image_pyramid.dart';
 import './objdetect.dart';
 
 extension CascadeClassifierAsync on CascadeClassifier {
@@ -106,6 +107,32 @@ extension CascadeClassifierAsync on CascadeClassifier {
       },
     );
   }
+
+  /// Detects objects on the levels of a prebuilt [ImagePyramid] instead of resizing
+  /// the image for every scale, so the pyramid can be shared with other detectors.
+  ///
+  /// Every level is scanned at the classifier window size only, i.e., the scale step is
+  /// [ImagePyramid.scaleFactor], detections are mapped back to level 0 and grouped with
+  /// [minNeighbors] the same way as `detectMultiScale`.
+  Future<VecRect> detectMultiScalePyramidAsync(ImagePyramid pyramid, {int minNeighbors = 3, int flags = 0}) {
+    final ret = VecRect();
+    final levels = pyramid.levels;
+    return cvRunAsync0(
+      (callback) => cobjdetect.cv_CascadeClassifier_detectMultiScalePyramid(
+        ref,
+        levels.ref,
+        pyramid.scaleFactor,
+        ret.ptr,
+        minNeighbors,
+        flags,
+        callback,
+      ),
+      (c) {
+        levels.dispose();
+        return c.complete(ret);
+      },
+    );
+  }
 }
 
 extension HOGDescriptorAsync on HOGDescriptor {
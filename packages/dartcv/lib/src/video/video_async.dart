@@ -5,6 +5,7 @@
 library cv.video;
 
 import 'dart:ffi' as ffi;
+import 'dart:math' as math;
 
 import 'package:ffi/ffi.dart';
 
@@ -19,6 +20,7 @@ import '../core/vec.dart';
 import '../g/constants.g.dart';
 import '../g/video.g.dart' as cvg;
 import '../g/video.g.dart' as cvideo;
+import '../imgproc/image_pyramid.dart';
 import 'video.dart';
 
 extension BackgroundSubtractorMOG2Async on BackgroundSubtractorMOG2 {
@@ -128,6 +130,60 @@ Future<(VecPoint2f nextPts, VecUChar status, VecF32 error)> calcOpticalFlowPyrLK
   );
 }
 
+/// Same as `calcOpticalFlowPyrLK` but with pyramids built once per frame by [ImagePyramid],
+/// so they can be shared with other detectors instead of being rebuilt here.
+///
+/// The pyramids must have [ImagePyramid.scaleFactor] == 2 and [ImagePyramid.padding] >= [winSize],
+/// [maxLevel] is clipped to the number of levels.
+Future<(VecPoint2f nextPts, VecUChar status, VecF32 error)> calcOpticalFlowPyrLKPyramidAsync(
+  ImagePyramid prevPyramid,
+  ImagePyramid nextPyramid,
+  VecPoint2f prevPts,
+  VecPoint2f nextPts, {
+  VecUChar? status,
+  VecF32? err,
+  (int, int) winSize = (21, 21),
+  int maxLevel = 3,
+  (int, int, double) criteria = (TERM_COUNT + TERM_EPS, 30, 1e-4),
+  int flags = 0,
+  double minEigThreshold = 1e-4,
+}) {
+  for (final (name, pyramid) in [("prevPyramid", prevPyramid), ("nextPyramid", nextPyramid)]) {
+    // calcOpticalFlowPyrLK assumes a factor of 2 between levels and reads up to winSize outside
+    if (pyramid.scaleFactor != 2) {
+      throw ArgumentError.value(pyramid.scaleFactor, "$name.scaleFactor", "must be 2");
+    }
+    if (pyramid.padding < math.max(winSize.$1, winSize.$2)) {
+      throw ArgumentError.value(pyramid.padding, "$name.padding", "must be >= winSize $winSize");
+    }
+  }
+  status ??= VecUChar();
+  err ??= VecF32();
+  final prevPyr = prevPyramid.levels;
+  final nextPyr = nextPyramid.levels;
+  return cvRunAsync0(
+    (callback) => cvideo.cv_calcOpticalFlowPyrLK_2(
+      prevPyr.ref,
+      nextPyr.ref,
+      prevPts.ref,
+      nextPts.ptr,
+      status!.ptr,
+      err!.ptr,
+      winSize.cvd.ref,
+      maxLevel,
+      criteria.toTermCriteria().ref,
+      flags,
+      minEigThreshold,
+      callback,
+    ),
+    (c) {
+      prevPyr.dispose();
+      nextPyr.dispose();
+      return c.complete((nextPts, status!, err!));
+    },
+  );
+}
+
 /// FindTransformECC finds the geometric transform (warp) between two images in terms of the ECC criterion.
 ///
 /// For futther details, please see:
@@ -0,0 +1,216 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/calib3d/remap_cache.h"
+
+namespace cvd {
+
+// keys are kept as CV_64F deep copies, so callers may modify their matrices freely
+static std::vector<cv::Mat> makeKey(std::initializer_list<cv::Mat> mats) {
+    std::vector<cv::Mat> key;
+    for (const auto& m : mats) {
+        cv::Mat m64;
+        if (!m.empty()) m.convertTo(m64, CV_64F);
+        key.push_back(m64);
+    }
+    return key;
+}
+
+static bool sameKeyMat(const cv::Mat& a, const cv::Mat& b) {
+    if (a.empty() || b.empty()) return a.empty() == b.empty();
+    if (a.size() != b.size() || a.channels() != b.channels()) return false;
+    return cv::norm(a, b, cv::NORM_INF) == 0;
+}
+
+RemapCache::RemapCache(int interpolation, int borderMode, const cv::Scalar& borderValue) :
+    interpolation(interpolation), borderMode(borderMode), borderValue(borderValue) {}
+
+bool RemapCache::hit(Kind kind, const std::vector<cv::Mat>& key, cv::Size size, int flags)
+    const {
+    if (map1_.empty() || kind != kind_ || size != keySize_ || flags != keyFlags_) return false;
+    if (key.size() != key_.size()) return false;
+    for (size_t i = 0; i < key.size(); i++) {
+        if (!sameKeyMat(key[i], key_[i])) return false;
+    }
+    return true;
+}
+
+void RemapCache::store(Kind kind, const std::vector<cv::Mat>& key, cv::Size size, int flags) {
+    kind_ = kind;
+    keySize_ = size;
+    keyFlags_ = flags;
+    key_ = key;
+}
+
+bool RemapCache::initUndistortRectifyMap(
+    const cv::Mat& cameraMatrix,
+    const cv::Mat& distCoeffs,
+    const cv::Mat& R,
+    const cv::Mat& newCameraMatrix,
+    cv::Size size
+) {
+    auto key = makeKey({cameraMatrix, distCoeffs, R, newCameraMatrix});
+    if (hit(UNDISTORT, key, size, 0)) return false;
+    // CV_16SC2 + CV_16UC1 is what cv::convertMaps produces, initUndistortRectifyMap
+    // can emit it directly without going through a float map first.
+    cv::initUndistortRectifyMap(
+        cameraMatrix, distCoeffs, R, newCameraMatrix, size, CV_16SC2, map1_, map2_
+    );
+    store(UNDISTORT, key, size, 0);
+    return true;
+}
+
+void RemapCache::buildWarp(const cv::Mat& M, cv::Size dsize, bool inverseMap, bool perspective) {
+    CV_Assert(!M.empty() && dsize.area() > 0);
+    cv::Matx33d T = cv::Matx33d::eye();
+    if (perspective) {
+        CV_Assert(M.rows == 3 && M.cols == 3);
+        cv::Mat H(3, 3, CV_64F, T.val);
+        M.convertTo(H, CV_64F);
+        if (!inverseMap) T = T.inv();
+    } else {
+        CV_Assert(M.rows == 2 && M.cols == 3);
+        cv::Mat A(2, 3, CV_64F, T.val);
+        M.convertTo(A, CV_64F);
+        if (!inverseMap) cv::invertAffineTransform(A.clone(), A);
+    }
+
+    cv::Mat xy(dsize, CV_32FC2);
+    cv::parallel_for_(cv::Range(0, dsize.height), [&](const cv::Range& range) {
+        for (int y = range.start; y < range.end; y++) {
+            auto* row = xy.ptr<cv::Vec2f>(y);
+            const double bx = T(0, 1) * y + T(0, 2);
+            const double by = T(1, 1) * y + T(1, 2);
+            const double bw = T(2, 1) * y + T(2, 2);
+            for (int x = 0; x < dsize.width; x++) {
+                double X = T(0, 0) * x + bx;
+                double Y = T(1, 0) * x + by;
+                if (perspective) {
+                    double W = T(2, 0) * x + bw;
+                    W = W != 0 ? 1. / W : 0;
+                    X *= W;
+                    Y *= W;
+                }
+                row[x] = cv::Vec2f(static_cast<float>(X), static_cast<float>(Y));
+            }
+        }
+    });
+    cv::convertMaps(xy, cv::noArray(), map1_, map2_, CV_16SC2, interpolation == cv::INTER_NEAREST);
+}
+
+bool RemapCache::initWarpAffine(const cv::Mat& M, cv::Size dsize, bool inverseMap) {
+    auto key = makeKey({M});
+    if (hit(AFFINE, key, dsize, inverseMap)) return false;
+    buildWarp(M, dsize, inverseMap, false);
+    store(AFFINE, key, dsize, inverseMap);
+    return true;
+}
+
+bool RemapCache::initWarpPerspective(const cv::Mat& M, cv::Size dsize, bool inverseMap) {
+    auto key = makeKey({M});
+    if (hit(PERSPECTIVE, key, dsize, inverseMap)) return false;
+    buildWarp(M, dsize, inverseMap, true);
+    store(PERSPECTIVE, key, dsize, inverseMap);
+    return true;
+}
+
+void RemapCache::apply(const cv::Mat& src, cv::Mat& dst) const {
+    if (map1_.empty()) CV_Error(cv::Error::StsBadArg, "RemapCache is not initialized");
+    cv::remap(src, dst, map1_, map2_, interpolation, borderMode, borderValue);
+}
+
+void RemapCache::release() {
+    kind_ = NONE;
+    key_.clear();
+    keySize_ = cv::Size();
+    keyFlags_ = 0;
+    map1_.release();
+    map2_.release();
+}
+
+}  // namespace cvd
+
+CvStatus* cv_RemapCache_create(
+    int interpolation, int borderMode, Scalar borderValue, RemapCache* rval
+) {
+    BEGIN_WRAP
+    auto bv = cv::Scalar(borderValue.val1, borderValue.val2, borderValue.val3, borderValue.val4);
+    *rval = {new cvd::RemapCache(interpolation, borderMode, bv)};
+    END_WRAP
+}
+
+void cv_RemapCache_close(RemapCachePtr self) {
+    CVD_FREE(self);
+}
+
+CvStatus* cv_RemapCache_initUndistortRectifyMap(
+    RemapCache self,
+    Mat cameraMatrix,
+    Mat distCoeffs,
+    Mat r,
+    Mat newCameraMatrix,
+    CvSize size,
+    bool* rval,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    *rval = self.ptr->initUndistortRectifyMap(
+        CVDEREF(cameraMatrix),
+        CVDEREF(distCoeffs),
+        CVDEREF(r),
+        CVDEREF(newCameraMatrix),
+        cv::Size(size.width, size.height)
+    );
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_RemapCache_initWarpAffine(
+    RemapCache self, Mat M, CvSize dsize, bool inverseMap, bool* rval, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    *rval = self.ptr->initWarpAffine(CVDEREF(M), cv::Size(dsize.width, dsize.height), inverseMap);
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_RemapCache_initWarpPerspective(
+    RemapCache self, Mat M, CvSize dsize, bool inverseMap, bool* rval, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    *rval =
+        self.ptr->initWarpPerspective(CVDEREF(M), cv::Size(dsize.width, dsize.height), inverseMap);
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_RemapCache_apply(RemapCache self, Mat src, Mat dst, CvCallback_0 callback) {
+    BEGIN_WRAP
+    self.ptr->apply(CVDEREF(src), CVDEREF(dst));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_RemapCache_getMaps(RemapCache self, Mat map1, Mat map2) {
+    BEGIN_WRAP
+    CVDEREF(map1) = self.ptr->map1();
+    CVDEREF(map2) = self.ptr->map2();
+    END_WRAP
+}
+
+bool cv_RemapCache_empty(RemapCache self) {
+    return self.ptr->empty();
+}
+
+void cv_RemapCache_release(RemapCache self) {
+    self.ptr->release();
+}
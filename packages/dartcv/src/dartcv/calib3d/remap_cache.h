@@ -0,0 +1,116 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_REMAP_CACHE_H
+#define DARTCV_LIBRARY_REMAP_CACHE_H
+
+#ifdef __cplusplus
+#include <opencv2/calib3d.hpp>
+#include <opencv2/imgproc.hpp>
+#include <vector>
+
+namespace cvd {
+// Keeps fixed-point (CV_16SC2 + CV_16UC1) remap tables of a fixed geometric transform,
+// so that the per-frame cost of undistortion or warping is a single cv::remap call.
+// The tables are only rebuilt when the transform parameters (the key) change.
+class RemapCache {
+  public:
+    RemapCache(int interpolation, int borderMode, const cv::Scalar& borderValue);
+
+    // returns true if the maps were (re)built, false if the cached maps are reused
+    bool initUndistortRectifyMap(
+        const cv::Mat& cameraMatrix,
+        const cv::Mat& distCoeffs,
+        const cv::Mat& R,
+        const cv::Mat& newCameraMatrix,
+        cv::Size size
+    );
+    bool initWarpAffine(const cv::Mat& M, cv::Size dsize, bool inverseMap);
+    bool initWarpPerspective(const cv::Mat& M, cv::Size dsize, bool inverseMap);
+
+    void apply(const cv::Mat& src, cv::Mat& dst) const;
+    void release();
+
+    bool empty() const { return map1_.empty(); }
+    cv::Size size() const { return map1_.size(); }
+    const cv::Mat& map1() const { return map1_; }
+    const cv::Mat& map2() const { return map2_; }
+
+    // fixed at construction, the warp maps are built for it (INTER_NEAREST has no map2)
+    const int interpolation;
+    int borderMode;
+    cv::Scalar borderValue;
+
+  private:
+    enum Kind { NONE = 0, UNDISTORT = 1, AFFINE = 2, PERSPECTIVE = 3 };
+
+    bool hit(Kind kind, const std::vector<cv::Mat>& key, cv::Size size, int flags) const;
+    void store(Kind kind, const std::vector<cv::Mat>& key, cv::Size size, int flags);
+    void buildWarp(const cv::Mat& M, cv::Size dsize, bool inverseMap, bool perspective);
+
+    Kind kind_ = NONE;
+    std::vector<cv::Mat> key_;
+    cv::Size keySize_;
+    int keyFlags_ = 0;
+    cv::Mat map1_, map2_;
+};
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+CVD_TYPEDEF(cvd::RemapCache, RemapCache);
+#else
+CVD_TYPEDEF(void, RemapCache);
+#endif
+
+// Creates a remap cache, interpolation and border settings are used by every apply().
+CvStatus* cv_RemapCache_create(
+    int interpolation, int borderMode, Scalar borderValue, RemapCache* rval
+);
+void cv_RemapCache_close(RemapCachePtr self);
+
+// Builds CV_16SC2 maps from cv::initUndistortRectifyMap, keyed by camera matrix, distortion,
+// rectification, new camera matrix and output size. rval is true if the maps were rebuilt.
+// void cv::initUndistortRectifyMap (InputArray cameraMatrix, InputArray distCoeffs, InputArray R, InputArray newCameraMatrix, Size size, int m1type, OutputArray map1, OutputArray map2)
+CvStatus* cv_RemapCache_initUndistortRectifyMap(
+    RemapCache self,
+    Mat cameraMatrix,
+    Mat distCoeffs,
+    Mat r,
+    Mat newCameraMatrix,
+    CvSize size,
+    bool* rval,
+    CvCallback_0 callback
+);
+
+// Builds CV_16SC2 maps equivalent to cv::warpAffine with the given matrix and output size.
+// void cv::warpAffine (InputArray src, OutputArray dst, InputArray M, Size dsize, int flags=INTER_LINEAR, int borderMode=BORDER_CONSTANT, const Scalar &borderValue=Scalar())
+CvStatus* cv_RemapCache_initWarpAffine(
+    RemapCache self, Mat M, CvSize dsize, bool inverseMap, bool* rval, CvCallback_0 callback
+);
+
+// Builds CV_16SC2 maps equivalent to cv::warpPerspective with the given matrix and output size.
+// void cv::warpPerspective (InputArray src, OutputArray dst, InputArray M, Size dsize, int flags=INTER_LINEAR, int borderMode=BORDER_CONSTANT, const Scalar &borderValue=Scalar())
+CvStatus* cv_RemapCache_initWarpPerspective(
+    RemapCache self, Mat M, CvSize dsize, bool inverseMap, bool* rval, CvCallback_0 callback
+);
+
+// Remaps src with the cached fixed-point maps.
+CvStatus* cv_RemapCache_apply(RemapCache self, Mat src, Mat dst, CvCallback_0 callback);
+
+// Returns the cached maps, the data is shared with the cache.
+CvStatus* cv_RemapCache_getMaps(RemapCache self, Mat map1, Mat map2);
+
+bool cv_RemapCache_empty(RemapCache self);
+void cv_RemapCache_release(RemapCache self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_REMAP_CACHE_H
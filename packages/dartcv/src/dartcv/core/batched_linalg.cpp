@@ -0,0 +1,432 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/core/batched_linalg.h"
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+
+namespace cvd {
+
+namespace {
+
+// items per parallel stripe, small items are too cheap to be scheduled one by one
+constexpr double kGrain = 64;
+
+struct Batch {
+    int n, rows, cols;
+    const uchar* data;
+    size_t step;  // bytes between items, 0 when broadcast
+
+    template <typename T>
+    const T* item(int i) const {
+        return reinterpret_cast<const T*>(data + step * i);
+    }
+    cv::Mat header(int i, int type) const {
+        return cv::Mat(rows, cols, type, const_cast<uchar*>(data + step * i));
+    }
+};
+
+Batch batchOf(const cv::Mat& m) {
+    CV_Assert(!m.empty() && m.channels() == 1 && m.isContinuous());
+    CV_Assert(m.depth() == CV_32F || m.depth() == CV_64F);
+    CV_Assert(m.dims == 2 || m.dims == 3);
+    Batch b;
+    if (m.dims == 2) {
+        b = {1, m.rows, m.cols, m.data, 0};
+    } else {
+        b = {m.size[0], m.size[1], m.size[2], m.data, 0};
+    }
+    if (b.n > 1) b.step = static_cast<size_t>(b.rows) * b.cols * m.elemSize();
+    return b;
+}
+
+int batchCount(std::initializer_list<int> counts) {
+    int n = 1;
+    for (int c : counts) {
+        CV_Assert(c == 1 || n == 1 || c == n);
+        n = std::max(n, c);
+    }
+    return n;
+}
+
+// Allocates the (n, rows, cols) output, in a new buffer if dst overlaps one of the inputs.
+Batch prepareOutput(
+    cv::Mat& out,
+    const cv::Mat& dst,
+    int n,
+    int rows,
+    int cols,
+    int type,
+    std::initializer_list<const cv::Mat*> inputs
+) {
+    out = dst;
+    for (const cv::Mat* m : inputs) {
+        if (!m->empty() && !out.empty() && m->datastart < out.dataend &&
+            out.datastart < m->dataend) {
+            out = cv::Mat();
+            break;
+        }
+    }
+    const int sizes[] = {n, rows, cols};
+    out.create(3, sizes, type);
+    return {n, rows, cols, out.data, static_cast<size_t>(rows) * cols * out.elemSize()};
+}
+
+template <typename F>
+void forEachItem(int n, const F& f) {
+    cv::parallel_for_(
+        cv::Range(0, n),
+        [&](const cv::Range& range) {
+            for (int i = range.start; i < range.end; i++) f(i);
+        },
+        std::max(1.0, n / kGrain)
+    );
+}
+
+// Maps the header of a packed item through an OpenCV function which may reallocate its
+// output, in which case the result is copied back.
+inline void writeBack(cv::Mat& result, const cv::Mat& item) {
+    if (result.data != item.data) result.copyTo(item);
+}
+
+template <typename T, int M>
+inline void gemmFixed(
+    const T* A, const T* B, const T* C, T* D, bool ta, bool tb, bool tc, T alpha, T beta
+) {
+    T a[M][M], b[M][M];
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < M; j++) {
+            a[i][j] = ta ? A[j * M + i] : A[i * M + j];
+            b[i][j] = tb ? B[j * M + i] : B[i * M + j];
+        }
+    }
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < M; j++) {
+            T s = 0;
+            for (int p = 0; p < M; p++) s += a[i][p] * b[p][j];
+            s *= alpha;
+            if (C != nullptr) s += beta * (tc ? C[j * M + i] : C[i * M + j]);
+            D[i * M + j] = s;
+        }
+    }
+}
+
+// op(A) is m x k, op(B) is k x n, C and D are m x n
+template <typename T>
+inline void gemmAny(
+    const T* A,
+    const T* B,
+    const T* C,
+    T* D,
+    int m,
+    int k,
+    int n,
+    bool ta,
+    bool tb,
+    bool tc,
+    T alpha,
+    T beta
+) {
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) {
+            T s = 0;
+            for (int p = 0; p < k; p++) {
+                s += (ta ? A[p * m + i] : A[i * k + p]) * (tb ? B[j * k + p] : B[p * n + j]);
+            }
+            s *= alpha;
+            if (C != nullptr) s += beta * (tc ? C[j * m + i] : C[i * n + j]);
+            D[i * n + j] = s;
+        }
+    }
+}
+
+template <typename T>
+void gemmImpl(
+    const Batch& a,
+    const Batch& b,
+    const Batch* c,
+    const Batch& d,
+    int k,
+    int flags,
+    double alpha,
+    double beta
+) {
+    const bool ta = (flags & cv::GEMM_1_T) != 0, tb = (flags & cv::GEMM_2_T) != 0;
+    const bool tc = (flags & cv::GEMM_3_T) != 0;
+    const T al = static_cast<T>(alpha), be = static_cast<T>(beta);
+    const int m = d.rows, n = d.cols;
+    const bool square = m == n && m == k;
+    forEachItem(d.n, [&](int i) {
+        const T* C = c != nullptr ? c->item<T>(i) : nullptr;
+        T* D = const_cast<T*>(d.item<T>(i));
+        if (square && m == 2) {
+            gemmFixed<T, 2>(a.item<T>(i), b.item<T>(i), C, D, ta, tb, tc, al, be);
+        } else if (square && m == 3) {
+            gemmFixed<T, 3>(a.item<T>(i), b.item<T>(i), C, D, ta, tb, tc, al, be);
+        } else if (square && m == 4) {
+            gemmFixed<T, 4>(a.item<T>(i), b.item<T>(i), C, D, ta, tb, tc, al, be);
+        } else {
+            gemmAny<T>(a.item<T>(i), b.item<T>(i), C, D, m, k, n, ta, tb, tc, al, be);
+        }
+    });
+}
+
+// determinants in double, like the 2x2 and 3x3 paths of cv::invert and cv::solve
+template <typename T>
+inline double det2(const T* A) {
+    return static_cast<double>(A[0]) * A[3] - static_cast<double>(A[1]) * A[2];
+}
+
+template <typename T>
+inline double det3(const T* A) {
+    return A[0] * (static_cast<double>(A[4]) * A[8] - static_cast<double>(A[5]) * A[7]) -
+           A[1] * (static_cast<double>(A[3]) * A[8] - static_cast<double>(A[5]) * A[6]) +
+           A[2] * (static_cast<double>(A[3]) * A[7] - static_cast<double>(A[4]) * A[6]);
+}
+
+// Solves A * X = B with partial pivoting, X holds the M x nb B on entry. Singular matrices are
+// detected like cv::invert and cv::solve: det != 0 up to 3x3, the absolute pivot threshold of
+// cv::hal::LU above, so that small but well conditioned matrices are not rejected.
+template <typename T, int M>
+inline bool luFixed(const T* A, T* X, int nb) {
+    if (M == 2 && det2(A) == 0) return false;
+    if (M == 3 && det3(A) == 0) return false;
+    const T eps = std::numeric_limits<T>::epsilon() * (sizeof(T) == sizeof(float) ? 10 : 100);
+    T a[M][M];
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < M; j++) a[i][j] = A[i * M + j];
+    }
+    for (int k = 0; k < M; k++) {
+        int p = k;
+        for (int i = k + 1; i < M; i++) {
+            if (std::abs(a[i][k]) > std::abs(a[p][k])) p = i;
+        }
+        const T pivot = std::abs(a[p][k]);
+        if (M <= 3 ? pivot == 0 : pivot < eps) return false;
+        if (p != k) {
+            for (int j = 0; j < M; j++) std::swap(a[p][j], a[k][j]);
+            for (int j = 0; j < nb; j++) std::swap(X[p * nb + j], X[k * nb + j]);
+        }
+        const T d = 1 / a[k][k];
+        for (int i = k + 1; i < M; i++) {
+            const T f = a[i][k] * d;
+            for (int j = k + 1; j < M; j++) a[i][j] -= f * a[k][j];
+            for (int j = 0; j < nb; j++) X[i * nb + j] -= f * X[k * nb + j];
+        }
+    }
+    for (int k = M - 1; k >= 0; k--) {
+        const T d = 1 / a[k][k];
+        for (int j = 0; j < nb; j++) {
+            T s = X[k * nb + j];
+            for (int i = k + 1; i < M; i++) s -= a[k][i] * X[i * nb + j];
+            X[k * nb + j] = s * d;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+inline bool lu(const T* A, T* X, int m, int nb) {
+    switch (m) {
+        case 2: return luFixed<T, 2>(A, X, nb);
+        case 3: return luFixed<T, 3>(A, X, nb);
+        default: return luFixed<T, 4>(A, X, nb);
+    }
+}
+
+template <typename T>
+void invertImpl(const Batch& a, const Batch& d, double* status, int flags, int type) {
+    const int m = a.rows;
+    const bool fixed = flags == cv::DECOMP_LU && m == a.cols && m >= 2 && m <= 4;
+    forEachItem(d.n, [&](int i) {
+        T* D = const_cast<T*>(d.item<T>(i));
+        if (fixed) {
+            for (int r = 0; r < m; r++) {
+                for (int c = 0; c < m; c++) D[r * m + c] = r == c ? T(1) : T(0);
+            }
+            status[i] = lu<T>(a.item<T>(i), D, m, m) ? 1 : 0;
+            if (status[i] == 0) std::fill(D, D + m * m, T(0));
+        } else {
+            const cv::Mat item = d.header(i, type);
+            cv::Mat result = item;
+            status[i] = cv::invert(a.header(i, type), result, flags);
+            writeBack(result, item);
+        }
+    });
+}
+
+template <typename T>
+void solveImpl(const Batch& a, const Batch& b, const Batch& d, uchar* status, int flags, int type) {
+    const int m = a.rows, nb = b.cols;
+    const bool fixed = flags == cv::DECOMP_LU && m == a.cols && m >= 2 && m <= 4;
+    forEachItem(d.n, [&](int i) {
+        T* D = const_cast<T*>(d.item<T>(i));
+        if (fixed) {
+            std::copy(b.item<T>(i), b.item<T>(i) + m * nb, D);
+            status[i] = lu<T>(a.item<T>(i), D, m, nb) ? 1 : 0;
+            if (status[i] == 0) std::fill(D, D + m * nb, T(0));
+        } else {
+            const cv::Mat item = d.header(i, type);
+            cv::Mat result = item;
+            status[i] = cv::solve(a.header(i, type), b.header(i, type), result, flags) ? 1 : 0;
+            writeBack(result, item);
+        }
+    });
+}
+
+}  // namespace
+
+void gemmBatched(
+    const cv::Mat& src1,
+    const cv::Mat& src2,
+    double alpha,
+    const cv::Mat& src3,
+    double beta,
+    cv::Mat& dst,
+    int flags
+) {
+    const Batch a = batchOf(src1), b = batchOf(src2);
+    const int type = src1.type();
+    CV_Assert(src2.type() == type);
+    const bool ta = (flags & cv::GEMM_1_T) != 0, tb = (flags & cv::GEMM_2_T) != 0;
+    const int m = ta ? a.cols : a.rows, k = ta ? a.rows : a.cols;
+    const int n = tb ? b.rows : b.cols;
+    CV_Assert((tb ? b.cols : b.rows) == k);
+
+    const bool hasC = !src3.empty() && beta != 0;
+    Batch c{};
+    int count = batchCount({a.n, b.n});
+    if (hasC) {
+        c = batchOf(src3);
+        CV_Assert(src3.type() == type);
+        const bool tc = (flags & cv::GEMM_3_T) != 0;
+        CV_Assert((tc ? c.cols : c.rows) == m && (tc ? c.rows : c.cols) == n);
+        count = batchCount({count, c.n});
+    }
+
+    cv::Mat out;
+    const Batch d = prepareOutput(out, dst, count, m, n, type, {&src1, &src2, &src3});
+    if (type == CV_32F) {
+        gemmImpl<float>(a, b, hasC ? &c : nullptr, d, k, flags, alpha, beta);
+    } else {
+        gemmImpl<double>(a, b, hasC ? &c : nullptr, d, k, flags, alpha, beta);
+    }
+    dst = out;
+}
+
+void invertBatched(const cv::Mat& src, cv::Mat& dst, cv::Mat& status, int flags) {
+    const Batch a = batchOf(src);
+    cv::Mat out;
+    const Batch d = prepareOutput(out, dst, a.n, a.cols, a.rows, src.type(), {&src});
+    status.create(a.n, 1, CV_64F);
+    if (src.depth() == CV_32F) {
+        invertImpl<float>(a, d, status.ptr<double>(), flags, src.type());
+    } else {
+        invertImpl<double>(a, d, status.ptr<double>(), flags, src.type());
+    }
+    dst = out;
+}
+
+void solveBatched(
+    const cv::Mat& src1, const cv::Mat& src2, cv::Mat& dst, cv::Mat& status, int flags
+) {
+    const Batch a = batchOf(src1), b = batchOf(src2);
+    const int type = src1.type();
+    CV_Assert(src2.type() == type && a.rows == b.rows);
+    const int count = batchCount({a.n, b.n});
+    cv::Mat out;
+    const Batch d = prepareOutput(out, dst, count, a.cols, b.cols, type, {&src1, &src2});
+    status.create(count, 1, CV_8U);
+    if (type == CV_32F) {
+        solveImpl<float>(a, b, d, status.data, flags, type);
+    } else {
+        solveImpl<double>(a, b, d, status.data, flags, type);
+    }
+    dst = out;
+}
+
+void SVDecompBatched(const cv::Mat& src, cv::Mat& w, cv::Mat& u, cv::Mat& vt, int flags) {
+    // the items are headers over the caller's data, never decompose them in place
+    flags &= ~cv::SVD::MODIFY_A;
+    const Batch a = batchOf(src);
+    const int type = src.type(), k = std::min(a.rows, a.cols);
+    const bool noUV = (flags & cv::SVD::NO_UV) != 0, full = (flags & cv::SVD::FULL_UV) != 0;
+
+    cv::Mat wOut, uOut, vtOut;
+    const Batch wb = prepareOutput(wOut, w, a.n, k, 1, type, {&src});
+    Batch ub{}, vtb{};
+    if (!noUV) {
+        ub = prepareOutput(uOut, u, a.n, a.rows, full ? a.rows : k, type, {&src});
+        vtb = prepareOutput(vtOut, vt, a.n, full ? a.cols : k, a.cols, type, {&src});
+    }
+    forEachItem(a.n, [&](int i) {
+        const cv::Mat wi = wb.header(i, type);
+        cv::Mat wr = wi;
+        if (noUV) {
+            cv::SVD::compute(a.header(i, type), wr, flags);
+        } else {
+            const cv::Mat ui = ub.header(i, type), vti = vtb.header(i, type);
+            cv::Mat ur = ui, vtr = vti;
+            cv::SVD::compute(a.header(i, type), wr, ur, vtr, flags);
+            writeBack(ur, ui);
+            writeBack(vtr, vti);
+        }
+        writeBack(wr, wi);
+    });
+    w = wOut;
+    u = uOut;
+    vt = vtOut;
+}
+
+}  // namespace cvd
+
+CvStatus* cv_gemmBatched(
+    Mat src1,
+    Mat src2,
+    double alpha,
+    Mat src3,
+    double beta,
+    Mat dst,
+    int flags,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    cvd::gemmBatched(CVDEREF(src1), CVDEREF(src2), alpha, CVDEREF(src3), beta, CVDEREF(dst), flags);
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_invertBatched(Mat src, Mat dst, Mat status, int flags, CvCallback_0 callback) {
+    BEGIN_WRAP
+    cvd::invertBatched(CVDEREF(src), CVDEREF(dst), CVDEREF(status), flags);
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_solveBatched(
+    Mat src1, Mat src2, Mat dst, Mat status, int flags, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    cvd::solveBatched(CVDEREF(src1), CVDEREF(src2), CVDEREF(dst), CVDEREF(status), flags);
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_SVDecompBatched(Mat src, Mat w, Mat u, Mat vt, int flags, CvCallback_0 callback) {
+    BEGIN_WRAP
+    cvd::SVDecompBatched(CVDEREF(src), CVDEREF(w), CVDEREF(u), CVDEREF(vt), flags);
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
@@ -0,0 +1,72 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_BATCHED_LINALG_H
+#define DARTCV_LIBRARY_BATCHED_LINALG_H
+
+#ifdef __cplusplus
+#include <opencv2/core.hpp>
+
+namespace cvd {
+// Linear algebra over batches of small matrices.
+//
+// A batch is a continuous, single channel CV_32F or CV_64F Mat of 3 dims (n, rows, cols),
+// item i being the rows x cols matrix at data + i * rows * cols. A 2-D Mat is a batch of one,
+// and a batch of one is broadcast against larger batches of the other operands. Outputs are
+// (re)allocated as batches. Items are processed in parallel; square 2x2, 3x3 and 4x4 items
+// with the default flags go through fixed-size kernels, everything else through the regular
+// OpenCV functions on headers over the packed data.
+
+// dst_i = alpha * op(src1_i) * op(src2_i) + beta * op(src3_i), see cv::gemm, src3 may be empty.
+void gemmBatched(
+    const cv::Mat& src1,
+    const cv::Mat& src2,
+    double alpha,
+    const cv::Mat& src3,
+    double beta,
+    cv::Mat& dst,
+    int flags
+);
+// dst_i = inverse of src_i, see cv::invert; status is (n x 1) CV_64F with the values returned
+// by cv::invert, 0 for singular items, whose inverse is set to zeros.
+void invertBatched(const cv::Mat& src, cv::Mat& dst, cv::Mat& status, int flags);
+// Solves src1_i * dst_i = src2_i, see cv::solve; status is (n x 1) CV_8U, 0 for singular
+// items, whose solution is set to zeros.
+void solveBatched(
+    const cv::Mat& src1, const cv::Mat& src2, cv::Mat& dst, cv::Mat& status, int flags
+);
+// See cv::SVD::compute, w is (n, k, 1) with k = min(rows, cols), u and vt are released with
+// cv::SVD::NO_UV.
+void SVDecompBatched(const cv::Mat& src, cv::Mat& w, cv::Mat& u, cv::Mat& vt, int flags);
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+
+CvStatus* cv_gemmBatched(
+    Mat src1,
+    Mat src2,
+    double alpha,
+    Mat src3,
+    double beta,
+    CVD_OUT Mat dst,
+    int flags,
+    CvCallback_0 callback
+);
+CvStatus* cv_invertBatched(
+    Mat src, CVD_OUT Mat dst, CVD_OUT Mat status, int flags, CvCallback_0 callback
+);
+CvStatus* cv_solveBatched(
+    Mat src1, Mat src2, CVD_OUT Mat dst, CVD_OUT Mat status, int flags, CvCallback_0 callback
+);
+CvStatus* cv_SVDecompBatched(
+    Mat src, CVD_OUT Mat w, CVD_OUT Mat u, CVD_OUT Mat vt, int flags, CvCallback_0 callback
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_BATCHED_LINALG_H
@@ -1,5 +1,6 @@
 #include "dartcv/core/core.h"
 #include "dartcv/core/lut.hpp"
+#include "dartcv/core/sort.h"
 #include "dartcv/core/vec.hpp"
 #include "dartcv/core/stdvec.h"
 
@@ -798,7 +799,7 @@ CvStatus* cv_setIdentity(Mat src, Scalar scalar, CvCallback_0 callback) {
 }
 CvStatus* cv_sort(Mat src, Mat dst, int flags, CvCallback_0 callback) {
     BEGIN_WRAP
-    cv::sort(CVDEREF(src), CVDEREF(dst), flags);
+    cvd::sort(CVDEREF(src), CVDEREF(dst), flags);
     if (callback != nullptr) {
         callback();
     }
@@ -806,7 +807,7 @@ CvStatus* cv_sort(Mat src, Mat dst, int flags, CvCallback_0 callback) {
 }
 CvStatus* cv_sortIdx(Mat src, Mat dst, int flags, CvCallback_0 callback) {
     BEGIN_WRAP
-    cv::sortIdx(CVDEREF(src), CVDEREF(dst), flags);
+    cvd::sortIdx(CVDEREF(src), CVDEREF(dst), flags);
     if (callback != nullptr) {
         callback();
     }
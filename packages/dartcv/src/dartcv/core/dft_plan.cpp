@@ -0,0 +1,147 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/core/dft_plan.h"
+
+namespace cvd {
+
+namespace {
+int variantOf(int halFlags) {
+    return ((halFlags & CV_HAL_DFT_IS_CONTINUOUS) ? 1 : 0) |
+           ((halFlags & CV_HAL_DFT_IS_INPLACE) ? 2 : 0);
+}
+}  // namespace
+
+DFTPlan::DFTPlan(cv::Size size, int type, int flags, int nonzeroRows, bool pad)
+    : size_(size), type_(type), flags_(flags), nonzeroRows_(nonzeroRows), pad_(pad) {
+    CV_Assert(type == CV_32FC1 || type == CV_32FC2 || type == CV_64FC1 || type == CV_64FC2);
+    CV_Assert(!((flags & cv::DFT_COMPLEX_INPUT) && CV_MAT_CN(type) != 2));
+    CV_Assert(size.width > 0 && size.height > 0);
+    if (pad) {
+        size_.width = cv::getOptimalDFTSize(size.width);
+        // rows are transformed independently with DFT_ROWS
+        if (!(flags & cv::DFT_ROWS)) size_.height = cv::getOptimalDFTSize(size.height);
+    }
+
+    // same output as cv::dft
+    const bool inv = (flags & cv::DFT_INVERSE) != 0;
+    const int depth = CV_MAT_DEPTH(type);
+    if (!inv && CV_MAT_CN(type) == 1 && (flags & cv::DFT_COMPLEX_OUTPUT))
+        dstType_ = CV_MAKETYPE(depth, 2);
+    else if (inv && CV_MAT_CN(type) == 2 && (flags & cv::DFT_REAL_OUTPUT))
+        dstType_ = depth;
+    else
+        dstType_ = type;
+
+    // create the common variant now, so invalid arguments fail here
+    const int halFlags = CV_HAL_DFT_IS_CONTINUOUS;
+    release(halFlags, acquire(halFlags));
+}
+
+cv::Ptr<cv::hal::DFT2D> DFTPlan::acquire(int halFlags) const {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& pool = pool_[variantOf(halFlags)];
+        if (!pool.empty()) {
+            auto impl = pool.back();
+            pool.pop_back();
+            return impl;
+        }
+    }
+    if (flags_ & cv::DFT_INVERSE) halFlags |= CV_HAL_DFT_INVERSE;
+    if (flags_ & cv::DFT_ROWS) halFlags |= CV_HAL_DFT_ROWS;
+    if (flags_ & cv::DFT_SCALE) halFlags |= CV_HAL_DFT_SCALE;
+    return cv::hal::DFT2D::create(
+        size_.width,
+        size_.height,
+        CV_MAT_DEPTH(type_),
+        CV_MAT_CN(type_),
+        CV_MAT_CN(dstType_),
+        halFlags,
+        nonzeroRows_
+    );
+}
+
+void DFTPlan::release(int halFlags, cv::Ptr<cv::hal::DFT2D> impl) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pool_[variantOf(halFlags)].push_back(impl);
+}
+
+void DFTPlan::execute(const cv::Mat& src, cv::Mat& dst) const {
+    CV_Assert(src.type() == type_ && src.dims <= 2);
+    cv::Mat in = src;
+    if (src.size() != size_) {
+        if (!pad_ || src.rows > size_.height || src.cols > size_.width)
+            CV_Error(cv::Error::StsUnmatchedSizes, "the size of src does not match the DFTPlan");
+        cv::copyMakeBorder(
+            src, in, 0, size_.height - src.rows, 0, size_.width - src.cols, cv::BORDER_CONSTANT
+        );
+    }
+    dst.create(size_, dstType_);
+
+    int halFlags = 0;
+    if (in.isContinuous() && dst.isContinuous()) halFlags |= CV_HAL_DFT_IS_CONTINUOUS;
+    if (in.data == dst.data) halFlags |= CV_HAL_DFT_IS_INPLACE;
+    auto impl = acquire(halFlags);
+    impl->apply(in.data, in.step, dst.data, dst.step);
+    release(halFlags, impl);
+}
+
+void DFTPlan::executeBatch(const std::vector<cv::Mat>& src, std::vector<cv::Mat>& dst) const {
+    dst.resize(src.size());
+    cv::parallel_for_(cv::Range(0, static_cast<int>(src.size())), [&](const cv::Range& range) {
+        for (int i = range.start; i < range.end; i++) {
+            execute(src[i], dst[i]);
+        }
+    });
+}
+
+}  // namespace cvd
+
+CvStatus* cv_DFTPlan_create(
+    CvSize size, int type, int flags, int nonzeroRows, bool pad, DFTPlan* rval
+) {
+    BEGIN_WRAP
+    *rval = {new cvd::DFTPlan(cv::Size(size.width, size.height), type, flags, nonzeroRows, pad)};
+    END_WRAP
+}
+
+void cv_DFTPlan_close(DFTPlanPtr self) {
+    CVD_FREE(self);
+}
+
+CvStatus* cv_DFTPlan_execute(DFTPlan self, Mat src, Mat dst, CvCallback_0 callback) {
+    BEGIN_WRAP
+    self.ptr->execute(CVDEREF(src), CVDEREF(dst));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_DFTPlan_executeBatch(DFTPlan self, VecMat src, VecMat* dst, CvCallback_0 callback) {
+    BEGIN_WRAP
+    self.ptr->executeBatch(CVDEREF(src), CVDEREF_P(dst));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvSize cv_DFTPlan_getSize(DFTPlan self) {
+    const auto size = self.ptr->size();
+    return {size.width, size.height};
+}
+
+int cv_DFTPlan_getType(DFTPlan self) {
+    return self.ptr->type();
+}
+
+int cv_DFTPlan_getDstType(DFTPlan self) {
+    return self.ptr->dstType();
+}
+
+int cv_DFTPlan_getFlags(DFTPlan self) {
+    return self.ptr->flags();
+}
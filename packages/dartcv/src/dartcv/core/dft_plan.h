@@ -0,0 +1,85 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_DFT_PLAN_H
+#define DARTCV_LIBRARY_DFT_PLAN_H
+
+#ifdef __cplusplus
+#include <opencv2/core.hpp>
+#include <opencv2/core/hal/hal.hpp>
+#include <mutex>
+#include <vector>
+
+namespace cvd {
+// A cv::dft with fixed (size, type, flags, nonzeroRows), for e.g. phase correlation or frequency
+// filtering of a video at the same size.
+//
+// cv::dft creates a cv::hal::DFT2D (twiddle factors, index tables and scratch buffers) on every
+// call and frees it afterwards, the plan keeps them instead. A DFT2D is not reentrant, so the
+// plan keeps a pool of them and every call borrows one, a plan can be shared between threads.
+//
+// With pad the plan size is the cv::getOptimalDFTSize of the requested size and smaller inputs
+// are zero padded at the bottom-right, as recommended for cv::dft.
+class DFTPlan {
+  public:
+    DFTPlan(cv::Size size, int type, int flags, int nonzeroRows, bool pad);
+
+    void execute(const cv::Mat& src, cv::Mat& dst) const;
+    // Transforms every Mat of src in parallel.
+    void executeBatch(const std::vector<cv::Mat>& src, std::vector<cv::Mat>& dst) const;
+
+    cv::Size size() const { return size_; }
+    int type() const { return type_; }
+    int dstType() const { return dstType_; }
+    int flags() const { return flags_; }
+
+  private:
+    cv::Ptr<cv::hal::DFT2D> acquire(int halFlags) const;
+    void release(int halFlags, cv::Ptr<cv::hal::DFT2D> impl) const;
+
+    cv::Size size_;
+    int type_;
+    int dstType_;
+    int flags_;
+    int nonzeroRows_;
+    bool pad_;
+    // borrowed DFT2D, by continuous and in-place variant
+    mutable std::mutex mutex_;
+    mutable std::vector<cv::Ptr<cv::hal::DFT2D>> pool_[4];
+};
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+CVD_TYPEDEF(cvd::DFTPlan, DFTPlan);
+#else
+CVD_TYPEDEF(void, DFTPlan);
+#endif
+
+// type: CV_32FC1, CV_32FC2, CV_64FC1 or CV_64FC2, flags and nonzeroRows as in cv_dft.
+CvStatus* cv_DFTPlan_create(
+    CvSize size, int type, int flags, int nonzeroRows, bool pad, DFTPlan* rval
+);
+void cv_DFTPlan_close(DFTPlanPtr self);
+
+CvStatus* cv_DFTPlan_execute(DFTPlan self, Mat src, CVD_OUT Mat dst, CvCallback_0 callback);
+CvStatus* cv_DFTPlan_executeBatch(
+    DFTPlan self, VecMat src, CVD_OUT VecMat* dst, CvCallback_0 callback
+);
+
+// The (padded) size of the transforms.
+CvSize cv_DFTPlan_getSize(DFTPlan self);
+int cv_DFTPlan_getType(DFTPlan self);
+int cv_DFTPlan_getDstType(DFTPlan self);
+int cv_DFTPlan_getFlags(DFTPlan self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_DFT_PLAN_H
@@ -0,0 +1,313 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/core/elem_expr.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace cvd {
+
+// elements per block and node, 1KB-2KB per node buffer
+static constexpr int kBlockSize = 256;
+
+int ElemExpr::add(const Node& node) {
+    nodes_.push_back(node);
+    return static_cast<int>(nodes_.size()) - 1;
+}
+
+void ElemExpr::checkNode(int node) const {
+    if (node < 0 || node >= size()) CV_Error(cv::Error::StsOutOfRange, "invalid node id");
+}
+
+int ElemExpr::input(const cv::Mat& m) {
+    CV_Assert(!m.empty() && m.depth() != CV_16F && m.dims <= 2);
+    inputs_.push_back(m);
+    return add({OP_INPUT, -1, -1, static_cast<int>(inputs_.size()) - 1, cv::Scalar()});
+}
+
+void ElemExpr::setInput(int node, const cv::Mat& m) {
+    checkNode(node);
+    if (nodes_[node].op != OP_INPUT) CV_Error(cv::Error::StsBadArg, "node is not an input");
+    CV_Assert(!m.empty() && m.depth() != CV_16F && m.dims <= 2);
+    inputs_[nodes_[node].arg] = m;
+}
+
+int ElemExpr::constant(const cv::Scalar& value) {
+    return add({OP_CONSTANT, -1, -1, 0, value});
+}
+
+int ElemExpr::binary(int op, int a, int b) {
+    if (op < OP_ADD || op > OP_MAX || op == OP_ABS)
+        CV_Error(cv::Error::StsBadArg, "invalid binary op");
+    checkNode(a);
+    checkNode(b);
+    return add({op, a, b, 0, cv::Scalar()});
+}
+
+int ElemExpr::compare(int cmpop, int a, int b) {
+    CV_Assert(cmpop >= cv::CMP_EQ && cmpop <= cv::CMP_NE);
+    checkNode(a);
+    checkNode(b);
+    return add({OP_COMPARE, a, b, cmpop, cv::Scalar()});
+}
+
+int ElemExpr::abs(int a) {
+    checkNode(a);
+    return add({OP_ABS, a, -1, 0, cv::Scalar()});
+}
+
+int ElemExpr::cast(int a, int depth) {
+    CV_Assert(depth >= CV_8U && depth <= CV_64F && depth != CV_16F);
+    checkNode(a);
+    return add({OP_CAST, a, -1, depth, cv::Scalar()});
+}
+
+template <typename S, typename T>
+static void load(const S* src, T* dst, int n) {
+    for (int i = 0; i < n; i++) dst[i] = static_cast<T>(src[i]);
+}
+
+template <typename T>
+static void loadRow(const cv::Mat& m, int y, int x, int n, T* dst) {
+    const uchar* row = m.ptr(y);
+    switch (m.depth()) {
+    case CV_8U: load(reinterpret_cast<const uchar*>(row) + x, dst, n); break;
+    case CV_8S: load(reinterpret_cast<const schar*>(row) + x, dst, n); break;
+    case CV_16U: load(reinterpret_cast<const ushort*>(row) + x, dst, n); break;
+    case CV_16S: load(reinterpret_cast<const short*>(row) + x, dst, n); break;
+    case CV_32S: load(reinterpret_cast<const int*>(row) + x, dst, n); break;
+    case CV_32F: load(reinterpret_cast<const float*>(row) + x, dst, n); break;
+    case CV_64F: load(reinterpret_cast<const double*>(row) + x, dst, n); break;
+    default: CV_Error(cv::Error::StsUnsupportedFormat, "unsupported depth");
+    }
+}
+
+template <typename D, typename T>
+static void store(const T* src, D* dst, int n) {
+    for (int i = 0; i < n; i++) dst[i] = cv::saturate_cast<D>(src[i]);
+}
+
+template <typename T>
+static void storeRow(const T* src, cv::Mat& m, int y, int x, int n) {
+    uchar* row = m.ptr(y);
+    switch (m.depth()) {
+    case CV_8U: store(src, reinterpret_cast<uchar*>(row) + x, n); break;
+    case CV_8S: store(src, reinterpret_cast<schar*>(row) + x, n); break;
+    case CV_16U: store(src, reinterpret_cast<ushort*>(row) + x, n); break;
+    case CV_16S: store(src, reinterpret_cast<short*>(row) + x, n); break;
+    case CV_32S: store(src, reinterpret_cast<int*>(row) + x, n); break;
+    case CV_32F: store(src, reinterpret_cast<float*>(row) + x, n); break;
+    case CV_64F: store(src, reinterpret_cast<double*>(row) + x, n); break;
+    default: CV_Error(cv::Error::StsUnsupportedFormat, "unsupported depth");
+    }
+}
+
+template <typename D, typename T>
+static void saturate(const T* src, T* dst, int n) {
+    for (int i = 0; i < n; i++) dst[i] = static_cast<T>(cv::saturate_cast<D>(src[i]));
+}
+
+template <typename T, typename F>
+static void compareBlock(const T* a, const T* b, T* dst, int n, F cmp) {
+    for (int i = 0; i < n; i++) dst[i] = cmp(a[i], b[i]) ? T(255) : T(0);
+}
+
+template <typename T>
+void ElemExpr::run(const std::vector<int>& program, int root, cv::Mat& dst) const {
+    const int cn = dst.channels();
+    const int len = dst.cols * cn;
+    // a multiple of cn, so constants can be filled once
+    const int block = (kBlockSize / cn) * cn;
+    const bool intDst = dst.depth() < CV_32F;
+
+    cv::parallel_for_(cv::Range(0, dst.rows), [&](const cv::Range& range) {
+        cv::AutoBuffer<T> buffer(static_cast<size_t>(size()) * block);
+        T* buf = buffer.data();
+        for (int i : program) {
+            if (nodes_[i].op != OP_CONSTANT) continue;
+            T* out = buf + static_cast<size_t>(i) * block;
+            for (int j = 0; j < block; j++) out[j] = static_cast<T>(nodes_[i].value[j % cn]);
+        }
+
+        for (int y = range.start; y < range.end; y++) {
+            for (int x = 0; x < len; x += block) {
+                const int n = std::min(block, len - x);
+                for (int i : program) {
+                    const Node& node = nodes_[i];
+                    T* out = buf + static_cast<size_t>(i) * block;
+                    const T* a = node.a >= 0 ? buf + static_cast<size_t>(node.a) * block : nullptr;
+                    const T* b = node.b >= 0 ? buf + static_cast<size_t>(node.b) * block : nullptr;
+                    switch (node.op) {
+                    case OP_INPUT: loadRow(inputs_[node.arg], y, x, n, out); break;
+                    case OP_CONSTANT: break;
+                    case OP_ADD:
+                        for (int j = 0; j < n; j++) out[j] = a[j] + b[j];
+                        break;
+                    case OP_SUB:
+                        for (int j = 0; j < n; j++) out[j] = a[j] - b[j];
+                        break;
+                    case OP_MUL:
+                        for (int j = 0; j < n; j++) out[j] = a[j] * b[j];
+                        break;
+                    case OP_DIV:
+                        // like cv::divide, division by zero gives 0 for an integer dst and
+                        // inf or NaN for a floating-point one
+                        if (intDst) {
+                            for (int j = 0; j < n; j++) out[j] = b[j] != 0 ? a[j] / b[j] : T(0);
+                        } else {
+                            for (int j = 0; j < n; j++) out[j] = a[j] / b[j];
+                        }
+                        break;
+                    case OP_ABS:
+                        for (int j = 0; j < n; j++) out[j] = std::abs(a[j]);
+                        break;
+                    case OP_MIN:
+                        for (int j = 0; j < n; j++) out[j] = std::min(a[j], b[j]);
+                        break;
+                    case OP_MAX:
+                        for (int j = 0; j < n; j++) out[j] = std::max(a[j], b[j]);
+                        break;
+                    case OP_COMPARE:
+                        switch (node.arg) {
+                        case cv::CMP_EQ: compareBlock(a, b, out, n, std::equal_to<T>()); break;
+                        case cv::CMP_GT: compareBlock(a, b, out, n, std::greater<T>()); break;
+                        case cv::CMP_GE: compareBlock(a, b, out, n, std::greater_equal<T>()); break;
+                        case cv::CMP_LT: compareBlock(a, b, out, n, std::less<T>()); break;
+                        case cv::CMP_LE: compareBlock(a, b, out, n, std::less_equal<T>()); break;
+                        default: compareBlock(a, b, out, n, std::not_equal_to<T>()); break;
+                        }
+                        break;
+                    case OP_CAST:
+                        switch (node.arg) {
+                        case CV_8U: saturate<uchar>(a, out, n); break;
+                        case CV_8S: saturate<schar>(a, out, n); break;
+                        case CV_16U: saturate<ushort>(a, out, n); break;
+                        case CV_16S: saturate<short>(a, out, n); break;
+                        case CV_32S: saturate<int>(a, out, n); break;
+                        case CV_32F: saturate<float>(a, out, n); break;
+                        default: std::copy(a, a + n, out); break;
+                        }
+                        break;
+                    default: CV_Error(cv::Error::StsInternal, "invalid op");
+                    }
+                }
+                storeRow(buf + static_cast<size_t>(root) * block, dst, y, x, n);
+            }
+        }
+    });
+}
+
+void ElemExpr::evaluate(int root, int dtype, cv::Mat& dst) const {
+    checkNode(root);
+    // only the nodes reachable from root are evaluated, children have smaller ids
+    std::vector<char> used(root + 1, 0);
+    used[root] = 1;
+    for (int i = root; i >= 0; i--) {
+        if (!used[i]) continue;
+        if (nodes_[i].a >= 0) used[nodes_[i].a] = 1;
+        if (nodes_[i].b >= 0) used[nodes_[i].b] = 1;
+    }
+    std::vector<int> program;
+    const cv::Mat* first = nullptr;
+    bool wide = dtype == CV_64F || dtype == CV_32S;
+    for (int i = 0; i <= root; i++) {
+        if (!used[i]) continue;
+        program.push_back(i);
+        if (nodes_[i].op != OP_INPUT) continue;
+        const cv::Mat& m = inputs_[nodes_[i].arg];
+        if (first == nullptr) {
+            first = &m;
+        } else if (m.size() != first->size() || m.channels() != first->channels()) {
+            CV_Error(cv::Error::StsUnmatchedSizes, "inputs must have the same size and channels");
+        }
+        wide = wide || m.depth() == CV_32S || m.depth() == CV_64F;
+    }
+    if (first == nullptr) CV_Error(cv::Error::StsBadArg, "expression has no Mat input");
+    if (dtype < 0) dtype = first->depth();
+    CV_Assert(dtype <= CV_64F && dtype != CV_16F);
+
+    // an input may share dst's data, the block is loaded before it is stored so it is safe
+    const cv::Size size = first->size();
+    const int cn = first->channels();
+    CV_Assert(cn <= 4);
+    dst.create(size, CV_MAKETYPE(dtype, cn));
+    // 32-bit ints and doubles do not fit in float
+    if (wide) {
+        run<double>(program, root, dst);
+    } else {
+        run<float>(program, root, dst);
+    }
+}
+
+}  // namespace cvd
+
+CvStatus* cv_ElemExpr_create(ElemExpr* rval) {
+    BEGIN_WRAP
+    *rval = {new cvd::ElemExpr()};
+    END_WRAP
+}
+
+void cv_ElemExpr_close(ElemExprPtr self) {
+    CVD_FREE(self);
+}
+
+CvStatus* cv_ElemExpr_input(ElemExpr self, Mat m, int* rval) {
+    BEGIN_WRAP
+    *rval = self.ptr->input(CVDEREF(m));
+    END_WRAP
+}
+
+CvStatus* cv_ElemExpr_setInput(ElemExpr self, int node, Mat m) {
+    BEGIN_WRAP
+    self.ptr->setInput(node, CVDEREF(m));
+    END_WRAP
+}
+
+CvStatus* cv_ElemExpr_constant(ElemExpr self, Scalar value, int* rval) {
+    BEGIN_WRAP
+    *rval = self.ptr->constant(cv::Scalar(value.val1, value.val2, value.val3, value.val4));
+    END_WRAP
+}
+
+CvStatus* cv_ElemExpr_binary(ElemExpr self, int op, int a, int b, int* rval) {
+    BEGIN_WRAP
+    *rval = self.ptr->binary(op, a, b);
+    END_WRAP
+}
+
+CvStatus* cv_ElemExpr_compare(ElemExpr self, int cmpop, int a, int b, int* rval) {
+    BEGIN_WRAP
+    *rval = self.ptr->compare(cmpop, a, b);
+    END_WRAP
+}
+
+CvStatus* cv_ElemExpr_abs(ElemExpr self, int a, int* rval) {
+    BEGIN_WRAP
+    *rval = self.ptr->abs(a);
+    END_WRAP
+}
+
+CvStatus* cv_ElemExpr_cast(ElemExpr self, int a, int depth, int* rval) {
+    BEGIN_WRAP
+    *rval = self.ptr->cast(a, depth);
+    END_WRAP
+}
+
+CvStatus* cv_ElemExpr_evaluate(ElemExpr self, int root, int dtype, Mat dst, CvCallback_0 callback) {
+    BEGIN_WRAP
+    self.ptr->evaluate(root, dtype, CVDEREF(dst));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+int cv_ElemExpr_size(ElemExpr self) {
+    return self.ptr->size();
+}
+
+void cv_ElemExpr_clear(ElemExpr self) {
+    self.ptr->clear();
+}
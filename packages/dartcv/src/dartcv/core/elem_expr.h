@@ -0,0 +1,114 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_ELEM_EXPR_H
+#define DARTCV_LIBRARY_ELEM_EXPR_H
+
+#ifdef __cplusplus
+#include <opencv2/core.hpp>
+#include <vector>
+
+namespace cvd {
+// Elementwise expression over Mats and scalars, evaluated in one row-parallel pass.
+//
+// Nodes are added bottom-up and identified by their index, so the children of a node always
+// have smaller ids and the node list is already in evaluation order. evaluate() walks the
+// rows in blocks small enough to stay in L1, computes every node reachable from the root for
+// the block, then saturates the root into dst: no full-size temporary is created.
+class ElemExpr {
+  public:
+    enum Op {
+        OP_INPUT = 0,
+        OP_CONSTANT = 1,
+        OP_ADD = 2,
+        OP_SUB = 3,
+        OP_MUL = 4,
+        OP_DIV = 5,
+        OP_ABS = 6,
+        OP_MIN = 7,
+        OP_MAX = 8,
+        OP_COMPARE = 9,
+        OP_CAST = 10,
+    };
+
+    int input(const cv::Mat& m);
+    void setInput(int node, const cv::Mat& m);
+    int constant(const cv::Scalar& value);
+    // a (op) b, for OP_ADD to OP_MAX
+    int binary(int op, int a, int b);
+    // 255 where `a cmpop b` holds, else 0, like cv::compare
+    int compare(int cmpop, int a, int b);
+    int abs(int a);
+    // saturate_cast to depth (rounding for integer depths), then continue in the working type
+    int cast(int a, int depth);
+
+    // dtype < 0 means the depth of the first Mat input
+    void evaluate(int root, int dtype, cv::Mat& dst) const;
+
+    int size() const { return static_cast<int>(nodes_.size()); }
+    void clear() {
+        nodes_.clear();
+        inputs_.clear();
+    }
+
+  private:
+    struct Node {
+        int op;
+        int a;
+        int b;
+        // input index for OP_INPUT, cmpop for OP_COMPARE, depth for OP_CAST
+        int arg;
+        cv::Scalar value;
+    };
+
+    int add(const Node& node);
+    void checkNode(int node) const;
+    template <typename T>
+    void run(const std::vector<int>& program, int root, cv::Mat& dst) const;
+
+    std::vector<Node> nodes_;
+    std::vector<cv::Mat> inputs_;
+};
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+CVD_TYPEDEF(cvd::ElemExpr, ElemExpr);
+#else
+CVD_TYPEDEF(void, ElemExpr);
+#endif
+
+CvStatus* cv_ElemExpr_create(ElemExpr* rval);
+void cv_ElemExpr_close(ElemExprPtr self);
+
+// Adds a Mat input, the Mat is referenced (not copied) until it is replaced or the expression is
+// closed. All inputs used by an evaluation must have the same size and channels.
+CvStatus* cv_ElemExpr_input(ElemExpr self, Mat m, int* rval);
+// Replaces the Mat of an input node, e.g., with the next video frame.
+CvStatus* cv_ElemExpr_setInput(ElemExpr self, int node, Mat m);
+// Adds a per-channel constant.
+CvStatus* cv_ElemExpr_constant(ElemExpr self, Scalar value, int* rval);
+CvStatus* cv_ElemExpr_binary(ElemExpr self, int op, int a, int b, int* rval);
+CvStatus* cv_ElemExpr_compare(ElemExpr self, int cmpop, int a, int b, int* rval);
+CvStatus* cv_ElemExpr_abs(ElemExpr self, int a, int* rval);
+CvStatus* cv_ElemExpr_cast(ElemExpr self, int a, int depth, int* rval);
+
+// Evaluates the expression rooted at `root` into dst of depth dtype (the depth of the first
+// input if < 0) and the channels of the inputs.
+CvStatus* cv_ElemExpr_evaluate(
+    ElemExpr self, int root, int dtype, CVD_OUT Mat dst, CvCallback_0 callback
+);
+
+int cv_ElemExpr_size(ElemExpr self);
+void cv_ElemExpr_clear(ElemExpr self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_ELEM_EXPR_H
@@ -0,0 +1,250 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/core/image_stats.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace cvd {
+
+namespace {
+struct Acc {
+    int64_t count = 0;
+    int64_t nonzero = 0;
+    double sum = 0;
+    double sumsq = 0;
+    double sumabs = 0;
+    double minv = DBL_MAX;
+    double maxv = -DBL_MAX;
+    int minx = -1, miny = -1, maxx = -1, maxy = -1;
+
+    void merge(const Acc& o) {
+        count += o.count;
+        nonzero += o.nonzero;
+        sum += o.sum;
+        sumsq += o.sumsq;
+        sumabs += o.sumabs;
+        // o is later in raster order, strict comparisons keep the first extremum like minMaxLoc
+        if (o.minv < minv) {
+            minv = o.minv;
+            minx = o.minx;
+            miny = o.miny;
+        }
+        if (o.maxv > maxv) {
+            maxv = o.maxv;
+            maxx = o.maxx;
+            maxy = o.maxy;
+        }
+    }
+};
+
+// rows [y0, y1) of grid row gy, accumulated on its own and merged in order afterwards
+struct Unit {
+    int gy;
+    int y0;
+    int y1;
+};
+
+struct HistParams {
+    int bins;
+    double min;
+    double scale;
+};
+}  // namespace
+
+template <typename T>
+static void accumulate(
+    const cv::Mat& src,
+    const cv::Mat& mask,
+    const Unit& unit,
+    const std::vector<int>& xs,
+    int flags,
+    const HistParams& hp,
+    Acc* acc,
+    int* hist
+) {
+    const int cn = src.channels();
+    const int gridCols = static_cast<int>(xs.size()) - 1;
+    const bool minmax = (flags & STATS_MINMAX) != 0;
+    const bool nonzero = (flags & STATS_NONZERO) != 0;
+    const bool histo = (flags & STATS_HIST) != 0;
+    for (int y = unit.y0; y < unit.y1; y++) {
+        const T* row = src.ptr<T>(y);
+        const uchar* mrow = mask.empty() ? nullptr : mask.ptr<uchar>(y);
+        for (int gx = 0; gx < gridCols; gx++) {
+            Acc* a = acc + gx * cn;
+            int* h = hist + static_cast<size_t>(gx) * cn * hp.bins;
+            for (int x = xs[gx]; x < xs[gx + 1]; x++) {
+                if (mrow != nullptr && mrow[x] == 0) continue;
+                const T* p = row + x * cn;
+                for (int c = 0; c < cn; c++) {
+                    const double v = static_cast<double>(p[c]);
+                    Acc& s = a[c];
+                    s.count++;
+                    s.sum += v;
+                    s.sumsq += v * v;
+                    s.sumabs += std::abs(v);
+                    if (minmax) {
+                        if (v < s.minv) {
+                            s.minv = v;
+                            s.minx = x;
+                            s.miny = y;
+                        }
+                        if (v > s.maxv) {
+                            s.maxv = v;
+                            s.maxx = x;
+                            s.maxy = y;
+                        }
+                    }
+                    if (nonzero && v != 0) s.nonzero++;
+                    if (histo) {
+                        const double b = (v - hp.min) * hp.scale;
+                        if (b >= 0 && b < hp.bins) h[c * hp.bins + static_cast<int>(b)]++;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void imageStats(
+    const cv::Mat& src,
+    const cv::Mat& mask,
+    int flags,
+    cv::Size grid,
+    int histBins,
+    double histMin,
+    double histMax,
+    cv::Mat& stats,
+    cv::Mat& hist
+) {
+    CV_Assert(!src.empty() && src.dims <= 2 && src.depth() != CV_16F);
+    CV_Assert(mask.empty() || (mask.type() == CV_8UC1 && mask.size() == src.size()));
+    CV_Assert(grid.width >= 1 && grid.height >= 1);
+    CV_Assert(grid.width <= src.cols && grid.height <= src.rows);
+    const bool histo = (flags & STATS_HIST) != 0;
+    if (histo) CV_Assert(histBins > 0 && histMax > histMin);
+    const HistParams hp{histo ? histBins : 0, histMin, histo ? histBins / (histMax - histMin) : 0};
+
+    const int cn = src.channels();
+    const int ncells = grid.area();
+    std::vector<int> xs(grid.width + 1), ys(grid.height + 1);
+    for (int i = 0; i <= grid.width; i++) {
+        xs[i] = static_cast<int>(static_cast<int64_t>(src.cols) * i / grid.width);
+    }
+    for (int i = 0; i <= grid.height; i++) {
+        ys[i] = static_cast<int>(static_cast<int64_t>(src.rows) * i / grid.height);
+    }
+
+    // a few units per thread, never across grid rows
+    std::vector<Unit> units;
+    const int target = std::max(1, cv::getNumThreads()) * 4;
+    const int chunks = std::max(1, (target + grid.height - 1) / grid.height);
+    for (int gy = 0; gy < grid.height; gy++) {
+        const int rows = ys[gy + 1] - ys[gy];
+        const int step = std::max(8, (rows + chunks - 1) / chunks);
+        for (int y = ys[gy]; y < ys[gy + 1]; y += step) {
+            units.push_back({gy, y, std::min(y + step, ys[gy + 1])});
+        }
+    }
+
+    const size_t accPerUnit = static_cast<size_t>(grid.width) * cn;
+    const size_t histPerUnit = accPerUnit * hp.bins;
+    std::vector<Acc> accs(units.size() * accPerUnit);
+    std::vector<int> hists(units.size() * histPerUnit, 0);
+    cv::parallel_for_(cv::Range(0, static_cast<int>(units.size())), [&](const cv::Range& range) {
+        for (int i = range.start; i < range.end; i++) {
+            Acc* acc = accs.data() + i * accPerUnit;
+            int* h = hists.data() + i * histPerUnit;
+            switch (src.depth()) {
+            case CV_8U: accumulate<uchar>(src, mask, units[i], xs, flags, hp, acc, h); break;
+            case CV_8S: accumulate<schar>(src, mask, units[i], xs, flags, hp, acc, h); break;
+            case CV_16U: accumulate<ushort>(src, mask, units[i], xs, flags, hp, acc, h); break;
+            case CV_16S: accumulate<short>(src, mask, units[i], xs, flags, hp, acc, h); break;
+            case CV_32S: accumulate<int>(src, mask, units[i], xs, flags, hp, acc, h); break;
+            case CV_32F: accumulate<float>(src, mask, units[i], xs, flags, hp, acc, h); break;
+            default: accumulate<double>(src, mask, units[i], xs, flags, hp, acc, h); break;
+            }
+        }
+    });
+
+    // units are in raster order, so merging in order is deterministic
+    std::vector<Acc> cells(static_cast<size_t>(ncells) * cn);
+    if (histo) {
+        hist.create(ncells * cn, hp.bins, CV_32S);
+        hist.setTo(0);
+    } else {
+        // a hist reused from a previous call must not keep its stale counts
+        hist.release();
+    }
+    for (size_t i = 0; i < units.size(); i++) {
+        const size_t cell0 = static_cast<size_t>(units[i].gy) * grid.width * cn;
+        for (size_t j = 0; j < accPerUnit; j++) cells[cell0 + j].merge(accs[i * accPerUnit + j]);
+        if (!histo) continue;
+        int* dst = hist.ptr<int>(static_cast<int>(cell0));
+        const int* h = hists.data() + i * histPerUnit;
+        for (size_t j = 0; j < histPerUnit; j++) dst[j] += h[j];
+    }
+
+    stats.create(ncells * cn, STAT_MAX_COLS, CV_64F);
+    stats.setTo(0);
+    for (int r = 0; r < ncells * cn; r++) {
+        const Acc& s = cells[r];
+        double* out = stats.ptr<double>(r);
+        out[STAT_COUNT] = static_cast<double>(s.count);
+        const double n = std::max<double>(static_cast<double>(s.count), 1);
+        const double mean = s.sum / n;
+        if (flags & STATS_SUM) out[STAT_SUM] = s.sum;
+        if (flags & STATS_MEAN) out[STAT_MEAN] = mean;
+        if (flags & STATS_STDDEV) {
+            out[STAT_STDDEV] = std::sqrt(std::max(s.sumsq / n - mean * mean, 0.0));
+        }
+        if (flags & STATS_MINMAX) {
+            out[STAT_MIN] = s.count > 0 ? s.minv : 0;
+            out[STAT_MAX] = s.count > 0 ? s.maxv : 0;
+            out[STAT_MIN_X] = s.minx;
+            out[STAT_MIN_Y] = s.miny;
+            out[STAT_MAX_X] = s.maxx;
+            out[STAT_MAX_Y] = s.maxy;
+        }
+        if (flags & STATS_NONZERO) out[STAT_NONZERO] = static_cast<double>(s.nonzero);
+        if (flags & STATS_NORM_L1) out[STAT_NORM_L1] = s.sumabs;
+        if (flags & STATS_NORM_L2) out[STAT_NORM_L2] = std::sqrt(s.sumsq);
+    }
+}
+
+}  // namespace cvd
+
+CvStatus* cv_imageStats(
+    Mat src,
+    Mat mask,
+    int flags,
+    CvSize grid,
+    int histBins,
+    double histMin,
+    double histMax,
+    Mat stats,
+    Mat hist,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    cvd::imageStats(
+        CVDEREF(src),
+        CVDEREF(mask),
+        flags,
+        cv::Size(grid.width, grid.height),
+        histBins,
+        histMin,
+        histMax,
+        CVDEREF(stats),
+        CVDEREF(hist)
+    );
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
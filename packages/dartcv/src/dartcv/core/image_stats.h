@@ -0,0 +1,86 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_IMAGE_STATS_H
+#define DARTCV_LIBRARY_IMAGE_STATS_H
+
+#ifdef __cplusplus
+#include <opencv2/core.hpp>
+
+namespace cvd {
+// statistics requested by the flags of imageStats
+enum {
+    STATS_SUM = 1,
+    STATS_MEAN = 2,
+    STATS_STDDEV = 4,
+    STATS_MINMAX = 8,
+    STATS_NONZERO = 16,
+    STATS_NORM_L1 = 32,
+    STATS_NORM_L2 = 64,
+    STATS_HIST = 128,
+};
+
+// columns of the stats Mat of imageStats
+enum {
+    STAT_COUNT = 0,
+    STAT_SUM,
+    STAT_MEAN,
+    STAT_STDDEV,
+    STAT_MIN,
+    STAT_MAX,
+    STAT_MIN_X,
+    STAT_MIN_Y,
+    STAT_MAX_X,
+    STAT_MAX_Y,
+    STAT_NONZERO,
+    STAT_NORM_L1,
+    STAT_NORM_L2,
+    STAT_MAX_COLS,
+};
+
+// Computes the requested statistics of every channel of every grid cell in one parallel pass.
+//
+// stats is a (grid.area() * channels) x STAT_MAX_COLS CV_64F Mat, row cell * channels + c with
+// cells in row-major order; columns that are not requested are 0. hist (if STATS_HIST) is a
+// (grid.area() * channels) x histBins CV_32S Mat of the values in [histMin, histMax), it is
+// released otherwise.
+// Min/max locations are in src coordinates, -1 if the cell has no (unmasked) pixel.
+void imageStats(
+    const cv::Mat& src,
+    const cv::Mat& mask,
+    int flags,
+    cv::Size grid,
+    int histBins,
+    double histMin,
+    double histMax,
+    cv::Mat& stats,
+    cv::Mat& hist
+);
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+
+// One-pass replacement of mean, meanStdDev, minMaxLoc, countNonZero, norm (per channel) and a
+// coarse calcHist, optionally per cell of a grid (CvSize{1, 1} for the whole image).
+CvStatus* cv_imageStats(
+    Mat src,
+    Mat mask,
+    int flags,
+    CvSize grid,
+    int histBins,
+    double histMin,
+    double histMax,
+    CVD_OUT Mat stats,
+    CVD_OUT Mat hist,
+    CvCallback_0 callback
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_IMAGE_STATS_H
@@ -0,0 +1,204 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/core/incremental_pca.h"
+#include <algorithm>
+
+namespace cvd {
+
+IncrementalPCA::IncrementalPCA(int maxComponents) : maxComponents_(maxComponents) {
+    CV_Assert(maxComponents >= 0);
+}
+
+void IncrementalPCA::partialFit(const cv::Mat& batch) {
+    CV_Assert(!batch.empty() && batch.dims == 2 && batch.channels() == 1);
+    CV_Assert(n_ == 0 || batch.cols == mean_.cols);
+    cv::Mat x;
+    batch.convertTo(x, CV_64F);
+    const int m = x.rows;
+    if (n_ == 0) {
+        mean_ = cv::Mat::zeros(1, x.cols, CV_64F);
+        scatter_ = cv::Mat::zeros(x.cols, x.cols, CV_64F);
+    }
+
+    cv::Mat batchMean, batchScatter;
+    cv::reduce(x, batchMean, 0, cv::REDUCE_AVG, CV_64F);
+    // (x - batchMean)^T * (x - batchMean)
+    cv::mulTransposed(x, batchScatter, true, batchMean, 1, CV_64F);
+
+    // merge with the previous samples (Chan et al.)
+    const double total = static_cast<double>(n_) + m;
+    const cv::Mat delta = batchMean - mean_;
+    scatter_ += batchScatter;
+    const double w = static_cast<double>(n_) * m / total;
+    cv::gemm(delta, delta, w, scatter_, 1, scatter_, cv::GEMM_1_T);
+    mean_ += delta * (m / total);
+    n_ += m;
+    dirty_ = true;
+}
+
+void IncrementalPCA::compute() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!dirty_) return;
+    if (n_ == 0) CV_Error(cv::Error::StsError, "no samples, call partialFit first");
+    cv::Mat values, vectors;
+    cv::eigen(scatter_ / static_cast<double>(n_), values, vectors);
+    const int k = maxComponents_ > 0 ? std::min(maxComponents_, mean_.cols) : mean_.cols;
+    pca_.mean = mean_.clone();
+    pca_.eigenvalues = values.rowRange(0, k).clone();
+    pca_.eigenvectors = vectors.rowRange(0, k).clone();
+    dirty_ = false;
+}
+
+const cv::Mat& IncrementalPCA::mean() const {
+    compute();
+    return pca_.mean;
+}
+
+const cv::Mat& IncrementalPCA::eigenvectors() const {
+    compute();
+    return pca_.eigenvectors;
+}
+
+const cv::Mat& IncrementalPCA::eigenvalues() const {
+    compute();
+    return pca_.eigenvalues;
+}
+
+void IncrementalPCA::project(const cv::Mat& data, cv::Mat& result) const {
+    compute();
+    pca_.project(data, result);
+}
+
+void IncrementalPCA::backProject(const cv::Mat& data, cv::Mat& result) const {
+    compute();
+    pca_.backProject(data, result);
+}
+
+void IncrementalPCA::save(const std::string& filename) const {
+    cv::FileStorage fs(filename, cv::FileStorage::WRITE);
+    if (!fs.isOpened()) CV_Error(cv::Error::StsError, "can not open " + filename);
+    fs << "maxComponents" << maxComponents_;
+    // FileStorage has no 64-bit integers, a double is exact up to 2^53 samples
+    fs << "n" << static_cast<double>(n_);
+    fs << "scatter" << scatter_;
+    if (n_ > 0) {
+        // "mean", "vectors" and "values", readable by cv::PCA::read
+        compute();
+        pca_.write(fs);
+    }
+}
+
+void IncrementalPCA::load(const std::string& filename) {
+    cv::FileStorage fs(filename, cv::FileStorage::READ);
+    if (!fs.isOpened()) CV_Error(cv::Error::StsError, "can not open " + filename);
+    int maxComponents = 0;
+    double n = 0;
+    cv::Mat mean, scatter;
+    fs["maxComponents"] >> maxComponents;
+    fs["n"] >> n;
+    fs["scatter"] >> scatter;
+    fs["mean"] >> mean;
+    if (n > 0) {
+        CV_Assert(mean.rows == 1 && mean.type() == CV_64F);
+        CV_Assert(scatter.rows == mean.cols && scatter.cols == mean.cols);
+        CV_Assert(scatter.type() == CV_64F);
+    }
+    maxComponents_ = maxComponents;
+    n_ = static_cast<int64>(n);
+    mean_ = mean;
+    scatter_ = scatter;
+    dirty_ = true;
+}
+
+}  // namespace cvd
+
+CvStatus* cv_IncrementalPCA_create(int maxComponents, IncrementalPCA* rval) {
+    BEGIN_WRAP
+    *rval = {new cvd::IncrementalPCA(maxComponents)};
+    END_WRAP
+}
+
+void cv_IncrementalPCA_close(IncrementalPCAPtr self) {
+    CVD_FREE(self);
+}
+
+CvStatus* cv_IncrementalPCA_partialFit(IncrementalPCA self, Mat batch, CvCallback_0 callback) {
+    BEGIN_WRAP
+    self.ptr->partialFit(CVDEREF(batch));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_IncrementalPCA_project(
+    IncrementalPCA self, Mat data, Mat result, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    self.ptr->project(CVDEREF(data), CVDEREF(result));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_IncrementalPCA_backProject(
+    IncrementalPCA self, Mat data, Mat result, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    self.ptr->backProject(CVDEREF(data), CVDEREF(result));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_IncrementalPCA_getMean(IncrementalPCA self, Mat rval) {
+    BEGIN_WRAP
+    self.ptr->mean().copyTo(CVDEREF(rval));
+    END_WRAP
+}
+
+CvStatus* cv_IncrementalPCA_getEigenvectors(IncrementalPCA self, Mat rval) {
+    BEGIN_WRAP
+    self.ptr->eigenvectors().copyTo(CVDEREF(rval));
+    END_WRAP
+}
+
+CvStatus* cv_IncrementalPCA_getEigenvalues(IncrementalPCA self, Mat rval) {
+    BEGIN_WRAP
+    self.ptr->eigenvalues().copyTo(CVDEREF(rval));
+    END_WRAP
+}
+
+CvStatus* cv_IncrementalPCA_save(IncrementalPCA self, const char* filename, CvCallback_0 callback) {
+    BEGIN_WRAP
+    self.ptr->save(filename);
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_IncrementalPCA_load(IncrementalPCA self, const char* filename, CvCallback_0 callback) {
+    BEGIN_WRAP
+    self.ptr->load(filename);
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+int64_t cv_IncrementalPCA_getNumSamples(IncrementalPCA self) {
+    return self.ptr->numSamples();
+}
+
+int cv_IncrementalPCA_getMaxComponents(IncrementalPCA self) {
+    return self.ptr->maxComponents();
+}
+
+int cv_IncrementalPCA_getDims(IncrementalPCA self) {
+    return self.ptr->dims();
+}
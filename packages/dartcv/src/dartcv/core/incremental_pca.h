@@ -0,0 +1,98 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_INCREMENTAL_PCA_H
+#define DARTCV_LIBRARY_INCREMENTAL_PCA_H
+
+#ifdef __cplusplus
+#include <opencv2/core.hpp>
+#include <mutex>
+#include <string>
+
+namespace cvd {
+// PCA of samples (rows) fed in batches, for corpora that do not fit in one Mat.
+//
+// Only the count, the mean and the d x d scatter matrix are kept (in double), every batch is
+// merged with the parallel update of Chan et al., so the memory does not depend on the
+// number of samples. The eigen decomposition of the covariance (scaled by 1/n like
+// cv::PCACompute) is computed lazily when the components are needed, under a lock so that
+// concurrent projections after a partialFit do not race on it.
+class IncrementalPCA {
+  public:
+    explicit IncrementalPCA(int maxComponents);
+
+    void partialFit(const cv::Mat& batch);
+    void project(const cv::Mat& data, cv::Mat& result) const;
+    void backProject(const cv::Mat& data, cv::Mat& result) const;
+
+    // 1 x d, CV_64F
+    const cv::Mat& mean() const;
+    // maxComponents x d, CV_64F, one component per row
+    const cv::Mat& eigenvectors() const;
+    // maxComponents x 1, CV_64F, descending
+    const cv::Mat& eigenvalues() const;
+
+    // FileStorage format (.yml, .xml or .json): the state to keep fitting and the components.
+    void save(const std::string& filename) const;
+    void load(const std::string& filename);
+
+    int64 numSamples() const { return n_; }
+    int maxComponents() const { return maxComponents_; }
+    int dims() const { return mean_.cols; }
+
+  private:
+    void compute() const;
+
+    int maxComponents_;
+    int64 n_ = 0;
+    cv::Mat mean_;
+    cv::Mat scatter_;
+    mutable std::mutex mutex_;
+    mutable bool dirty_ = true;
+    mutable cv::PCA pca_;
+};
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+CVD_TYPEDEF(cvd::IncrementalPCA, IncrementalPCA);
+#else
+CVD_TYPEDEF(void, IncrementalPCA);
+#endif
+
+// Keeps maxComponents components (all if 0).
+CvStatus* cv_IncrementalPCA_create(int maxComponents, IncrementalPCA* rval);
+void cv_IncrementalPCA_close(IncrementalPCAPtr self);
+
+// Adds a batch of samples, one per row, of any depth.
+CvStatus* cv_IncrementalPCA_partialFit(IncrementalPCA self, Mat batch, CvCallback_0 callback);
+// Same as cv_PCAProject/cv_PCABackProject with the current mean and eigenvectors.
+CvStatus* cv_IncrementalPCA_project(
+    IncrementalPCA self, Mat data, CVD_OUT Mat result, CvCallback_0 callback
+);
+CvStatus* cv_IncrementalPCA_backProject(
+    IncrementalPCA self, Mat data, CVD_OUT Mat result, CvCallback_0 callback
+);
+
+CvStatus* cv_IncrementalPCA_getMean(IncrementalPCA self, CVD_OUT Mat rval);
+CvStatus* cv_IncrementalPCA_getEigenvectors(IncrementalPCA self, CVD_OUT Mat rval);
+CvStatus* cv_IncrementalPCA_getEigenvalues(IncrementalPCA self, CVD_OUT Mat rval);
+
+CvStatus* cv_IncrementalPCA_save(IncrementalPCA self, const char* filename, CvCallback_0 callback);
+CvStatus* cv_IncrementalPCA_load(IncrementalPCA self, const char* filename, CvCallback_0 callback);
+
+int64_t cv_IncrementalPCA_getNumSamples(IncrementalPCA self);
+int cv_IncrementalPCA_getMaxComponents(IncrementalPCA self);
+int cv_IncrementalPCA_getDims(IncrementalPCA self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_INCREMENTAL_PCA_H
@@ -0,0 +1,295 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/core/kmeans.h"
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+
+namespace cvd {
+
+// samples per parallel chunk of predict, also the unit of its deterministic reduction
+static constexpr size_t kChunkSize = 4096;
+
+// A uniform index in [0, n), next() % n favours the low indices when n does not divide 2^32.
+static size_t uniformIndex(cv::RNG& rng, size_t n) {
+    const uint64 range = n;
+    uint64 v;
+    if (range <= 0xFFFFFFFFu) {
+        const uint64 limit = (uint64(1) << 32) - (uint64(1) << 32) % range;
+        do {
+            v = rng.next();
+        } while (v >= limit);
+    } else {
+        const uint64 limit = UINT64_MAX - UINT64_MAX % range;
+        do {
+            v = (uint64(rng.next()) << 32) | rng.next();
+        } while (v >= limit);
+    }
+    return static_cast<size_t>(v % range);
+}
+
+template <typename T>
+static void loadAs(const uchar* data, size_t i, int d, float* out) {
+    const T* p = reinterpret_cast<const T*>(data) + i * d;
+    for (int j = 0; j < d; j++) out[j] = static_cast<float>(p[j]);
+}
+
+void MiniBatchKMeans::Samples::load(size_t i, float* out) const {
+    switch (depth) {
+    case CV_8U: loadAs<uchar>(data, i, d, out); break;
+    case CV_8S: loadAs<schar>(data, i, d, out); break;
+    case CV_16U: loadAs<ushort>(data, i, d, out); break;
+    case CV_16S: loadAs<short>(data, i, d, out); break;
+    case CV_32S: loadAs<int>(data, i, d, out); break;
+    case CV_32F: loadAs<float>(data, i, d, out); break;
+    default: loadAs<double>(data, i, d, out); break;
+    }
+}
+
+MiniBatchKMeans::MiniBatchKMeans(
+    int k, int batchSize, cv::TermCriteria criteria, int seedSamples, uint64 seed
+) :
+    k_(k), batchSize_(batchSize), criteria_(criteria), seedSamples_(seedSamples), rng_(seed) {
+    CV_Assert(k > 0 && batchSize > 0 && seedSamples >= k);
+}
+
+MiniBatchKMeans::Samples MiniBatchKMeans::view(const cv::Mat& data, cv::Mat& holder) {
+    CV_Assert(!data.empty() && data.dims <= 2 && data.depth() != CV_16F);
+    holder = data.isContinuous() ? data : data.clone();
+    Samples samples{holder.data, 0, 0, holder.depth()};
+    if (holder.channels() > 1) {
+        samples.n = holder.total();
+        samples.d = holder.channels();
+    } else {
+        samples.n = static_cast<size_t>(holder.rows);
+        samples.d = holder.cols;
+    }
+    return samples;
+}
+
+void MiniBatchKMeans::setCenters(const cv::Mat& centers) {
+    CV_Assert(centers.rows == k_ && centers.channels() == 1 && centers.cols > 0);
+    centers.convertTo(centers_, CV_32F);
+    // the given centers weigh as much as one mini-batch, like the centers of a warm start, so
+    // the first samples assigned to them move them instead of replacing them
+    counts_.assign(k_, std::max(1.0, static_cast<double>(batchSize_) / k_));
+}
+
+int MiniBatchKMeans::nearest(const float* x, float& dist) const {
+    const int d = centers_.cols;
+    int best = 0;
+    float bestDist = FLT_MAX;
+    for (int c = 0; c < k_; c++) {
+        const float* center = centers_.ptr<float>(c);
+        float s = 0;
+        for (int j = 0; j < d; j++) {
+            const float t = x[j] - center[j];
+            s += t * t;
+        }
+        if (s < bestDist) {
+            bestDist = s;
+            best = c;
+        }
+    }
+    dist = bestDist;
+    return best;
+}
+
+// k-means++ on a random subsample
+void MiniBatchKMeans::seed(const Samples& samples) {
+    const int d = samples.d;
+    const int m = static_cast<int>(std::min<size_t>(samples.n, seedSamples_));
+    cv::Mat sub(m, d, CV_32F);
+    for (int i = 0; i < m; i++) {
+        // the whole data if it is small enough
+        const size_t idx = m == static_cast<int>(samples.n) ? i : uniformIndex(rng_, samples.n);
+        samples.load(idx, sub.ptr<float>(i));
+    }
+
+    centers_.create(k_, d, CV_32F);
+    sub.row(rng_.uniform(0, m)).copyTo(centers_.row(0));
+    std::vector<float> dist(m, FLT_MAX);
+    for (int c = 1; c < k_; c++) {
+        const float* prev = centers_.ptr<float>(c - 1);
+        cv::parallel_for_(cv::Range(0, m), [&](const cv::Range& range) {
+            for (int i = range.start; i < range.end; i++) {
+                const float* x = sub.ptr<float>(i);
+                float s = 0;
+                for (int j = 0; j < d; j++) {
+                    const float t = x[j] - prev[j];
+                    s += t * t;
+                }
+                dist[i] = std::min(dist[i], s);
+            }
+        });
+        double total = 0;
+        for (int i = 0; i < m; i++) total += dist[i];
+        int pick = rng_.uniform(0, m);
+        // all samples on the existing centers: any sample will do
+        if (total > 0) {
+            double r = rng_.uniform(0., total);
+            for (pick = 0; pick < m - 1; pick++) {
+                r -= dist[pick];
+                if (r <= 0) break;
+            }
+        }
+        sub.row(pick).copyTo(centers_.row(c));
+    }
+    counts_.assign(k_, 0);
+}
+
+double MiniBatchKMeans::fit(const cv::Mat& data, bool warmStart, cv::Mat& labels) {
+    cv::Mat holder;
+    const Samples samples = view(data, holder);
+    CV_Assert(samples.n >= static_cast<size_t>(k_));
+    if (!warmStart || centers_.empty() || centers_.cols != samples.d) {
+        seed(samples);
+    } else {
+        // the previous data weighs as much as one mini-batch, so the centers follow new data
+        const double prior = std::max(1.0, static_cast<double>(batchSize_) / k_);
+        for (auto& c : counts_) c = std::min(c, prior);
+    }
+
+    const int d = samples.d;
+    const int maxIter = (criteria_.type & cv::TermCriteria::COUNT) ? criteria_.maxCount : 100;
+    const double eps = (criteria_.type & cv::TermCriteria::EPS) ? criteria_.epsilon : 0;
+    const int batch = static_cast<int>(std::min<size_t>(batchSize_, samples.n));
+    cv::Mat x(batch, d, CV_32F);
+    std::vector<int> assign(batch);
+    cv::Mat previous;
+
+    iterations_ = 0;
+    for (int it = 0; it < maxIter; it++) {
+        for (int b = 0; b < batch; b++) {
+            samples.load(uniformIndex(rng_, samples.n), x.ptr<float>(b));
+        }
+        cv::parallel_for_(cv::Range(0, batch), [&](const cv::Range& range) {
+            float dist;
+            for (int b = range.start; b < range.end; b++) {
+                assign[b] = nearest(x.ptr<float>(b), dist);
+            }
+        });
+
+        centers_.copyTo(previous);
+        for (int b = 0; b < batch; b++) {
+            const int c = assign[b];
+            counts_[c] += 1;
+            const float eta = static_cast<float>(1.0 / counts_[c]);
+            float* center = centers_.ptr<float>(c);
+            const float* xb = x.ptr<float>(b);
+            for (int j = 0; j < d; j++) center[j] += eta * (xb[j] - center[j]);
+        }
+        iterations_ = it + 1;
+
+        double shift = 0;
+        for (int c = 0; c < k_; c++) {
+            shift = std::max(shift, cv::norm(centers_.row(c), previous.row(c)));
+        }
+        if (shift <= eps) break;
+    }
+    return predict(holder, labels);
+}
+
+double MiniBatchKMeans::predict(const cv::Mat& data, cv::Mat& labels) const {
+    CV_Assert(!centers_.empty());
+    cv::Mat holder;
+    const Samples samples = view(data, holder);
+    CV_Assert(samples.d == centers_.cols);
+
+    labels.create(static_cast<int>(samples.n), 1, CV_32S);
+    int* plabels = labels.ptr<int>();
+    const int nchunks = static_cast<int>((samples.n + kChunkSize - 1) / kChunkSize);
+    std::vector<double> compactness(nchunks, 0);
+    cv::parallel_for_(cv::Range(0, nchunks), [&](const cv::Range& range) {
+        std::vector<float> x(samples.d);
+        for (int chunk = range.start; chunk < range.end; chunk++) {
+            const size_t end = std::min(samples.n, (chunk + 1) * kChunkSize);
+            double sum = 0;
+            for (size_t i = chunk * kChunkSize; i < end; i++) {
+                float dist;
+                samples.load(i, x.data());
+                plabels[i] = nearest(x.data(), dist);
+                sum += dist;
+            }
+            compactness[chunk] = sum;
+        }
+    });
+    double total = 0;
+    for (double c : compactness) total += c;
+    return total;
+}
+
+}  // namespace cvd
+
+CvStatus* cv_MiniBatchKMeans_create(
+    int k,
+    int batchSize,
+    TermCriteria criteria,
+    int seedSamples,
+    uint64_t seed,
+    MiniBatchKMeans* rval
+) {
+    BEGIN_WRAP
+    auto tc = cv::TermCriteria(criteria.type, criteria.maxCount, criteria.epsilon);
+    *rval = {new cvd::MiniBatchKMeans(k, batchSize, tc, seedSamples, seed)};
+    END_WRAP
+}
+
+void cv_MiniBatchKMeans_close(MiniBatchKMeansPtr self) {
+    CVD_FREE(self);
+}
+
+CvStatus* cv_MiniBatchKMeans_fit(
+    MiniBatchKMeans self,
+    Mat data,
+    bool warmStart,
+    Mat labels,
+    Mat centers,
+    double* rval,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    *rval = self.ptr->fit(CVDEREF(data), warmStart, CVDEREF(labels));
+    self.ptr->centers().copyTo(CVDEREF(centers));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_MiniBatchKMeans_predict(
+    MiniBatchKMeans self, Mat data, Mat labels, double* rval, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    *rval = self.ptr->predict(CVDEREF(data), CVDEREF(labels));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_MiniBatchKMeans_getCenters(MiniBatchKMeans self, Mat centers) {
+    BEGIN_WRAP
+    self.ptr->centers().copyTo(CVDEREF(centers));
+    END_WRAP
+}
+
+CvStatus* cv_MiniBatchKMeans_setCenters(MiniBatchKMeans self, Mat centers) {
+    BEGIN_WRAP
+    self.ptr->setCenters(CVDEREF(centers));
+    END_WRAP
+}
+
+int cv_MiniBatchKMeans_getK(MiniBatchKMeans self) {
+    return self.ptr->k();
+}
+
+int cv_MiniBatchKMeans_getBatchSize(MiniBatchKMeans self) {
+    return self.ptr->batchSize();
+}
+
+int cv_MiniBatchKMeans_getIterations(MiniBatchKMeans self) {
+    return self.ptr->iterations();
+}
@@ -0,0 +1,113 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_KMEANS_H
+#define DARTCV_LIBRARY_KMEANS_H
+
+#ifdef __cplusplus
+#include <opencv2/core.hpp>
+#include <vector>
+
+namespace cvd {
+// Mini-batch k-means (Sculley, 2010) with a parallel assignment step.
+//
+// Samples are the rows of a 1-channel Mat (N x d) or the pixels of a multi-channel Mat
+// (N = rows * cols, d = channels), of any depth, read in place without a float copy.
+// Centers are seeded by k-means++ on a random subsample, every iteration assigns a random
+// mini-batch to the nearest centers in parallel and moves each center towards its samples
+// with a per-center learning rate of 1 / (number of samples it has seen).
+//
+// With warmStart the centers of the previous fit are refined instead of seeded again, the
+// previous samples weigh as much as one mini-batch, so e.g. a video palette follows the frames
+// incrementally while the center order (and thus the labels) stays stable.
+class MiniBatchKMeans {
+  public:
+    MiniBatchKMeans(int k, int batchSize, cv::TermCriteria criteria, int seedSamples, uint64 seed);
+
+    // Returns the compactness (sum of squared distances to the nearest center) of all samples.
+    double fit(const cv::Mat& data, bool warmStart, cv::Mat& labels);
+    // Assigns all samples to the nearest centers, in parallel, and returns the compactness.
+    double predict(const cv::Mat& data, cv::Mat& labels) const;
+
+    const cv::Mat& centers() const { return centers_; }
+    // The centers weigh as much as one mini-batch in the next fit with warmStart.
+    void setCenters(const cv::Mat& centers);
+    int k() const { return k_; }
+    int batchSize() const { return batchSize_; }
+    int iterations() const { return iterations_; }
+
+  private:
+    struct Samples {
+        const uchar* data;
+        size_t n;
+        int d;
+        int depth;
+        void load(size_t i, float* out) const;
+    };
+
+    static Samples view(const cv::Mat& data, cv::Mat& holder);
+    void seed(const Samples& samples);
+    int nearest(const float* x, float& dist) const;
+
+    int k_;
+    int batchSize_;
+    cv::TermCriteria criteria_;
+    int seedSamples_;
+    cv::RNG rng_;
+    cv::Mat centers_;
+    std::vector<double> counts_;
+    int iterations_ = 0;
+};
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+CVD_TYPEDEF(cvd::MiniBatchKMeans, MiniBatchKMeans);
+#else
+CVD_TYPEDEF(void, MiniBatchKMeans);
+#endif
+
+// k clusters, batchSize samples per iteration, criteria.maxCount iterations at most (stops
+// earlier when no center moves more than criteria.epsilon), k-means++ seeding on seedSamples
+// random samples.
+CvStatus* cv_MiniBatchKMeans_create(
+    int k,
+    int batchSize,
+    TermCriteria criteria,
+    int seedSamples,
+    uint64_t seed,
+    MiniBatchKMeans* rval
+);
+void cv_MiniBatchKMeans_close(MiniBatchKMeansPtr self);
+
+CvStatus* cv_MiniBatchKMeans_fit(
+    MiniBatchKMeans self,
+    Mat data,
+    bool warmStart,
+    CVD_OUT Mat labels,
+    CVD_OUT Mat centers,
+    double* rval,
+    CvCallback_0 callback
+);
+CvStatus* cv_MiniBatchKMeans_predict(
+    MiniBatchKMeans self, Mat data, CVD_OUT Mat labels, double* rval, CvCallback_0 callback
+);
+
+CvStatus* cv_MiniBatchKMeans_getCenters(MiniBatchKMeans self, CVD_OUT Mat centers);
+// Sets the centers to start the next warm-started fit from, k x d.
+CvStatus* cv_MiniBatchKMeans_setCenters(MiniBatchKMeans self, Mat centers);
+int cv_MiniBatchKMeans_getK(MiniBatchKMeans self);
+int cv_MiniBatchKMeans_getBatchSize(MiniBatchKMeans self);
+int cv_MiniBatchKMeans_getIterations(MiniBatchKMeans self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_KMEANS_H
@@ -0,0 +1,337 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/core/mat_io.h"
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace cvd {
+
+namespace {
+
+constexpr char kMagic[8] = {'D', 'A', 'R', 'T', 'C', 'V', 'M', 'T'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kEndianTag = 0x01020304;
+constexpr uint64_t kAlign = 64;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t endianTag;
+    uint64_t count;
+    uint64_t fileSize;
+    uint8_t reserved[32];
+};
+
+struct MatHeader {
+    uint32_t type;
+    uint32_t dims;
+    uint32_t flags;
+    uint32_t reserved0;
+    uint64_t offset;
+    uint64_t size;
+    uint8_t reserved[32];
+};
+
+static_assert(sizeof(FileHeader) == kAlign, "FileHeader must be 64 bytes");
+static_assert(sizeof(MatHeader) == kAlign, "MatHeader must be 64 bytes");
+
+uint64_t alignUp(uint64_t n) {
+    return (n + kAlign - 1) & ~(kAlign - 1);
+}
+
+// Whether [offset, offset + size) lies in a file of fileSize bytes, without overflowing.
+bool inFile(uint64_t offset, uint64_t size, uint64_t fileSize) {
+    return offset <= fileSize && size <= fileSize - offset;
+}
+
+uint64_t shapeSize(int dims) {
+    return alignUp(2 * sizeof(int64_t) * dims);
+}
+
+struct Entry {
+    int type;
+    std::vector<int> sizes;
+    std::vector<size_t> steps;
+    uint64_t offset;
+    uint64_t size;
+};
+
+// Reads and validates the headers, the payloads are only checked to be in the file.
+std::vector<Entry> readIndex(std::ifstream& ifs, const std::string& filename) {
+    ifs.seekg(0, std::ios::end);
+    const std::streamoff end = ifs.tellg();
+    if (end < 0) CV_Error(cv::Error::StsError, "can not read " + filename);
+    const uint64_t fileSize = static_cast<uint64_t>(end);
+    ifs.seekg(0, std::ios::beg);
+
+    FileHeader fh{};
+    if (!ifs.read(reinterpret_cast<char*>(&fh), sizeof(fh)) ||
+        std::memcmp(fh.magic, kMagic, sizeof(kMagic)) != 0)
+        CV_Error(cv::Error::StsParseError, "not a Mat file: " + filename);
+    if (fh.version > kVersion)
+        CV_Error(cv::Error::StsParseError, "unsupported Mat file version: " + filename);
+    if (fh.endianTag != kEndianTag)
+        CV_Error(cv::Error::StsParseError, "Mat file written with another byte order: " + filename);
+    if (fh.fileSize > fileSize)
+        CV_Error(cv::Error::StsParseError, "truncated Mat file: " + filename);
+
+    std::vector<Entry> entries;
+    uint64_t pos = sizeof(FileHeader);
+    for (uint64_t i = 0; i < fh.count; i++) {
+        MatHeader mh{};
+        ifs.seekg(static_cast<std::streamoff>(pos));
+        if (!ifs.read(reinterpret_cast<char*>(&mh), sizeof(mh)) || mh.dims > CV_MAX_DIM ||
+            mh.flags != 0 || mh.type != static_cast<uint32_t>(CV_MAT_TYPE(mh.type)))
+            CV_Error(cv::Error::StsParseError, "corrupted Mat header: " + filename);
+        Entry e{static_cast<int>(mh.type), {}, {}, mh.offset, mh.size};
+        const int dims = static_cast<int>(mh.dims);
+        std::vector<int64_t> shape(2 * dims);
+        if (dims > 0 && !ifs.read(reinterpret_cast<char*>(shape.data()), shape.size() * 8))
+            CV_Error(cv::Error::StsParseError, "corrupted Mat header: " + filename);
+
+        // the payload must be continuous, stored steps are there for other readers
+        uint64_t expected = CV_ELEM_SIZE(e.type);
+        for (int d = dims - 1; d >= 0; d--) {
+            if (shape[d] < 0 || shape[d] > INT_MAX ||
+                shape[dims + d] != static_cast<int64_t>(expected))
+                CV_Error(cv::Error::StsParseError, "corrupted Mat shape: " + filename);
+            const uint64_t n = static_cast<uint64_t>(shape[d]);
+            if (n != 0 && expected > UINT64_MAX / n)
+                CV_Error(cv::Error::StsParseError, "corrupted Mat shape: " + filename);
+            expected *= n;
+        }
+        if (dims == 0) expected = 0;
+        // payloads are in the file and alignUp(e.offset + e.size) does not wrap around
+        if (e.size != expected || e.offset % kAlign != 0 || e.offset < pos + sizeof(mh) ||
+            !inFile(e.offset, e.size, fileSize) || e.offset + e.size > UINT64_MAX - kAlign)
+            CV_Error(cv::Error::StsParseError, "corrupted Mat payload: " + filename);
+        e.sizes.assign(shape.begin(), shape.begin() + dims);
+        e.steps.assign(shape.begin() + dims, shape.end());
+        pos = e.offset + alignUp(e.size);
+        entries.push_back(std::move(e));
+    }
+    return entries;
+}
+
+class MappedFile {
+  public:
+    explicit MappedFile(const std::string& filename) {
+#ifdef _WIN32
+        HANDLE file = CreateFileA(
+            filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr
+        );
+        if (file == INVALID_HANDLE_VALUE) CV_Error(cv::Error::StsError, "can not open " + filename);
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size)) {
+            CloseHandle(file);
+            CV_Error(cv::Error::StsError, "can not read " + filename);
+        }
+        size_ = static_cast<size_t>(size.QuadPart);
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+            data_ = static_cast<uchar*>(MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+        if (data_ == nullptr) CV_Error(cv::Error::StsError, "can not map " + filename);
+#else
+        const int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) CV_Error(cv::Error::StsError, "can not open " + filename);
+        struct stat st {};
+        if (fstat(fd, &st) != 0 || st.st_size < 0) {
+            close(fd);
+            CV_Error(cv::Error::StsError, "can not read " + filename);
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        void* p = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (p == MAP_FAILED) CV_Error(cv::Error::StsError, "can not map " + filename);
+        data_ = static_cast<uchar*>(p);
+#endif
+    }
+
+    ~MappedFile() {
+#ifdef _WIN32
+        UnmapViewOfFile(data_);
+#else
+        munmap(data_, size_);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    uchar* data() const { return data_; }
+    size_t size() const { return size_; }
+
+  private:
+    uchar* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// Owns nothing but a reference to the mapping, released with the last Mat sharing the UMatData.
+class MappedMatAllocator : public cv::MatAllocator {
+  public:
+    cv::UMatData* allocate(
+        int, const int*, int, void*, size_t*, cv::AccessFlag, cv::UMatUsageFlags
+    ) const override {
+        return nullptr;
+    }
+
+    bool allocate(cv::UMatData*, cv::AccessFlag, cv::UMatUsageFlags) const override {
+        return false;
+    }
+
+    void deallocate(cv::UMatData* u) const override {
+        if (u == nullptr) return;
+        CV_Assert(u->urefcount == 0 && u->refcount == 0);
+        delete static_cast<std::shared_ptr<MappedFile>*>(u->userdata);
+        delete u;
+    }
+};
+
+MappedMatAllocator* mappedMatAllocator() {
+    static MappedMatAllocator* allocator = new MappedMatAllocator();
+    return allocator;
+}
+
+}  // namespace
+
+void saveMats(const std::string& filename, const std::vector<cv::Mat>& mats) {
+    FileHeader fh{};
+    std::memcpy(fh.magic, kMagic, sizeof(kMagic));
+    fh.version = kVersion;
+    fh.endianTag = kEndianTag;
+    fh.count = mats.size();
+    fh.fileSize = sizeof(FileHeader);
+    for (const auto& m : mats) {
+        fh.fileSize += sizeof(MatHeader) + shapeSize(m.dims) + alignUp(m.total() * m.elemSize());
+    }
+
+    std::ofstream ofs(filename, std::ios::binary | std::ios::trunc);
+    if (!ofs) CV_Error(cv::Error::StsError, "can not open " + filename);
+    ofs.write(reinterpret_cast<const char*>(&fh), sizeof(fh));
+
+    static const char zeros[kAlign] = {};
+    uint64_t pos = sizeof(FileHeader);
+    for (const auto& mat : mats) {
+        const cv::Mat m = mat.isContinuous() ? mat : mat.clone();
+        MatHeader mh{};
+        mh.type = static_cast<uint32_t>(m.type());
+        mh.dims = static_cast<uint32_t>(m.dims);
+        mh.offset = pos + sizeof(MatHeader) + shapeSize(m.dims);
+        mh.size = m.total() * m.elemSize();
+        std::vector<int64_t> shape(2 * m.dims);
+        for (int d = 0; d < m.dims; d++) {
+            shape[d] = m.size[d];
+            shape[m.dims + d] = static_cast<int64_t>(m.step[d]);
+        }
+        ofs.write(reinterpret_cast<const char*>(&mh), sizeof(mh));
+        ofs.write(reinterpret_cast<const char*>(shape.data()), shape.size() * 8);
+        ofs.write(zeros, shapeSize(m.dims) - shape.size() * 8);
+        ofs.write(reinterpret_cast<const char*>(m.data), mh.size);
+        ofs.write(zeros, alignUp(mh.size) - mh.size);
+        pos = mh.offset + alignUp(mh.size);
+    }
+    if (!ofs.flush()) CV_Error(cv::Error::StsError, "can not write " + filename);
+}
+
+std::vector<cv::Mat> loadMats(const std::string& filename, bool mmap) {
+    std::ifstream ifs(filename, std::ios::binary);
+    if (!ifs) CV_Error(cv::Error::StsError, "can not open " + filename);
+    const std::vector<Entry> entries = readIndex(ifs, filename);
+
+    std::vector<cv::Mat> mats(entries.size());
+    std::shared_ptr<MappedFile> file;
+    for (size_t i = 0; i < entries.size(); i++) {
+        const Entry& e = entries[i];
+        if (e.sizes.empty()) continue;
+        if (!mmap || e.size == 0) {
+            mats[i].create(static_cast<int>(e.sizes.size()), e.sizes.data(), e.type);
+            ifs.seekg(static_cast<std::streamoff>(e.offset));
+            auto* dst = reinterpret_cast<char*>(mats[i].data);
+            if (!ifs.read(dst, static_cast<std::streamsize>(e.size)))
+                CV_Error(cv::Error::StsError, "can not read " + filename);
+            continue;
+        }
+        if (file == nullptr) {
+            ifs.close();
+            file = std::make_shared<MappedFile>(filename);
+        }
+        if (!inFile(e.offset, e.size, file->size()))
+            CV_Error(cv::Error::StsError, "file changed while loading: " + filename);
+        cv::Mat m(
+            static_cast<int>(e.sizes.size()), e.sizes.data(), e.type, file->data() + e.offset,
+            e.steps.data()
+        );
+        auto* u = new cv::UMatData(mappedMatAllocator());
+        u->data = u->origdata = m.data;
+        u->size = e.size;
+        u->refcount = 1;
+        u->userdata = new std::shared_ptr<MappedFile>(file);
+        m.u = u;
+        mats[i] = m;
+    }
+    return mats;
+}
+
+}  // namespace cvd
+
+CvStatus* cv_saveMat(const char* filename, Mat mat, CvCallback_0 callback) {
+    BEGIN_WRAP
+    cvd::saveMats(filename, {CVDEREF(mat)});
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_saveMats(const char* filename, VecMat mats, CvCallback_0 callback) {
+    BEGIN_WRAP
+    cvd::saveMats(filename, CVDEREF(mats));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_loadMat(const char* filename, bool mmap, Mat rval, CvCallback_0 callback) {
+    BEGIN_WRAP
+    auto mats = cvd::loadMats(filename, mmap);
+    if (mats.empty()) CV_Error(cv::Error::StsObjectNotFound, std::string("no Mat in ") + filename);
+    CVDEREF(rval) = mats[0];
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_loadMats(const char* filename, bool mmap, VecMat* rval, CvCallback_0 callback) {
+    BEGIN_WRAP
+    CVDEREF_P(rval) = cvd::loadMats(filename, mmap);
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
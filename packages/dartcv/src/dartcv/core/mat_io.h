@@ -0,0 +1,49 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_MAT_IO_H
+#define DARTCV_LIBRARY_MAT_IO_H
+
+#ifdef __cplusplus
+#include <opencv2/core.hpp>
+#include <string>
+#include <vector>
+
+namespace cvd {
+// Raw binary container for Mats, version 1, little-endian:
+//
+//   file header (64 bytes): magic "DARTCVMT", u32 version, u32 endian tag (0x01020304),
+//                           u64 count, u64 file size, reserved
+//   per Mat, in order:
+//     Mat header (64 bytes): u32 type, u32 dims, u32 flags (0: raw), u32 reserved,
+//                            u64 payload offset, u64 payload size, reserved
+//     i64 sizes[dims], i64 steps[dims], zero padded to 64 bytes
+//     payload, continuous, zero padded to 64 bytes
+//
+// Every payload starts at a 64-byte aligned file offset, so a mapped file can be used as is
+// without parsing or copying the data.
+void saveMats(const std::string& filename, const std::vector<cv::Mat>& mats);
+// With mmap the Mats point into a private (copy-on-write) mapping of the file, which is
+// unmapped when the last Mat referencing it is released; writes never reach the file.
+std::vector<cv::Mat> loadMats(const std::string& filename, bool mmap);
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+
+CvStatus* cv_saveMat(const char* filename, Mat mat, CvCallback_0 callback);
+CvStatus* cv_saveMats(const char* filename, VecMat mats, CvCallback_0 callback);
+// Loads the first Mat of the file.
+CvStatus* cv_loadMat(const char* filename, bool mmap, CVD_OUT Mat rval, CvCallback_0 callback);
+CvStatus* cv_loadMats(
+    const char* filename, bool mmap, CVD_OUT VecMat* rval, CvCallback_0 callback
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_MAT_IO_H
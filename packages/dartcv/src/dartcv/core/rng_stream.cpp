@@ -0,0 +1,202 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/core/rng_stream.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace cvd {
+
+namespace {
+
+constexpr int kChunk = 4096;
+
+struct Block {
+    uint32_t v[4];
+};
+
+// Philox4x32 with 10 rounds, key = seed, counter = (position, stream)
+inline Block philox(uint64 seed, uint64 stream, uint64 position) {
+    uint32_t c0 = static_cast<uint32_t>(position), c1 = static_cast<uint32_t>(position >> 32);
+    uint32_t c2 = static_cast<uint32_t>(stream), c3 = static_cast<uint32_t>(stream >> 32);
+    uint32_t k0 = static_cast<uint32_t>(seed), k1 = static_cast<uint32_t>(seed >> 32);
+    for (int i = 0; i < 10; i++) {
+        const uint64_t p0 = uint64_t(0xD2511F53u) * c0;
+        const uint64_t p1 = uint64_t(0xCD9E8D57u) * c2;
+        const uint32_t n0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+        const uint32_t n2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+        c0 = n0;
+        c1 = static_cast<uint32_t>(p1);
+        c2 = n2;
+        c3 = static_cast<uint32_t>(p0);
+        k0 += 0x9E3779B9u;
+        k1 += 0xBB67AE85u;
+    }
+    return {{c0, c1, c2, c3}};
+}
+
+// [0, 1) with 53 random bits
+inline double unit(uint32_t hi, uint32_t lo) {
+    return static_cast<double>((uint64_t(hi) << 21) | (lo >> 11)) * (1.0 / 9007199254740992.0);
+}
+
+template <typename T>
+inline T castTo(double v) {
+    return cv::saturate_cast<T>(v);
+}
+
+template <>
+inline cv::hfloat castTo<cv::hfloat>(double v) {
+    return cv::hfloat(static_cast<float>(v));
+}
+
+template <typename T>
+void fillImpl(
+    cv::Mat& view,
+    int distType,
+    const cv::Scalar& a,
+    const cv::Scalar& b,
+    uint64 seed,
+    uint64 stream,
+    uint64 base
+) {
+    const int cn = view.channels();
+    const int64 rowLen = static_cast<int64>(view.cols) * cn;
+    const int64 total = rowLen * view.rows;
+    const int chunks = static_cast<int>((total + kChunk - 1) / kChunk);
+    cv::parallel_for_(cv::Range(0, chunks), [&](const cv::Range& range) {
+        const int64 end = std::min(total, static_cast<int64>(range.end) * kChunk);
+        for (int64 s = static_cast<int64>(range.start) * kChunk; s < end;) {
+            T* p = view.ptr<T>(static_cast<int>(s / rowLen));
+            const int64 jend = std::min(rowLen, s % rowLen + (end - s));
+            for (int64 j = s % rowLen; j < jend; j++, s++) {
+                const Block r = philox(seed, stream, base + static_cast<uint64>(s));
+                const int c = static_cast<int>(j % cn);
+                double v;
+                if (distType == cv::RNG::UNIFORM) {
+                    v = a[c] + unit(r.v[0], r.v[1]) * (b[c] - a[c]);
+                    if (std::numeric_limits<T>::is_integer) v = std::floor(v);
+                } else {
+                    // Box-Muller, u1 in (0, 1]
+                    const double u1 = 1.0 - unit(r.v[0], r.v[1]);
+                    const double u2 = unit(r.v[2], r.v[3]);
+                    v = a[c] + b[c] * std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * CV_PI * u2);
+                }
+                p[j] = castTo<T>(v);
+            }
+        }
+    });
+}
+
+}  // namespace
+
+RNGStream::RNGStream(uint64 seed, uint64 stream) : seed_(seed), stream_(stream) {}
+
+void RNGStream::fill(cv::Mat& mat, int distType, const cv::Scalar& a, const cv::Scalar& b) {
+    CV_Assert(distType == cv::RNG::UNIFORM || distType == cv::RNG::NORMAL);
+    CV_Assert(mat.channels() <= 4 && (mat.dims <= 2 || mat.isContinuous()));
+    if (mat.empty()) return;
+    cv::Mat view = mat.dims <= 2 ? mat : mat.reshape(0, mat.size[0]);
+    const uint64 base = advance(static_cast<uint64>(mat.total() * mat.channels()));
+    switch (mat.depth()) {
+        case CV_8U: fillImpl<uchar>(view, distType, a, b, seed_, stream_, base); break;
+        case CV_8S: fillImpl<schar>(view, distType, a, b, seed_, stream_, base); break;
+        case CV_16U: fillImpl<ushort>(view, distType, a, b, seed_, stream_, base); break;
+        case CV_16S: fillImpl<short>(view, distType, a, b, seed_, stream_, base); break;
+        case CV_32S: fillImpl<int>(view, distType, a, b, seed_, stream_, base); break;
+        case CV_32F: fillImpl<float>(view, distType, a, b, seed_, stream_, base); break;
+        case CV_64F: fillImpl<double>(view, distType, a, b, seed_, stream_, base); break;
+        case CV_16F: fillImpl<cv::hfloat>(view, distType, a, b, seed_, stream_, base); break;
+        default: CV_Error(cv::Error::StsUnsupportedFormat, "unsupported depth");
+    }
+}
+
+void RNGStream::shuffle(cv::Mat& mat) {
+    CV_Assert(mat.dims <= 2 || mat.isContinuous());
+    const size_t n = mat.total();
+    const uint64 base = advance(n);
+    if (n < 2) return;
+
+    // a uniform permutation is the order of n random keys, ties broken by the index
+    std::vector<std::pair<uint64_t, size_t>> keys(n);
+    const int chunks = static_cast<int>((n + kChunk - 1) / kChunk);
+    cv::parallel_for_(cv::Range(0, chunks), [&](const cv::Range& range) {
+        const size_t end = std::min(n, static_cast<size_t>(range.end) * kChunk);
+        for (size_t i = static_cast<size_t>(range.start) * kChunk; i < end; i++) {
+            const Block r = philox(seed_, stream_, base + i);
+            keys[i] = {(uint64_t(r.v[0]) << 32) | r.v[1], i};
+        }
+    });
+    std::sort(keys.begin(), keys.end());
+
+    const cv::Mat src = mat.clone();
+    const size_t esz = mat.elemSize();
+    const bool continuous = mat.isContinuous();
+    const size_t cols = static_cast<size_t>(mat.dims <= 2 ? mat.cols : 1);
+    cv::parallel_for_(cv::Range(0, chunks), [&](const cv::Range& range) {
+        const size_t end = std::min(n, static_cast<size_t>(range.end) * kChunk);
+        for (size_t i = static_cast<size_t>(range.start) * kChunk; i < end; i++) {
+            uchar* dst = continuous ? mat.data + i * esz
+                                    : mat.ptr(static_cast<int>(i / cols)) + (i % cols) * esz;
+            std::memcpy(dst, src.data + keys[i].second * esz, esz);
+        }
+    });
+}
+
+}  // namespace cvd
+
+CvStatus* cv_RNGStream_create(uint64_t seed, uint64_t stream, RNGStream* rval) {
+    BEGIN_WRAP
+    *rval = {new cvd::RNGStream(seed, stream)};
+    END_WRAP
+}
+
+void cv_RNGStream_close(RNGStreamPtr self) {
+    CVD_FREE(self);
+}
+
+CvStatus* cv_RNGStream_fill(
+    RNGStream self, Mat mat, int distType, Scalar a, Scalar b, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    self.ptr->fill(
+        CVDEREF(mat),
+        distType,
+        cv::Scalar(a.val1, a.val2, a.val3, a.val4),
+        cv::Scalar(b.val1, b.val2, b.val3, b.val4)
+    );
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_RNGStream_shuffle(RNGStream self, Mat mat, CvCallback_0 callback) {
+    BEGIN_WRAP
+    self.ptr->shuffle(CVDEREF(mat));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+uint64_t cv_RNGStream_getSeed(RNGStream self) {
+    return self.ptr->seed();
+}
+
+uint64_t cv_RNGStream_getStream(RNGStream self) {
+    return self.ptr->stream();
+}
+
+uint64_t cv_RNGStream_getPosition(RNGStream self) {
+    return self.ptr->position();
+}
+
+void cv_RNGStream_setPosition(RNGStream self, uint64_t position) {
+    self.ptr->setPosition(position);
+}
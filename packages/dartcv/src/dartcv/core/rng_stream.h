@@ -0,0 +1,73 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_RNG_STREAM_H
+#define DARTCV_LIBRARY_RNG_STREAM_H
+
+#ifdef __cplusplus
+#include <opencv2/core.hpp>
+#include <atomic>
+
+namespace cvd {
+// A counter-based random stream (Philox4x32-10, Salmon et al. 2011).
+//
+// The n-th number of a stream is a pure function of (seed, stream, n), so Mats are filled in
+// parallel with the same result for any number of threads, and streams with different ids are
+// independent, e.g. one per sample of an augmentation batch. Every fill or shuffle consumes
+// one position per value and advances the stream by as many.
+class RNGStream {
+  public:
+    RNGStream(uint64 seed, uint64 stream);
+
+    // distType: cv::RNG::UNIFORM in [a, b) or cv::RNG::NORMAL with mean a and stddev b, per
+    // channel, any depth, values are saturated (integers of UNIFORM are floored).
+    void fill(cv::Mat& mat, int distType, const cv::Scalar& a, const cv::Scalar& b);
+    // Permutes the elements of mat uniformly, like cv::randShuffle.
+    void shuffle(cv::Mat& mat);
+
+    uint64 seed() const { return seed_; }
+    uint64 stream() const { return stream_; }
+    uint64 position() const { return position_; }
+    void setPosition(uint64 position) { position_ = position; }
+
+  private:
+    // Reserves n positions, returns the first.
+    uint64 advance(uint64 n) { return position_.fetch_add(n); }
+
+    uint64 seed_;
+    uint64 stream_;
+    std::atomic<uint64> position_{0};
+};
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+CVD_TYPEDEF(cvd::RNGStream, RNGStream);
+#else
+CVD_TYPEDEF(void, RNGStream);
+#endif
+
+CvStatus* cv_RNGStream_create(uint64_t seed, uint64_t stream, RNGStream* rval);
+void cv_RNGStream_close(RNGStreamPtr self);
+
+CvStatus* cv_RNGStream_fill(
+    RNGStream self, Mat mat, int distType, Scalar a, Scalar b, CvCallback_0 callback
+);
+CvStatus* cv_RNGStream_shuffle(RNGStream self, Mat mat, CvCallback_0 callback);
+
+uint64_t cv_RNGStream_getSeed(RNGStream self);
+uint64_t cv_RNGStream_getStream(RNGStream self);
+uint64_t cv_RNGStream_getPosition(RNGStream self);
+void cv_RNGStream_setPosition(RNGStream self, uint64_t position);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_RNG_STREAM_H
@@ -0,0 +1,287 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/core/sort.h"
+#include <opencv2/core/hal/intrin.hpp>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace cvd {
+
+namespace {
+
+// elements per parallel stripe
+constexpr double kGrain = 1 << 15;
+// elements skipped at once by topK when none of them beats the current k-th
+constexpr int kBlock = 64;
+
+// The rows or the columns of a 2-D Mat.
+struct Lines {
+    uchar* data;
+    size_t lineStep, elemStep;
+    int count, len;
+
+    Lines(const cv::Mat& m, bool byRow) :
+        data(m.data),
+        lineStep(byRow ? m.step[0] : m.elemSize()),
+        elemStep(byRow ? m.elemSize() : m.step[0]),
+        count(byRow ? m.rows : m.cols),
+        len(byRow ? m.cols : m.rows) {}
+
+    template <typename T>
+    void read(int line, T* buf) const {
+        const uchar* p = data + lineStep * line;
+        for (int i = 0; i < len; i++) buf[i] = *reinterpret_cast<const T*>(p + elemStep * i);
+    }
+    template <typename T>
+    void write(int line, const T* buf) const {
+        uchar* p = data + lineStep * line;
+        for (int i = 0; i < len; i++) *reinterpret_cast<T*>(p + elemStep * i) = buf[i];
+    }
+};
+
+void checkInput(const cv::Mat& src) {
+    CV_Assert(src.dims <= 2 && src.channels() == 1 && src.depth() != CV_16F);
+}
+
+double stripes(int count, int len) {
+    return std::max(1.0, std::min<double>(count, static_cast<double>(count) * len / kGrain));
+}
+
+template <typename T>
+void sortImpl(const cv::Mat& src, cv::Mat& dst, bool byRow, bool desc) {
+    const Lines in(src, byRow), out(dst, byRow);
+    cv::parallel_for_(
+        cv::Range(0, in.count),
+        [&](const cv::Range& range) {
+            std::vector<T> buf(in.len);
+            for (int l = range.start; l < range.end; l++) {
+                in.read(l, buf.data());
+                if (desc) {
+                    std::sort(buf.begin(), buf.end(), std::greater<T>());
+                } else {
+                    std::sort(buf.begin(), buf.end());
+                }
+                out.write(l, buf.data());
+            }
+        },
+        stripes(in.count, in.len)
+    );
+}
+
+template <typename T>
+void sortIdxImpl(const cv::Mat& src, cv::Mat& dst, bool byRow, bool desc) {
+    const Lines in(src, byRow), out(dst, byRow);
+    cv::parallel_for_(
+        cv::Range(0, in.count),
+        [&](const cv::Range& range) {
+            std::vector<T> buf(in.len);
+            std::vector<int> idx(in.len);
+            for (int l = range.start; l < range.end; l++) {
+                in.read(l, buf.data());
+                std::iota(idx.begin(), idx.end(), 0);
+                if (desc) {
+                    std::stable_sort(idx.begin(), idx.end(), [&](int a, int b) {
+                        return buf[a] > buf[b];
+                    });
+                } else {
+                    std::stable_sort(idx.begin(), idx.end(), [&](int a, int b) {
+                        return buf[a] < buf[b];
+                    });
+                }
+                out.write(l, idx.data());
+            }
+        },
+        stripes(in.count, in.len)
+    );
+}
+
+// Whether any of p[0, n) is strictly better than thr, written to be vectorized by the compiler.
+template <typename T>
+inline bool anyBeats(const T* p, int n, T thr, bool desc) {
+    bool r = false;
+    if (desc) {
+        for (int i = 0; i < n; i++) r |= p[i] > thr;
+    } else {
+        for (int i = 0; i < n; i++) r |= p[i] < thr;
+    }
+    return r;
+}
+
+inline bool anyBeats(const float* p, int n, float thr, bool desc) {
+    int i = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    const int lanes = cv::VTraits<cv::v_float32>::vlanes();
+    const cv::v_float32 t = cv::vx_setall_f32(thr);
+    for (; i + lanes <= n; i += lanes) {
+        const cv::v_float32 v = cv::vx_load(p + i);
+        if (desc) {
+            if (cv::v_check_any(cv::v_gt(v, t))) return true;
+        } else {
+            if (cv::v_check_any(cv::v_lt(v, t))) return true;
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        if (desc ? p[i] > thr : p[i] < thr) return true;
+    }
+    return false;
+}
+
+// The k best (value, index) of p[0, len) into heap, best first.
+template <typename T>
+void select(const T* p, int len, int k, bool desc, std::vector<std::pair<T, int>>& heap) {
+    // "a before b", the heap top is the worst kept element
+    const auto before = [desc](const std::pair<T, int>& a, const std::pair<T, int>& b) {
+        if (a.first != b.first) return desc ? a.first > b.first : a.first < b.first;
+        return a.second < b.second;
+    };
+    heap.resize(k);
+    for (int i = 0; i < k; i++) heap[i] = {p[i], i};
+    if (static_cast<int64>(k) * 4 >= len) {
+        // most of the line is kept anyway
+        heap.resize(len);
+        for (int i = k; i < len; i++) heap[i] = {p[i], i};
+        std::partial_sort(heap.begin(), heap.begin() + k, heap.end(), before);
+        heap.resize(k);
+        return;
+    }
+    std::make_heap(heap.begin(), heap.end(), before);
+    // the elements scanned later have higher indices, only strictly better values replace the top
+    for (int j = k; j < len;) {
+        const int end = std::min(len, j + kBlock);
+        if (!anyBeats(p + j, end - j, heap.front().first, desc)) {
+            j = end;
+            continue;
+        }
+        for (; j < end; j++) {
+            const T thr = heap.front().first;
+            if (desc ? p[j] > thr : p[j] < thr) {
+                std::pop_heap(heap.begin(), heap.end(), before);
+                heap.back() = {p[j], j};
+                std::push_heap(heap.begin(), heap.end(), before);
+            }
+        }
+    }
+    std::sort_heap(heap.begin(), heap.end(), before);
+}
+
+template <typename T>
+void topKImpl(
+    const cv::Mat& src, int k, cv::Mat& values, cv::Mat& indices, bool byRow, bool desc
+) {
+    const Lines in(src, byRow);
+    const Lines vOut(values, byRow), iOut(indices, byRow);
+    cv::parallel_for_(
+        cv::Range(0, in.count),
+        [&](const cv::Range& range) {
+            std::vector<T> buf(byRow ? 0 : in.len), v(k);
+            std::vector<int> idx(k);
+            std::vector<std::pair<T, int>> heap;
+            for (int l = range.start; l < range.end; l++) {
+                const T* p = reinterpret_cast<const T*>(in.data + in.lineStep * l);
+                if (!byRow) {
+                    in.read(l, buf.data());
+                    p = buf.data();
+                }
+                select(p, in.len, k, desc, heap);
+                for (int i = 0; i < k; i++) {
+                    v[i] = heap[i].first;
+                    idx[i] = heap[i].second;
+                }
+                vOut.write(l, v.data());
+                iOut.write(l, idx.data());
+            }
+        },
+        stripes(in.count, in.len)
+    );
+}
+
+template <template <typename> class F, typename... Args>
+void dispatch(int depth, Args&&... args) {
+    switch (depth) {
+        case CV_8U: F<uchar>()(std::forward<Args>(args)...); break;
+        case CV_8S: F<schar>()(std::forward<Args>(args)...); break;
+        case CV_16U: F<ushort>()(std::forward<Args>(args)...); break;
+        case CV_16S: F<short>()(std::forward<Args>(args)...); break;
+        case CV_32S: F<int>()(std::forward<Args>(args)...); break;
+        case CV_32F: F<float>()(std::forward<Args>(args)...); break;
+        case CV_64F: F<double>()(std::forward<Args>(args)...); break;
+        default: CV_Error(cv::Error::StsUnsupportedFormat, "unsupported depth");
+    }
+}
+
+template <typename T>
+struct SortOp {
+    void operator()(const cv::Mat& src, cv::Mat& dst, bool byRow, bool desc) {
+        sortImpl<T>(src, dst, byRow, desc);
+    }
+};
+
+template <typename T>
+struct SortIdxOp {
+    void operator()(const cv::Mat& src, cv::Mat& dst, bool byRow, bool desc) {
+        sortIdxImpl<T>(src, dst, byRow, desc);
+    }
+};
+
+template <typename T>
+struct TopKOp {
+    void operator()(const cv::Mat& src, int k, cv::Mat& v, cv::Mat& i, bool byRow, bool desc) {
+        topKImpl<T>(src, k, v, i, byRow, desc);
+    }
+};
+
+}  // namespace
+
+void sort(const cv::Mat& src, cv::Mat& dst, int flags) {
+    checkInput(src);
+    const bool byRow = (flags & cv::SORT_EVERY_COLUMN) == 0;
+    const bool desc = (flags & cv::SORT_DESCENDING) != 0;
+    // every line is read out before it is written, so dst may be src
+    dst.create(src.size(), src.type());
+    if (src.empty()) return;
+    dispatch<SortOp>(src.depth(), src, dst, byRow, desc);
+}
+
+void sortIdx(const cv::Mat& src, cv::Mat& dst, int flags) {
+    checkInput(src);
+    const bool byRow = (flags & cv::SORT_EVERY_COLUMN) == 0;
+    const bool desc = (flags & cv::SORT_DESCENDING) != 0;
+    // keeps the data of src alive when dst is src and create reallocates it
+    const cv::Mat in = src;
+    dst.create(in.size(), CV_32S);
+    if (in.empty()) return;
+    dispatch<SortIdxOp>(in.depth(), in, dst, byRow, desc);
+}
+
+void topK(const cv::Mat& src, int k, cv::Mat& values, cv::Mat& indices, int flags) {
+    checkInput(src);
+    const bool byRow = (flags & cv::SORT_EVERY_COLUMN) == 0;
+    const bool desc = (flags & cv::SORT_DESCENDING) != 0;
+    const int count = byRow ? src.rows : src.cols, len = byRow ? src.cols : src.rows;
+    CV_Assert(k > 0 && k <= len);
+    // the outputs are reused unless they share the buffer of src
+    cv::Mat v = values.u != nullptr && values.u == src.u ? cv::Mat() : values;
+    cv::Mat idx = indices.u != nullptr && indices.u == src.u ? cv::Mat() : indices;
+    v.create(byRow ? count : k, byRow ? k : count, src.type());
+    idx.create(v.size(), CV_32S);
+    dispatch<TopKOp>(src.depth(), src, k, v, idx, byRow, desc);
+    values = v;
+    indices = idx;
+}
+
+}  // namespace cvd
+
+CvStatus* cv_topK(Mat src, int k, Mat values, Mat indices, int flags, CvCallback_0 callback) {
+    BEGIN_WRAP
+    cvd::topK(CVDEREF(src), k, CVDEREF(values), CVDEREF(indices), flags);
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
@@ -0,0 +1,36 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_SORT_H
+#define DARTCV_LIBRARY_SORT_H
+
+#ifdef __cplusplus
+#include <opencv2/core.hpp>
+
+namespace cvd {
+// cv::sort and cv::sortIdx with the rows (SORT_EVERY_ROW) or columns (SORT_EVERY_COLUMN) sorted
+// in parallel, for single channel 2-D Mats of any depth but CV_16F. sortIdx is stable, equal
+// elements keep their order in ascending and descending sorts.
+void sort(const cv::Mat& src, cv::Mat& dst, int flags);
+void sortIdx(const cv::Mat& src, cv::Mat& dst, int flags);
+// Selects the k largest (SORT_DESCENDING) or smallest (SORT_ASCENDING) elements of every row
+// or column, sorted, ties going to the lower index, without sorting the whole lines.
+// values has the type of src and indices is CV_32S, both rows x k for SORT_EVERY_ROW and
+// k x cols for SORT_EVERY_COLUMN. NaNs are not supported, like cv::sort.
+void topK(const cv::Mat& src, int k, cv::Mat& values, cv::Mat& indices, int flags);
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+
+CvStatus* cv_topK(
+    Mat src, int k, CVD_OUT Mat values, CVD_OUT Mat indices, int flags, CvCallback_0 callback
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_SORT_H
@@ -69,9 +69,50 @@ VecF64* std_VecF64_clone(VecF64* self) {
     return new VecF64{new std::vector<double_t>(CVDEREF_P(self))};
 }
 
-CVD_STD_VEC_FUNC_IMPL(VecF16, uint16_t);
+// elements are stored as cv::hfloat but exchanged as uint16_t bits through the C API, a struct
+// wrapping __fp16 is not passed like an integer on every ABI
+CVD_STD_VEC_FUNC_IMPL_COMMON(VecF16);
+VecF16* std_VecF16_new(size_t length) {
+    return new VecF16{new std::vector<cv::hfloat>(length)};
+}
+VecF16* std_VecF16_new_1(size_t length, uint16_t val) {
+    return new VecF16{new std::vector<cv::hfloat>(length, cv::hfloat::fromBits(val))};
+}
+VecF16* std_VecF16_new_2(size_t length, uint16_t* val_ptr) {
+    auto* p = reinterpret_cast<cv::hfloat*>(val_ptr);
+    return new VecF16{new std::vector<cv::hfloat>(p, p + length)};
+}
+void std_VecF16_push_back(VecF16* self, uint16_t val) {
+    self->ptr->push_back(cv::hfloat::fromBits(val));
+}
+uint16_t std_VecF16_get(VecF16* self, size_t index) {
+    return self->ptr->at(index).bits();
+}
+void std_VecF16_set(VecF16* self, size_t index, uint16_t val) {
+    self->ptr->at(index) = cv::hfloat::fromBits(val);
+}
+uint16_t* std_VecF16_data(VecF16* self) {
+    return reinterpret_cast<uint16_t*>(self->ptr->data());
+}
 VecF16* std_VecF16_clone(VecF16* self) {
-    return new VecF16{new std::vector<uint16_t>(CVDEREF_P(self))};
+    return new VecF16{new std::vector<cv::hfloat>(CVDEREF_P(self))};
+}
+// Mat::convertTo dispatches to the SIMD (F16C/NEON) conversion of the running CPU
+VecF16* std_VecF16_new_f32(size_t length, float_t* val_ptr) {
+    auto* rval = new VecF16{new std::vector<cv::hfloat>(length)};
+    if (length > 0) {
+        const cv::Mat src(1, static_cast<int>(length), CV_32FC1, val_ptr);
+        cv::Mat dst(1, static_cast<int>(length), CV_16FC1, rval->ptr->data());
+        src.convertTo(dst, CV_16F);
+    }
+    return rval;
+}
+void std_VecF16_to_f32(VecF16* self, float_t* dst) {
+    const size_t length = self->ptr->size();
+    if (length == 0) return;
+    const cv::Mat src(1, static_cast<int>(length), CV_16FC1, self->ptr->data());
+    cv::Mat _dst(1, static_cast<int>(length), CV_32FC1, dst);
+    src.convertTo(_dst, CV_32F);
 }
 
 CVD_STD_VEC_FUNC_IMPL_COMMON(VecMat);
@@ -103,6 +103,9 @@ CVD_STD_VEC_FUNC_DEF(VecF64, double_t);
 VecF64* std_VecF64_clone(VecF64* self);
 CVD_STD_VEC_FUNC_DEF(VecF16, uint16_t);
 VecF16* std_VecF16_clone(VecF16* self);
+// vectorized float32 <-> float16 conversions
+VecF16* std_VecF16_new_f32(size_t length, float_t* val_ptr);
+void std_VecF16_to_f32(VecF16* self, float_t* dst);
 
 // CVD_STD_VEC_FUNC_DEF(VecVecChar, VecChar);
 VecVecChar* std_VecVecChar_new(size_t length);
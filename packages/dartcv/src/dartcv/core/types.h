@@ -486,7 +486,8 @@ CVD_TYPEDEF_STD_VEC(int64_t, VecI64);
 CVD_TYPEDEF_STD_VEC(uint64_t, VecU64);
 CVD_TYPEDEF_STD_VEC(float_t, VecF32);
 CVD_TYPEDEF_STD_VEC(double_t, VecF64);
-CVD_TYPEDEF_STD_VEC(uint16_t, VecF16); // TODO: change to native float16
+// stored as cv::hfloat, elements are passed through the C API as their IEEE 754 binary16 bits
+CVD_TYPEDEF_STD_VEC(cv::hfloat, VecF16);
 
 // std::vector
 #ifdef __cplusplus
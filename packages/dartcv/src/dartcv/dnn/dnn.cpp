@@ -43,7 +43,16 @@ CvStatus* cv_dnn_blobFromImage(
     BEGIN_WRAP
     cv::Size sz(size.width, size.height);
     cv::Scalar cm(mean.val1, mean.val2, mean.val3, mean.val4);
-    cv::dnn::blobFromImage(CVDEREF(image), CVDEREF(blob), scalefactor, sz, cm, swapRB, crop, ddepth);
+    if (ddepth == CV_16F) {
+        // blobFromImage only produces CV_32F/CV_8U, convert with the SIMD Mat::convertTo
+        cv::Mat blob32f;
+        cv::dnn::blobFromImage(CVDEREF(image), blob32f, scalefactor, sz, cm, swapRB, crop, CV_32F);
+        blob32f.convertTo(CVDEREF(blob), CV_16F);
+    } else {
+        cv::dnn::blobFromImage(
+            CVDEREF(image), CVDEREF(blob), scalefactor, sz, cm, swapRB, crop, ddepth
+        );
+    }
     if (callback != nullptr) {
         callback();
     }
@@ -64,7 +73,17 @@ CvStatus* cv_dnn_blobFromImages(
     BEGIN_WRAP
     cv::Size sz(size.width, size.height);
     cv::Scalar cm = cv::Scalar(mean.val1, mean.val2, mean.val3, mean.val4);
-    cv::dnn::blobFromImages(CVDEREF(images), CVDEREF(blob), scalefactor, sz, cm, swapRB, crop, ddepth);
+    if (ddepth == CV_16F) {
+        cv::Mat blob32f;
+        cv::dnn::blobFromImages(
+            CVDEREF(images), blob32f, scalefactor, sz, cm, swapRB, crop, CV_32F
+        );
+        blob32f.convertTo(CVDEREF(blob), CV_16F);
+    } else {
+        cv::dnn::blobFromImages(
+            CVDEREF(images), CVDEREF(blob), scalefactor, sz, cm, swapRB, crop, ddepth
+        );
+    }
     if (callback != nullptr) {
         callback();
     }
@@ -31,6 +31,7 @@ CvStatus* cv_dnn_AsyncArray_get(AsyncArray async_out, Mat out);
 CvStatus* cv_dnn_Net_forwardAsync(Net net, const char* outputName, AsyncArray* rval);
 void cv_dnn_AsyncArray_close(AsyncArrayPtr a);
 
+// ddepth: CV_32F, CV_8U or CV_16F (computed in CV_32F, then converted)
 CvStatus* cv_dnn_blobFromImage(
     Mat image,
     CVD_OUT Mat blob,
@@ -9,6 +9,7 @@
 #include "dartcv/features2d/features2d.h"
 #include <opencv2/core/cvstd_wrapper.hpp>
 #include <opencv2/features2d.hpp>
+#include <opencv2/imgproc.hpp>
 #include "dartcv/core/vec.hpp"
 #include "dartcv/features2d/utils.hpp"
 
@@ -864,6 +865,81 @@ CvStatus* cv_ORB_detectAndCompute(
     END_WRAP
 }
 
+CvStatus* cv_ORB_detectAndComputePyramid(
+    ORB self,
+    VecMat pyramid,
+    double scaleFactor,
+    Mat mask,
+    Mat desc,
+    VecKeyPoint* out_keypoints,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    auto& orb = CVDEREF(self);
+    const auto& levels = CVDEREF(pyramid);
+    const auto& _mask = CVDEREF(mask);
+    CV_Assert(!levels.empty() && scaleFactor > 1);
+    const int nlevels = static_cast<int>(levels.size());
+
+    // same per-level feature budget as cv::ORB
+    const int nfeatures = orb->getMaxFeatures();
+    const double factor = 1.0 / scaleFactor;
+    double ndesiredFeaturesPerScale =
+        nfeatures * (1 - factor) / (1 - std::pow(factor, static_cast<double>(nlevels)));
+    std::vector<int> nfeaturesPerLevel(nlevels);
+    int sumFeatures = 0;
+    for (int level = 0; level < nlevels - 1; level++) {
+        nfeaturesPerLevel[level] = cvRound(ndesiredFeaturesPerScale);
+        sumFeatures += nfeaturesPerLevel[level];
+        ndesiredFeaturesPerScale *= factor;
+    }
+    nfeaturesPerLevel[nlevels - 1] = std::max(nfeatures - sumFeatures, 0);
+
+    // every level is detected as a single-level ORB, the settings are restored afterwards
+    // even if detectAndCompute throws
+    struct Restore {
+        cv::Ptr<cv::ORB>& orb;
+        int nfeatures, nlevels, firstLevel;
+        ~Restore() {
+            orb->setMaxFeatures(nfeatures);
+            orb->setNLevels(nlevels);
+            orb->setFirstLevel(firstLevel);
+        }
+    } restore{orb, nfeatures, orb->getNLevels(), orb->getFirstLevel()};
+    orb->setNLevels(1);
+    orb->setFirstLevel(0);
+
+    auto& keypoints = CVDEREF_P(out_keypoints);
+    keypoints.clear();
+    std::vector<cv::Mat> descs;
+    for (int level = 0; level < nlevels; level++) {
+        if (nfeaturesPerLevel[level] <= 0) continue;
+        orb->setMaxFeatures(nfeaturesPerLevel[level]);
+        cv::Mat levelMask;
+        if (!_mask.empty()) cv::resize(_mask, levelMask, levels[level].size(), 0, 0, cv::INTER_NEAREST);
+        std::vector<cv::KeyPoint> kps;
+        cv::Mat d;
+        orb->detectAndCompute(levels[level], levelMask, kps, d);
+        const float scale = static_cast<float>(std::pow(scaleFactor, level));
+        for (auto& kp : kps) {
+            kp.pt *= scale;
+            kp.size *= scale;
+            kp.octave = level;
+        }
+        keypoints.insert(keypoints.end(), kps.begin(), kps.end());
+        if (!d.empty()) descs.push_back(d);
+    }
+    if (descs.empty()) {
+        CVDEREF(desc).release();
+    } else {
+        cv::vconcat(descs, CVDEREF(desc));
+    }
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
 bool cv_ORB_empty(ORB self) {
     return CVDEREF(self)->empty();
 }
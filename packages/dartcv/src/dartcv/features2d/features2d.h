@@ -517,6 +517,18 @@ CvStatus* cv_ORB_detectAndCompute(
     bool useProvidedKeypoints,
     CvCallback_0 callback
 );
+// Detects and computes ORB features on the levels of a prebuilt pyramid (level i is
+// scaleFactor^i times smaller) instead of building ORB's own, maxFeatures is distributed over
+// the levels the same way as ORB, keypoints are in level 0 coordinates with octave = level.
+CvStatus* cv_ORB_detectAndComputePyramid(
+    ORB self,
+    VecMat pyramid,
+    double scaleFactor,
+    Mat mask,
+    Mat desc,
+    VecKeyPoint* out_keypoints,
+    CvCallback_0 callback
+);
 bool cv_ORB_empty(ORB self);
 // virtual String 	getDefaultName () const CV_OVERRIDE
 char* cv_ORB_getDefaultName(ORB self);
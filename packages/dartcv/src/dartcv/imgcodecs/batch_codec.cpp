@@ -0,0 +1,198 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/imgcodecs/batch_codec.h"
+#include "dartcv/core/vec.hpp"
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <atomic>
+#include <climits>
+
+namespace cvd {
+
+namespace {
+
+// Runs fn(i) for every item on at most numThreads workers, every worker takes the next item
+// when done with the previous one. fn reports errors with its return value.
+template <typename F>
+std::vector<int> runBatch(size_t n, int numThreads, const F& fn) {
+    std::vector<int> status(n, BATCH_CODEC_OK);
+    if (n == 0) return status;
+    const int threads = numThreads > 0 ? numThreads : std::max(1, cv::getNumThreads());
+    const int workers = static_cast<int>(std::min<size_t>(n, static_cast<size_t>(threads)));
+    std::atomic<size_t> next{0};
+    cv::parallel_for_(
+        cv::Range(0, workers),
+        [&](const cv::Range&) {
+            for (size_t i = next++; i < n; i = next++) {
+                try {
+                    status[i] = fn(i);
+                } catch (...) {
+                    status[i] = BATCH_CODEC_ERROR;
+                }
+            }
+        },
+        workers
+    );
+    return status;
+}
+
+cv::Size targetSize(cv::Size size, cv::Size dsize) {
+    if (dsize.width > 0 && dsize.height > 0) return dsize;
+    if (dsize.width > 0) {
+        return {dsize.width, std::max(1, cvRound(size.height * dsize.width / double(size.width)))};
+    }
+    return {std::max(1, cvRound(size.width * dsize.height / double(size.height))), dsize.height};
+}
+
+void resizeTo(cv::Mat& img, cv::Size dsize, int interpolation) {
+    if (img.empty() || (dsize.width <= 0 && dsize.height <= 0)) return;
+    const cv::Size size = targetSize(img.size(), dsize);
+    if (size == img.size()) return;
+    cv::Mat resized;
+    cv::resize(img, resized, size, 0, 0, interpolation);
+    img = resized;
+}
+
+}  // namespace
+
+std::vector<int> imdecodeBatch(
+    const std::vector<std::vector<char>>& bufs,
+    int flags,
+    cv::Size dsize,
+    int interpolation,
+    int numThreads,
+    std::vector<cv::Mat>& dst
+) {
+    dst.assign(bufs.size(), cv::Mat());
+    return runBatch(bufs.size(), numThreads, [&](size_t i) {
+        const std::vector<char>& buf = bufs[i];
+        if (buf.empty() || buf.size() > static_cast<size_t>(INT_MAX)) return BATCH_CODEC_FAILED;
+        const cv::Mat src(1, static_cast<int>(buf.size()), CV_8UC1, const_cast<char*>(buf.data()));
+        cv::Mat img = cv::imdecode(src, flags);
+        if (img.empty()) return BATCH_CODEC_FAILED;
+        resizeTo(img, dsize, interpolation);
+        dst[i] = img;
+        return BATCH_CODEC_OK;
+    });
+}
+
+std::vector<int> imreadBatch(
+    const std::vector<std::string>& filenames,
+    int flags,
+    cv::Size dsize,
+    int interpolation,
+    int numThreads,
+    std::vector<cv::Mat>& dst
+) {
+    dst.assign(filenames.size(), cv::Mat());
+    return runBatch(filenames.size(), numThreads, [&](size_t i) {
+        cv::Mat img = cv::imread(filenames[i], flags);
+        if (img.empty()) return BATCH_CODEC_FAILED;
+        resizeTo(img, dsize, interpolation);
+        dst[i] = img;
+        return BATCH_CODEC_OK;
+    });
+}
+
+std::vector<int> imencodeBatch(
+    const std::string& ext,
+    const std::vector<cv::Mat>& imgs,
+    const std::vector<int>& params,
+    cv::Size dsize,
+    int interpolation,
+    int numThreads,
+    std::vector<std::vector<char>>& dst
+) {
+    dst.assign(imgs.size(), std::vector<char>());
+    return runBatch(imgs.size(), numThreads, [&](size_t i) {
+        cv::Mat img = imgs[i];
+        if (img.empty()) return BATCH_CODEC_FAILED;
+        resizeTo(img, dsize, interpolation);
+        std::vector<uchar> buf;
+        if (!cv::imencode(ext, img, buf, params)) return BATCH_CODEC_FAILED;
+        dst[i].assign(buf.begin(), buf.end());
+        return BATCH_CODEC_OK;
+    });
+}
+
+}  // namespace cvd
+
+CvStatus* cv_imdecodeBatch(
+    VecVecChar bufs,
+    int flags,
+    CvSize dsize,
+    int interpolation,
+    int numThreads,
+    VecMat* rval,
+    VecI32* status,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    CVDEREF_P(status) = cvd::imdecodeBatch(
+        CVDEREF(bufs),
+        flags,
+        cv::Size(dsize.width, dsize.height),
+        interpolation,
+        numThreads,
+        CVDEREF_P(rval)
+    );
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_imreadBatch(
+    VecVecChar filenames,
+    int flags,
+    CvSize dsize,
+    int interpolation,
+    int numThreads,
+    VecMat* rval,
+    VecI32* status,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    CVDEREF_P(status) = cvd::imreadBatch(
+        vecvecchar_c2cpp_s(filenames),
+        flags,
+        cv::Size(dsize.width, dsize.height),
+        interpolation,
+        numThreads,
+        CVDEREF_P(rval)
+    );
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_imencodeBatch(
+    const char* ext,
+    VecMat imgs,
+    VecI32 params,
+    CvSize dsize,
+    int interpolation,
+    int numThreads,
+    VecVecChar* rval,
+    VecI32* status,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    CVDEREF_P(status) = cvd::imencodeBatch(
+        ext,
+        CVDEREF(imgs),
+        CVDEREF(params),
+        cv::Size(dsize.width, dsize.height),
+        interpolation,
+        numThreads,
+        CVDEREF_P(rval)
+    );
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
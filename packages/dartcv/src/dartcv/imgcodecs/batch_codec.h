@@ -0,0 +1,94 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_BATCH_CODEC_H
+#define DARTCV_LIBRARY_BATCH_CODEC_H
+
+#ifdef __cplusplus
+#include <opencv2/core.hpp>
+#include <string>
+#include <vector>
+
+namespace cvd {
+// Per item status of the batch codecs.
+enum BatchCodecStatus {
+    BATCH_CODEC_OK = 0,
+    // the data could not be decoded, or the encoder failed
+    BATCH_CODEC_FAILED = 1,
+    // an OpenCV error, e.g. an unsupported format or invalid parameters
+    BATCH_CODEC_ERROR = 2,
+};
+
+// Batch decoding and encoding on at most numThreads workers of the OpenCV thread pool
+// (numThreads <= 0: cv::getNumThreads()), items are handed out one by one so large and small
+// images balance. Images are resized to dsize with interpolation when dsize is not empty, a
+// zero width or height keeps the aspect ratio. Failed items are empty and never stop the batch.
+std::vector<int> imdecodeBatch(
+    const std::vector<std::vector<char>>& bufs,
+    int flags,
+    cv::Size dsize,
+    int interpolation,
+    int numThreads,
+    std::vector<cv::Mat>& dst
+);
+std::vector<int> imreadBatch(
+    const std::vector<std::string>& filenames,
+    int flags,
+    cv::Size dsize,
+    int interpolation,
+    int numThreads,
+    std::vector<cv::Mat>& dst
+);
+std::vector<int> imencodeBatch(
+    const std::string& ext,
+    const std::vector<cv::Mat>& imgs,
+    const std::vector<int>& params,
+    cv::Size dsize,
+    int interpolation,
+    int numThreads,
+    std::vector<std::vector<char>>& dst
+);
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+
+CvStatus* cv_imdecodeBatch(
+    VecVecChar bufs,
+    int flags,
+    CvSize dsize,
+    int interpolation,
+    int numThreads,
+    CVD_OUT VecMat* rval,
+    CVD_OUT VecI32* status,
+    CvCallback_0 callback
+);
+CvStatus* cv_imreadBatch(
+    VecVecChar filenames,
+    int flags,
+    CvSize dsize,
+    int interpolation,
+    int numThreads,
+    CVD_OUT VecMat* rval,
+    CVD_OUT VecI32* status,
+    CvCallback_0 callback
+);
+CvStatus* cv_imencodeBatch(
+    const char* ext,
+    VecMat imgs,
+    VecI32 params,
+    CvSize dsize,
+    int interpolation,
+    int numThreads,
+    CVD_OUT VecVecChar* rval,
+    CVD_OUT VecI32* status,
+    CvCallback_0 callback
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_BATCH_CODEC_H
@@ -0,0 +1,114 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/imgcodecs/image_encoder.h"
+#include "dartcv/imgcodecs/batch_codec.h"
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <cstring>
+
+namespace cvd {
+
+ImageEncoder::ImageEncoder(const std::string& ext, const std::vector<int>& params) :
+    ext_(ext), params_(params) {
+    if (!cv::haveImageWriter(ext)) {
+        CV_Error(cv::Error::StsBadArg, "no encoder for '" + ext + "'");
+    }
+}
+
+bool ImageEncoder::encode(const cv::Mat& img) {
+    // the encoders clear and append to the buffer, its capacity is kept
+    if (!cv::imencode(ext_, img, buf_, params_)) {
+        buf_.clear();
+        return false;
+    }
+    return true;
+}
+
+bool ImageEncoder::encodeTo(const cv::Mat& img, uchar* dst, size_t capacity, size_t& size) {
+    size = 0;
+    if (!encode(img)) return false;
+    size = buf_.size();
+    if (size > capacity) return false;
+    if (size > 0) std::memcpy(dst, buf_.data(), size);
+    return true;
+}
+
+std::vector<int> ImageEncoder::encodeBatch(
+    const std::vector<cv::Mat>& imgs, int numThreads, std::vector<std::vector<char>>& dst
+) const {
+    return imencodeBatch(ext_, imgs, params_, cv::Size(), cv::INTER_AREA, numThreads, dst);
+}
+
+}  // namespace cvd
+
+CvStatus* cv_ImageEncoder_create(const char* ext, VecI32 params, ImageEncoder* rval) {
+    BEGIN_WRAP
+    *rval = {new cvd::ImageEncoder(ext, CVDEREF(params))};
+    END_WRAP
+}
+
+void cv_ImageEncoder_close(ImageEncoderPtr self) {
+    CVD_FREE(self);
+}
+
+CvStatus* cv_ImageEncoder_encode(
+    ImageEncoder self,
+    Mat img,
+    bool* success,
+    uint8_t** data,
+    size_t* size,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    *success = self.ptr->encode(CVDEREF(img));
+    const auto& buf = self.ptr->buffer();
+    *data = const_cast<uint8_t*>(buf.data());
+    *size = buf.size();
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_ImageEncoder_encodeTo(
+    ImageEncoder self,
+    Mat img,
+    uint8_t* dst,
+    size_t capacity,
+    bool* success,
+    size_t* size,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    *success = self.ptr->encodeTo(CVDEREF(img), dst, capacity, *size);
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_ImageEncoder_encodeBatch(
+    ImageEncoder self,
+    VecMat imgs,
+    int numThreads,
+    VecVecChar* rval,
+    VecI32* status,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    CVDEREF_P(status) = self.ptr->encodeBatch(CVDEREF(imgs), numThreads, CVDEREF_P(rval));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+size_t cv_ImageEncoder_getCapacity(ImageEncoder self) {
+    return self.ptr->buffer().capacity();
+}
+
+const char* cv_ImageEncoder_getExt(ImageEncoder self) {
+    return self.ptr->ext().c_str();
+}
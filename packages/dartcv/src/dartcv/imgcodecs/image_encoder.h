@@ -0,0 +1,99 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_IMAGE_ENCODER_H
+#define DARTCV_LIBRARY_IMAGE_ENCODER_H
+
+#ifdef __cplusplus
+#include <opencv2/core.hpp>
+#include <string>
+#include <vector>
+
+namespace cvd {
+// A cv::imencode with a fixed format and params, for e.g. streaming MJPEG frames.
+//
+// The params are converted once at creation and the encoded data is written to a buffer owned by
+// the encoder, which keeps its capacity between calls, so encoding frames of a similar size does
+// not allocate. The buffer is overwritten by the next encode, an encoder must not be used by
+// several threads at the same time, except for encodeBatch.
+class ImageEncoder {
+  public:
+    ImageEncoder(const std::string& ext, const std::vector<int>& params);
+
+    // Encodes img into buffer(), returns false if the encoder failed.
+    bool encode(const cv::Mat& img);
+    // Encodes img and copies the data to dst if it fits in capacity, size is always set to the
+    // encoded size so a caller can grow dst and retry.
+    bool encodeTo(const cv::Mat& img, uchar* dst, size_t capacity, size_t& size);
+    // Encodes all of imgs in parallel on at most numThreads workers, see cvd::imencodeBatch.
+    std::vector<int> encodeBatch(
+        const std::vector<cv::Mat>& imgs, int numThreads, std::vector<std::vector<char>>& dst
+    ) const;
+
+    const std::vector<uchar>& buffer() const { return buf_; }
+    const std::string& ext() const { return ext_; }
+    const std::vector<int>& params() const { return params_; }
+
+  private:
+    std::string ext_;
+    std::vector<int> params_;
+    std::vector<uchar> buf_;
+};
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+CVD_TYPEDEF(cvd::ImageEncoder, ImageEncoder);
+#else
+CVD_TYPEDEF(void, ImageEncoder);
+#endif
+
+// ext is a file extension, e.g. ".jpg", an error is raised if no encoder is available for it.
+CvStatus* cv_ImageEncoder_create(const char* ext, VecI32 params, ImageEncoder* rval);
+void cv_ImageEncoder_close(ImageEncoderPtr self);
+
+// data points to the buffer of the encoder, valid until the next encode or close.
+CvStatus* cv_ImageEncoder_encode(
+    ImageEncoder self,
+    Mat img,
+    bool* success,
+    CVD_OUT uint8_t** data,
+    CVD_OUT size_t* size,
+    CvCallback_0 callback
+);
+// success is false if the encoder failed or the data does not fit in capacity, size is the
+// encoded size either way.
+CvStatus* cv_ImageEncoder_encodeTo(
+    ImageEncoder self,
+    Mat img,
+    uint8_t* dst,
+    size_t capacity,
+    bool* success,
+    CVD_OUT size_t* size,
+    CvCallback_0 callback
+);
+CvStatus* cv_ImageEncoder_encodeBatch(
+    ImageEncoder self,
+    VecMat imgs,
+    int numThreads,
+    CVD_OUT VecVecChar* rval,
+    CVD_OUT VecI32* status,
+    CvCallback_0 callback
+);
+
+// The capacity of the buffer of the encoder.
+size_t cv_ImageEncoder_getCapacity(ImageEncoder self);
+// The returned string is owned by the encoder.
+const char* cv_ImageEncoder_getExt(ImageEncoder self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_IMAGE_ENCODER_H
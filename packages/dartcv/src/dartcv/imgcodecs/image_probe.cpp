@@ -0,0 +1,614 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/imgcodecs/image_probe.h"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <vector>
+
+namespace cvd {
+
+namespace {
+
+// bytes read from a file at once, large enough for the header segments of most images
+constexpr size_t kWindow = 1 << 14;
+// TIFF directories followed at most, longer chains are rejected
+constexpr int kMaxPages = 1024;
+
+// Random access to the bytes of an image.
+class Source {
+  public:
+    virtual ~Source() = default;
+    // Reads up to n bytes at pos, returns the number of bytes read.
+    virtual size_t read(uint64_t pos, void* dst, size_t n) = 0;
+
+    bool readAll(uint64_t pos, void* dst, size_t n) { return read(pos, dst, n) == n; }
+};
+
+class MemorySource : public Source {
+  public:
+    MemorySource(const uchar* data, size_t size) : data_(data), size_(size) {}
+
+    size_t read(uint64_t pos, void* dst, size_t n) override {
+        if (pos >= size_) return 0;
+        n = static_cast<size_t>(std::min<uint64_t>(n, size_ - pos));
+        std::memcpy(dst, data_ + pos, n);
+        return n;
+    }
+
+  private:
+    const uchar* data_;
+    size_t size_;
+};
+
+// Reads a file through a small window, the probes read a few bytes at a time.
+class FileSource : public Source {
+  public:
+    explicit FileSource(const std::string& filename) : file_(filename, std::ios::binary) {}
+
+    bool isOpen() const { return file_.is_open(); }
+
+    size_t read(uint64_t pos, void* dst, size_t n) override {
+        if (n > kWindow) return readFile(pos, static_cast<char*>(dst), n);
+        if (pos < start_ || pos + n > start_ + window_.size()) {
+            window_.resize(kWindow);
+            window_.resize(readFile(pos, window_.data(), kWindow));
+            start_ = pos;
+        }
+        const uint64_t end = start_ + window_.size();
+        if (pos >= end) return 0;
+        n = static_cast<size_t>(std::min<uint64_t>(n, end - pos));
+        std::memcpy(dst, window_.data() + (pos - start_), n);
+        return n;
+    }
+
+  private:
+    size_t readFile(uint64_t pos, char* dst, size_t n) {
+        file_.clear();
+        file_.seekg(static_cast<std::streamoff>(pos));
+        file_.read(dst, static_cast<std::streamsize>(n));
+        return static_cast<size_t>(file_.gcount());
+    }
+
+    std::ifstream file_;
+    std::vector<char> window_;
+    uint64_t start_ = 0;
+};
+
+// A range of another source, e.g. the EXIF block in a JPEG.
+class SubSource : public Source {
+  public:
+    SubSource(Source& src, uint64_t offset, uint64_t size) :
+        src_(src), offset_(offset), size_(size) {}
+
+    size_t read(uint64_t pos, void* dst, size_t n) override {
+        if (pos >= size_) return 0;
+        n = static_cast<size_t>(std::min<uint64_t>(n, size_ - pos));
+        return src_.read(offset_ + pos, dst, n);
+    }
+
+  private:
+    Source& src_;
+    uint64_t offset_;
+    uint64_t size_;
+};
+
+inline uint32_t be16(const uchar* p) {
+    return (uint32_t(p[0]) << 8) | p[1];
+}
+inline uint32_t be32(const uchar* p) {
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | p[3];
+}
+inline uint32_t le16(const uchar* p) {
+    return p[0] | (uint32_t(p[1]) << 8);
+}
+inline uint32_t le24(const uchar* p) {
+    return p[0] | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16);
+}
+inline uint32_t le32(const uchar* p) {
+    return le24(p) | (uint32_t(p[3]) << 24);
+}
+
+bool setSize(ImageHeader& header, int64_t width, int64_t height) {
+    if (width <= 0 || height <= 0 || width > INT_MAX || height > INT_MAX) return false;
+    header.width = static_cast<int>(width);
+    header.height = static_cast<int>(height);
+    return true;
+}
+
+// The image file directories (IFD) of a TIFF, or of an EXIF block, which is a TIFF without
+// image data.
+class TiffReader {
+  public:
+    explicit TiffReader(Source& src) : src_(src) {}
+
+    bool open() {
+        uchar h[8];
+        if (!src_.readAll(0, h, 8)) return false;
+        if (h[0] == 'I' && h[1] == 'I') {
+            le_ = true;
+        } else if (h[0] == 'M' && h[1] == 'M') {
+            le_ = false;
+        } else {
+            return false;
+        }
+        first_ = u32(h + 4);
+        return u16(h + 2) == 42;
+    }
+
+    // The 12 byte entries of the first IFD.
+    bool readFirst(std::vector<uchar>& entries) {
+        uchar c[2];
+        if (first_ == 0 || !src_.readAll(first_, c, 2)) return false;
+        entries.resize(size_t(u16(c)) * 12);
+        return src_.readAll(uint64_t(first_) + 2, entries.data(), entries.size());
+    }
+
+    // The first value of the entry with tag, a BYTE, SHORT or LONG.
+    bool find(const std::vector<uchar>& entries, uint32_t tag, uint32_t& value) {
+        for (size_t i = 0; i + 12 <= entries.size(); i += 12) {
+            const uchar* e = entries.data() + i;
+            if (u16(e) != tag) continue;
+            const uint32_t type = u16(e + 2), count = u32(e + 4);
+            const size_t size = type == 1 ? 1 : type == 3 ? 2 : type == 4 ? 4 : 0;
+            if (size == 0 || count == 0) return false;
+            uchar v[4];
+            // values of up to 4 bytes are stored in the entry, the first one left-justified
+            if (size * count <= 4) {
+                std::memcpy(v, e + 8, 4);
+            } else if (!src_.readAll(u32(e + 8), v, size)) {
+                return false;
+            }
+            value = size == 1 ? v[0] : size == 2 ? u16(v) : u32(v);
+            return true;
+        }
+        return false;
+    }
+
+    // The number of IFDs, only their entry counts and next offsets are read.
+    // Returns -1 if the chain loops back to an IFD that was already visited or has more than
+    // kMaxPages IFDs, so a page count is never silently truncated.
+    int count() {
+        std::set<uint32_t> seen;
+        int n = 0;
+        for (uint32_t offset = first_; offset != 0;) {
+            uchar c[4];
+            if (n == kMaxPages || !seen.insert(offset).second) return -1;
+            if (!src_.readAll(offset, c, 2)) break;
+            n++;
+            if (!src_.readAll(uint64_t(offset) + 2 + uint64_t(u16(c)) * 12, c, 4)) break;
+            offset = u32(c);
+        }
+        return n;
+    }
+
+  private:
+    uint32_t u16(const uchar* p) const { return le_ ? le16(p) : be16(p); }
+    uint32_t u32(const uchar* p) const { return le_ ? le32(p) : be32(p); }
+
+    Source& src_;
+    bool le_ = true;
+    uint32_t first_ = 0;
+};
+
+int exifOrientation(Source& exif) {
+    TiffReader tiff(exif);
+    std::vector<uchar> entries;
+    uint32_t value = 1;
+    if (!tiff.open() || !tiff.readFirst(entries) || !tiff.find(entries, 274, value)) return 1;
+    return value >= 1 && value <= 8 ? static_cast<int>(value) : 1;
+}
+
+bool probeJpeg(Source& src, ImageHeader& header) {
+    uchar b[10];
+    bool exifRead = false;
+    for (uint64_t pos = 2;;) {
+        if (!src.readAll(pos, b, 2) || b[0] != 0xFF) return false;
+        const int marker = b[1];
+        if (marker == 0xFF) {
+            // fill byte
+            pos++;
+            continue;
+        }
+        if (marker == 0x01 || marker == 0xD8 || (marker >= 0xD0 && marker <= 0xD7)) {
+            // no length
+            pos += 2;
+            continue;
+        }
+        // EOI or SOS before a frame header
+        if (marker == 0xD9 || marker == 0xDA) return false;
+        if (!src.readAll(pos + 2, b, 2)) return false;
+        const uint32_t len = be16(b);
+        if (len < 2) return false;
+        // the first APP1 with EXIF data
+        if (marker == 0xE1 && !exifRead && len >= 8 && src.readAll(pos + 4, b, 6) &&
+            std::memcmp(b, "Exif\0\0", 6) == 0) {
+            SubSource exif(src, pos + 10, len - 8);
+            header.orientation = exifOrientation(exif);
+            exifRead = true;
+        }
+        // SOF0-SOF15 but DHT, JPG and DAC
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 &&
+            marker != 0xCC) {
+            if (len < 8 || !src.readAll(pos + 4, b, 6)) return false;
+            // CMYK and YCCK are converted to BGR
+            header.channels = b[5] == 1 ? 1 : 3;
+            header.depth = CV_8U;
+            return setSize(header, be16(b + 3), be16(b + 1));
+        }
+        pos += 2 + len;
+    }
+}
+
+bool probePng(Source& src, ImageHeader& header) {
+    uchar b[17];
+    if (!src.readAll(8, b, 17) || std::memcmp(b + 4, "IHDR", 4) != 0) return false;
+    const int bitDepth = b[16];
+    uchar colorType;
+    if (!src.readAll(25, &colorType, 1) || !setSize(header, be32(b + 8), be32(b + 12))) {
+        return false;
+    }
+    bool transparent = false;
+    // the chunks libpng reads before the image data
+    for (uint64_t pos = 33;;) {
+        if (!src.readAll(pos, b, 8)) break;
+        const uint32_t len = be32(b);
+        const uchar* type = b + 4;
+        if (std::memcmp(type, "IDAT", 4) == 0 || std::memcmp(type, "IEND", 4) == 0) break;
+        if (std::memcmp(type, "tRNS", 4) == 0) {
+            transparent = true;
+        } else if (std::memcmp(type, "acTL", 4) == 0 && len >= 8 && src.readAll(pos + 8, b, 4)) {
+            const uint32_t frames = std::min<uint32_t>(be32(b), INT_MAX);
+            header.pages = std::max(static_cast<int>(frames), 1);
+        } else if (std::memcmp(type, "eXIf", 4) == 0) {
+            SubSource exif(src, pos + 8, len);
+            header.orientation = exifOrientation(exif);
+        }
+        pos += 12 + uint64_t(len);
+    }
+    switch (colorType) {
+        case 0: header.channels = 1; break;
+        case 2:
+        case 3: header.channels = transparent ? 4 : 3; break;
+        case 4:
+        case 6: header.channels = 4; break;
+        default: return false;
+    }
+    header.depth = bitDepth == 16 ? CV_16U : CV_8U;
+    return true;
+}
+
+bool probeBmp(Source& src, ImageHeader& header) {
+    uchar b[32];
+    if (!src.readAll(14, b, 4)) return false;
+    const uint32_t headerSize = le32(b);
+    int bpp, paletteEntry;
+    uint32_t colors = 0;
+    if (headerSize == 12) {
+        // OS/2 BITMAPCOREHEADER
+        if (!src.readAll(18, b, 8) || !setSize(header, le16(b), le16(b + 2))) return false;
+        bpp = le16(b + 6);
+        paletteEntry = 3;
+        header.channels = 3;
+    } else if (headerSize >= 40) {
+        if (!src.readAll(18, b, 32)) return false;
+        const int64_t height = static_cast<int32_t>(le32(b + 4));
+        // bottom-up if the height is positive
+        if (!setSize(header, static_cast<int32_t>(le32(b)), height < 0 ? -height : height)) {
+            return false;
+        }
+        bpp = le16(b + 10);
+        paletteEntry = 4;
+        colors = le32(b + 28);
+        // BI_BITFIELDS, 32-bit images with masks are read with their alpha channel
+        header.channels = bpp == 32 && le32(b + 12) == 3 ? 4 : 3;
+    } else {
+        return false;
+    }
+    if (bpp <= 0 || bpp > 32) return false;
+    if (bpp <= 8) {
+        // images with a gray palette are read as gray
+        colors = colors == 0 ? 1u << bpp : std::min(colors, 1u << bpp);
+        std::vector<uchar> palette(size_t(colors) * paletteEntry);
+        if (!src.readAll(14 + uint64_t(headerSize), palette.data(), palette.size())) return false;
+        bool gray = true;
+        for (size_t i = 0; gray && i < palette.size(); i += paletteEntry) {
+            gray = palette[i] == palette[i + 1] && palette[i] == palette[i + 2];
+        }
+        header.channels = gray ? 1 : 3;
+    }
+    header.depth = CV_8U;
+    return true;
+}
+
+// Skips the data sub-blocks at pos, false if they are truncated.
+bool skipGifBlocks(Source& src, uint64_t& pos) {
+    for (;;) {
+        uchar size;
+        if (!src.readAll(pos, &size, 1)) return false;
+        pos += 1 + size;
+        if (size == 0) return true;
+    }
+}
+
+bool probeGif(Source& src, ImageHeader& header) {
+    uchar b[13];
+    if (!src.readAll(0, b, 13) || !setSize(header, le16(b + 6), le16(b + 8))) return false;
+    uint64_t pos = 13 + ((b[10] & 0x80) ? 3u << ((b[10] & 7) + 1) : 0);
+    int frames = 0;
+    // every image descriptor is a frame, the image data is skipped block by block
+    for (;;) {
+        if (!src.readAll(pos, b, 1) || b[0] == 0x3B) break;
+        if (b[0] == 0x21) {
+            pos += 2;
+        } else if (b[0] == 0x2C) {
+            if (!src.readAll(pos, b, 10)) break;
+            frames++;
+            // the local color table and the LZW minimum code size
+            pos += 11 + ((b[9] & 0x80) ? 3u << ((b[9] & 7) + 1) : 0);
+        } else {
+            break;
+        }
+        if (!skipGifBlocks(src, pos)) break;
+    }
+    // GIFs are read as BGRA, like OpenCV's GIF decoder
+    header.channels = 4;
+    header.depth = CV_8U;
+    header.pages = std::max(frames, 1);
+    return true;
+}
+
+bool probeWebp(Source& src, ImageHeader& header) {
+    uchar b[12];
+    if (!src.readAll(4, b, 4)) return false;
+    const uint64_t end = 8 + uint64_t(le32(b));
+    bool found = false, alpha = false, animated = false;
+    int frames = 0;
+    for (uint64_t pos = 12; pos + 8 <= end;) {
+        if (!src.readAll(pos, b, 8)) break;
+        char type[4];
+        std::memcpy(type, b, 4);
+        const uint32_t size = le32(b + 4);
+        if (std::memcmp(type, "VP8X", 4) == 0 && size >= 10 && src.readAll(pos + 8, b, 10)) {
+            // the canvas of an extended file
+            alpha = (b[0] & 0x10) != 0;
+            animated = (b[0] & 0x02) != 0;
+            found = setSize(header, le24(b + 4) + 1, le24(b + 7) + 1);
+            if (!found) return false;
+        } else if (std::memcmp(type, "VP8 ", 4) == 0 && !found && size >= 10 &&
+                   src.readAll(pos + 8, b, 10)) {
+            if (b[3] != 0x9D || b[4] != 0x01 || b[5] != 0x2A) return false;
+            found = setSize(header, le16(b + 6) & 0x3FFF, le16(b + 8) & 0x3FFF);
+            if (!found) return false;
+        } else if (std::memcmp(type, "VP8L", 4) == 0 && !found && size >= 5 &&
+                   src.readAll(pos + 8, b, 5)) {
+            if (b[0] != 0x2F) return false;
+            const uint32_t bits = le32(b + 1);
+            alpha = ((bits >> 28) & 1) != 0;
+            found = setSize(header, (bits & 0x3FFF) + 1, ((bits >> 14) & 0x3FFF) + 1);
+            if (!found) return false;
+        } else if (std::memcmp(type, "ALPH", 4) == 0) {
+            alpha = true;
+        } else if (std::memcmp(type, "ANMF", 4) == 0) {
+            frames++;
+        } else if (std::memcmp(type, "EXIF", 4) == 0) {
+            // some writers keep the "Exif\0\0" prefix of JPEG
+            uint64_t offset = pos + 8, len = size;
+            if (len >= 6 && src.readAll(offset, b, 6) && std::memcmp(b, "Exif\0\0", 6) == 0) {
+                offset += 6;
+                len -= 6;
+            }
+            SubSource exif(src, offset, len);
+            header.orientation = exifOrientation(exif);
+        }
+        pos += 8 + uint64_t(size) + (size & 1);
+    }
+    header.channels = alpha ? 4 : 3;
+    header.depth = CV_8U;
+    header.pages = animated ? std::max(frames, 1) : 1;
+    return found;
+}
+
+bool probeTiff(Source& src, ImageHeader& header) {
+    TiffReader tiff(src);
+    std::vector<uchar> entries;
+    if (!tiff.open() || !tiff.readFirst(entries)) return false;
+    uint32_t width = 0, height = 0, spp = 1, bits = 1, format = 1, photometric = 1;
+    uint32_t orientation = 1;
+    if (!tiff.find(entries, 256, width) || !tiff.find(entries, 257, height)) return false;
+    tiff.find(entries, 258, bits);
+    tiff.find(entries, 262, photometric);
+    tiff.find(entries, 274, orientation);
+    tiff.find(entries, 277, spp);
+    tiff.find(entries, 339, format);
+    if (!setSize(header, width, height) || spp == 0) return false;
+    // palette images are read as BGR, gray with alpha as BGRA
+    if (photometric == 3) {
+        header.channels = 3;
+    } else {
+        header.channels = spp == 1 ? 1 : spp == 3 ? 3 : 4;
+    }
+    if (format == 3) {
+        header.depth = bits == 16 ? CV_16F : bits == 32 ? CV_32F : bits == 64 ? CV_64F : -1;
+    } else if (bits <= 8) {
+        header.depth = CV_8U;
+    } else if (bits <= 16) {
+        header.depth = format == 2 ? CV_16S : CV_16U;
+    } else {
+        header.depth = bits == 32 ? CV_32S : -1;
+    }
+    header.orientation = orientation >= 1 && orientation <= 8 ? static_cast<int>(orientation) : 1;
+    const int pages = tiff.count();
+    header.pages = std::max(pages, 1);
+    return pages >= 0 && header.depth >= 0;
+}
+
+// Netpbm headers are text, separated by whitespace and comments.
+class PnmTokens {
+  public:
+    PnmTokens(const char* data, size_t size) : p_(data), end_(data + size) {}
+
+    bool word(std::string& w) {
+        skip();
+        w.clear();
+        while (p_ < end_ && !space(*p_)) w += *p_++;
+        // a token running into the end may be truncated
+        return !w.empty() && p_ < end_;
+    }
+
+    bool number(int64_t& v) {
+        std::string w;
+        if (!word(w) || w.size() > 10) return false;
+        v = 0;
+        for (const char c : w) {
+            if (c < '0' || c > '9') return false;
+            v = v * 10 + (c - '0');
+        }
+        return true;
+    }
+
+    void skipLine() {
+        while (p_ < end_ && *p_ != '\n') p_++;
+    }
+
+  private:
+    static bool space(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+    void skip() {
+        while (p_ < end_) {
+            if (*p_ == '#') {
+                skipLine();
+            } else if (space(*p_)) {
+                p_++;
+            } else {
+                break;
+            }
+        }
+    }
+
+    const char* p_;
+    const char* end_;
+};
+
+bool probePnm(Source& src, ImageHeader& header) {
+    // the header is assumed to fit in the first bytes, unless it has very long comments
+    std::vector<char> buf(4096);
+    buf.resize(src.read(0, buf.data(), buf.size()));
+    PnmTokens tokens(buf.data(), buf.size());
+    std::string magic;
+    if (!tokens.word(magic) || magic.size() != 2) return false;
+    const char type = magic[1];
+    int64_t width = 0, height = 0, channels = 1, maxval = 1;
+    if (type == '7') {
+        // PAM, "KEY value" lines up to ENDHDR
+        std::string key;
+        for (;;) {
+            if (!tokens.word(key)) return false;
+            if (key == "ENDHDR") break;
+            if (key == "WIDTH") {
+                if (!tokens.number(width)) return false;
+            } else if (key == "HEIGHT") {
+                if (!tokens.number(height)) return false;
+            } else if (key == "DEPTH") {
+                if (!tokens.number(channels)) return false;
+            } else if (key == "MAXVAL") {
+                if (!tokens.number(maxval)) return false;
+            } else {
+                tokens.skipLine();
+            }
+        }
+        if (channels < 1 || channels > 4) return false;
+    } else {
+        if (type < '1' || type > '6') return false;
+        if (!tokens.number(width) || !tokens.number(height)) return false;
+        // bitmaps have no maxval
+        if (type != '1' && type != '4' && !tokens.number(maxval)) return false;
+        channels = type == '3' || type == '6' ? 3 : 1;
+    }
+    if (maxval < 1 || maxval > 65535) return false;
+    header.channels = static_cast<int>(channels);
+    header.depth = maxval > 255 ? CV_16U : CV_8U;
+    return setSize(header, width, height);
+}
+
+bool probe(Source& src, ImageHeader& header) {
+    header = ImageHeader();
+    uchar m[12] = {0};
+    const size_t n = src.read(0, m, sizeof(m));
+    if (n >= 3 && m[0] == 0xFF && m[1] == 0xD8 && m[2] == 0xFF) return probeJpeg(src, header);
+    if (n >= 8 && std::memcmp(m, "\x89PNG\r\n\x1a\n", 8) == 0) return probePng(src, header);
+    if (n >= 2 && m[0] == 'B' && m[1] == 'M') return probeBmp(src, header);
+    if (n >= 6 && (std::memcmp(m, "GIF87a", 6) == 0 || std::memcmp(m, "GIF89a", 6) == 0)) {
+        return probeGif(src, header);
+    }
+    if (n >= 12 && std::memcmp(m, "RIFF", 4) == 0 && std::memcmp(m + 8, "WEBP", 4) == 0) {
+        return probeWebp(src, header);
+    }
+    if (n >= 4 && (std::memcmp(m, "II*\0", 4) == 0 || std::memcmp(m, "MM\0*", 4) == 0)) {
+        return probeTiff(src, header);
+    }
+    if (n >= 2 && m[0] == 'P' && m[1] >= '1' && m[1] <= '7') return probePnm(src, header);
+    return false;
+}
+
+}  // namespace
+
+bool improbe(const std::string& filename, ImageHeader& header) {
+    FileSource src(filename);
+    if (!src.isOpen()) {
+        header = ImageHeader();
+        return false;
+    }
+    return probe(src, header);
+}
+
+bool improbe(const uchar* buf, size_t size, ImageHeader& header) {
+    MemorySource src(buf, buf == nullptr ? 0 : size);
+    return probe(src, header);
+}
+
+}  // namespace cvd
+
+namespace {
+CvImageHeader toC(const cvd::ImageHeader& header) {
+    return {
+        header.width,
+        header.height,
+        header.channels,
+        header.depth,
+        header.orientation,
+        header.pages,
+    };
+}
+}  // namespace
+
+CvStatus* cv_improbe(
+    const char* filename, bool* success, CvImageHeader* rval, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    cvd::ImageHeader header;
+    *success = cvd::improbe(filename, header);
+    *rval = toC(header);
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_improbe_1(
+    const uint8_t* buf, size_t size, bool* success, CvImageHeader* rval, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    cvd::ImageHeader header;
+    *success = cvd::improbe(buf, size, header);
+    *rval = toC(header);
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
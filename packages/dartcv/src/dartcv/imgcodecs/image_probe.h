@@ -0,0 +1,61 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_IMAGE_PROBE_H
+#define DARTCV_LIBRARY_IMAGE_PROBE_H
+
+#ifdef __cplusplus
+#include <opencv2/core.hpp>
+#include <string>
+
+namespace cvd {
+// What the header of an image tells without decoding it, the channels and depth are the ones
+// cv::imread returns with IMREAD_UNCHANGED. width and height are the stored size, cv::imread
+// swaps them for an EXIF orientation of 5 to 8 unless IMREAD_IGNORE_ORIENTATION is set.
+struct ImageHeader {
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    int depth = CV_8U;
+    // EXIF orientation, 1 to 8, 1 if the image has none
+    int orientation = 1;
+    // pages of a TIFF (at most 1024), frames of a GIF, an animated PNG or WebP, 1 otherwise
+    int pages = 1;
+};
+
+// Reads the header of a JPEG, PNG, BMP, GIF, WebP, TIFF or PNM/PAM image, only the header
+// segments are read, e.g. up to the start of frame of a JPEG, and the image data is skipped.
+// Returns false for other formats, truncated or malformed headers and TIFFs with more than 1024
+// pages, whose page count is not read to the end.
+bool improbe(const std::string& filename, ImageHeader& header);
+bool improbe(const uchar* buf, size_t size, ImageHeader& header);
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct CvImageHeader {
+    int width;
+    int height;
+    int channels;
+    int depth;
+    int orientation;
+    int pages;
+} CvImageHeader;
+
+CvStatus* cv_improbe(
+    const char* filename, bool* success, CvImageHeader* rval, CvCallback_0 callback
+);
+CvStatus* cv_improbe_1(
+    const uint8_t* buf, size_t size, bool* success, CvImageHeader* rval, CvCallback_0 callback
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_IMAGE_PROBE_H
@@ -6,9 +6,117 @@
     Licensed: Apache 2.0 license. Copyright (c) 2024 Rainyl.
 */
 
+#include <climits>
 #include <vector>
 #include "dartcv/imgcodecs/imgcodecs.h"
 
+namespace {
+
+int reducedFlags(int flags, int reduce) {
+    if (reduce == 1) return flags;
+    CV_Assert(flags != cv::IMREAD_UNCHANGED);
+    switch (reduce) {
+        case 2: return flags | cv::IMREAD_REDUCED_GRAYSCALE_2;
+        case 4: return flags | cv::IMREAD_REDUCED_GRAYSCALE_4;
+        case 8: return flags | cv::IMREAD_REDUCED_GRAYSCALE_8;
+        default: CV_Error(cv::Error::StsBadArg, "reduce must be 1, 2, 4 or 8");
+    }
+}
+
+// Copies roi, given in full resolution coordinates, of img reduced by reduce into dst.
+void copyRegion(const cv::Mat& img, CvRect roi, int reduce, cv::Mat& dst) {
+    if (img.empty()) {
+        dst.release();
+        return;
+    }
+    const int x0 = roi.x / reduce, y0 = roi.y / reduce;
+    const int x1 = (roi.x + roi.width + reduce - 1) / reduce;
+    const int y1 = (roi.y + roi.height + reduce - 1) / reduce;
+    const cv::Rect r = cv::Rect(x0, y0, x1 - x0, y1 - y0) & cv::Rect(0, 0, img.cols, img.rows);
+    CV_Assert(!r.empty());
+    img(r).copyTo(dst);
+}
+
+// Hands the buffer of a pooled Mat to the next create() of the same size and type on this
+// thread, the UMatData keeps a reference to the pooled Mat so the buffer outlives it.
+class PoolAllocator : public cv::MatAllocator {
+  public:
+    static PoolAllocator* instance() {
+        static PoolAllocator allocator;
+        return &allocator;
+    }
+
+    static cv::Mat*& pooled() {
+        static thread_local cv::Mat* mat = nullptr;
+        return mat;
+    }
+
+    cv::UMatData* allocate(
+        int dims,
+        const int* sizes,
+        int type,
+        void* data0,
+        size_t* step,
+        cv::AccessFlag flags,
+        cv::UMatUsageFlags usageFlags
+    ) const override {
+        cv::Mat*& p = pooled();
+        size_t total = CV_ELEM_SIZE(type);
+        for (int i = 0; i < dims; i++) total *= sizes[i];
+        if (data0 != nullptr || p == nullptr || p->type() != type ||
+            p->total() * p->elemSize() != total) {
+            return cv::Mat::getDefaultAllocator()->allocate(
+                dims, sizes, type, data0, step, flags, usageFlags
+            );
+        }
+        size_t s = CV_ELEM_SIZE(type);
+        for (int i = dims - 1; i >= 0; i--) {
+            step[i] = s;
+            s *= sizes[i];
+        }
+        cv::UMatData* u = new cv::UMatData(this);
+        u->data = u->origdata = p->data;
+        u->size = total;
+        u->userdata = new cv::Mat(*p);
+        p = nullptr;
+        return u;
+    }
+
+    bool allocate(cv::UMatData* u, cv::AccessFlag, cv::UMatUsageFlags) const override {
+        return u != nullptr;
+    }
+
+    void deallocate(cv::UMatData* u) const override {
+        if (u == nullptr) return;
+        CV_Assert(u->urefcount == 0 && u->refcount == 0);
+        delete static_cast<cv::Mat*>(u->userdata);
+        delete u;
+    }
+};
+
+// Decodes src into dst, reusing its buffer when the size and type match, dst is released
+// if src cannot be decoded. cv::imdecode returns its dst untouched when no decoder matches or
+// the header cannot be read, so it decodes into an empty Mat, which stays empty then, and
+// PoolAllocator gives that Mat dst's buffer.
+void decodeInto(const cv::Mat& src, int flags, cv::Mat& dst) {
+    struct Reset {
+        ~Reset() { PoolAllocator::pooled() = nullptr; }
+    } reset;
+    cv::Mat img;
+    if (!dst.empty() && dst.isContinuous()) {
+        img.allocator = PoolAllocator::instance();
+        PoolAllocator::pooled() = &dst;
+    }
+    cv::imdecode(src, flags, &img);
+    if (img.empty()) {
+        dst.release();
+    } else {
+        dst = img;
+    }
+}
+
+}  // namespace
+
 bool cv_haveImageReader(const char* filename) {
     return cv::haveImageReader(filename);
 }
@@ -31,6 +139,52 @@ CvStatus* cv_imdecode(VecUChar buf, int flags, Mat* rval, CvCallback_0 callback)
     END_WRAP
 }
 
+CvStatus* cv_imdecode_1(
+    const uint8_t* buf, size_t size, int flags, Mat dst, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    CV_Assert((buf != nullptr || size == 0) && size <= static_cast<size_t>(INT_MAX));
+    cv::Mat& out = CVDEREF(dst);
+    if (size == 0) {
+        out.release();
+    } else {
+        // a header over the caller's bytes, decoded into out's buffer when it fits
+        const cv::Mat src(1, static_cast<int>(size), CV_8UC1, const_cast<uint8_t*>(buf));
+        decodeInto(src, flags, out);
+    }
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_imdecode_2(
+    const uint8_t* buf,
+    size_t size,
+    int flags,
+    CvRect roi,
+    int reduce,
+    Mat dst,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    CV_Assert(buf != nullptr && size > 0 && size <= static_cast<size_t>(INT_MAX));
+    const int f = reducedFlags(flags, reduce);
+    const cv::Mat src(1, static_cast<int>(size), CV_8UC1, const_cast<uint8_t*>(buf));
+    cv::Mat& out = CVDEREF(dst);
+    if (roi.width <= 0 || roi.height <= 0) {
+        decodeInto(src, f, out);
+    } else {
+        cv::Mat img;
+        cv::imdecode(src, f, &img);
+        copyRegion(img, roi, reduce, out);
+    }
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
 CvStatus* cv_imencode(
     const char* fileExt, Mat img, bool* success, VecUChar* rval, CvCallback_0 callback
 ) {
@@ -67,6 +221,22 @@ CvStatus* cv_imread(const char* filename, int flags, Mat* rval, CvCallback_0 cal
     END_WRAP
 }
 
+CvStatus* cv_imread_1(
+    const char* filename, int flags, CvRect roi, int reduce, Mat dst, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    cv::Mat img = cv::imread(filename, reducedFlags(flags, reduce));
+    if (roi.width <= 0 || roi.height <= 0) {
+        CVDEREF(dst) = img;
+    } else {
+        copyRegion(img, roi, reduce, CVDEREF(dst));
+    }
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
 CvStatus* cv_imwrite(const char* filename, Mat img, bool* rval, CvCallback_0 callback) {
     BEGIN_WRAP
     *rval = cv::imwrite(filename, CVDEREF(img));
@@ -16,11 +16,30 @@ extern "C" {
 
 #include "dartcv/core/types.h"
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 bool cv_haveImageReader(const char* filename);
 bool cv_haveImageWriter(const char* filename);
 size_t cv_imcount(const char* filename, int flags);
 CvStatus* cv_imdecode(VecUChar buf, int flags, CVD_OUT Mat* rval, CvCallback_0 callback);
+// Decodes size bytes borrowed from buf, without copying them, into dst, whose buffer is reused
+// when the size and type of the image match. dst is released if the data cannot be decoded.
+CvStatus* cv_imdecode_1(
+    const uint8_t* buf, size_t size, int flags, CVD_OUT Mat dst, CvCallback_0 callback
+);
+// Decodes the roi of the image reduced by reduce (1, 2, 4 or 8, see IMREAD_REDUCED_*) into dst.
+// roi is given in full resolution coordinates of the oriented image, an empty roi means the
+// whole image, JPEGs are decoded at the reduced size directly (DCT scaling).
+CvStatus* cv_imdecode_2(
+    const uint8_t* buf,
+    size_t size,
+    int flags,
+    CvRect roi,
+    int reduce,
+    CVD_OUT Mat dst,
+    CvCallback_0 callback
+);
 CvStatus* cv_imencode(
     const char* fileExt,
     Mat img,
@@ -37,6 +56,10 @@ CvStatus* cv_imencode_1(
     CvCallback_0 callback
 );
 CvStatus* cv_imread(const char* filename, int flags, CVD_OUT Mat* rval, CvCallback_0 callback);
+// Same as cv_imdecode_2 but reads the file.
+CvStatus* cv_imread_1(
+    const char* filename, int flags, CvRect roi, int reduce, CVD_OUT Mat dst, CvCallback_0 callback
+);
 CvStatus* cv_imwrite(const char* filename, Mat img, CVD_OUT bool* rval, CvCallback_0 callback);
 CvStatus* cv_imwrite_1(
     const char* filename, Mat img, VecI32 params, CVD_OUT bool* rval, CvCallback_0 callback
@@ -0,0 +1,245 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/imgproc/component_labeler.h"
+#include <algorithm>
+
+namespace cvd {
+
+ComponentLabeler::ComponentLabeler(int connectivity, int minArea) :
+    connectivity_(connectivity), minArea_(minArea) {
+    CV_Assert(connectivity == 4 || connectivity == 8);
+}
+
+void ComponentLabeler::reset() {
+    width_ = -1;
+    rows_ = 0;
+    nodes_.clear();
+    free_.clear();
+    active_.clear();
+    prev_.clear();
+    curr_.clear();
+    done_.clear();
+}
+
+int ComponentLabeler::newNode() {
+    int id;
+    if (free_.empty()) {
+        id = static_cast<int>(nodes_.size());
+        nodes_.emplace_back();
+    } else {
+        id = free_.back();
+        free_.pop_back();
+    }
+    active_.push_back(id);
+    return id;
+}
+
+int ComponentLabeler::find(int n) {
+    int root = n;
+    while (nodes_[root].parent != root) root = nodes_[root].parent;
+    while (nodes_[n].parent != root) {
+        const int next = nodes_[n].parent;
+        nodes_[n].parent = root;
+        n = next;
+    }
+    return root;
+}
+
+// the root is the component whose first pixel comes first in raster order, its statistics
+// absorb those of the other one
+void ComponentLabeler::unite(int a, int b) {
+    a = find(a);
+    b = find(b);
+    if (a == b) return;
+    if (std::make_pair(nodes_[b].top, nodes_[b].firstX) < std::make_pair(nodes_[a].top, nodes_[a].firstX))
+        std::swap(a, b);
+    Node& r = nodes_[a];
+    Node& c = nodes_[b];
+    c.parent = a;
+    r.live = r.live || c.live;
+    r.area += c.area;
+    r.left = std::min(r.left, c.left);
+    r.right = std::max(r.right, c.right);
+    r.bottom = std::max(r.bottom, c.bottom);
+    r.sumX += c.sumX;
+    r.sumY += c.sumY;
+    r.sumI += c.sumI;
+}
+
+void ComponentLabeler::emit(const Node& n) {
+    if (n.area < minArea_) return;
+    const double area = static_cast<double>(n.area);
+    done_.push_back(
+        {n.top,
+         n.firstX,
+         {static_cast<double>(n.left),
+          static_cast<double>(n.top),
+          static_cast<double>(n.right - n.left + 1),
+          static_cast<double>(n.bottom - n.top + 1),
+          area,
+          n.sumX / area,
+          n.sumY / area,
+          n.sumI / area}}
+    );
+}
+
+// Components without a run on the row just labeled are complete and emitted, nodes that were
+// merged into another root are no longer referenced and are recycled.
+void ComponentLabeler::endRow() {
+    for (auto& r : curr_) r.node = find(r.node);
+    std::vector<int> active;
+    active.reserve(active_.size());
+    for (int id : active_) {
+        const Node& n = nodes_[id];
+        if (n.parent == id && n.live) {
+            active.push_back(id);
+            continue;
+        }
+        if (n.parent == id) emit(n);
+        free_.push_back(id);
+    }
+    active_.swap(active);
+    std::swap(prev_, curr_);
+}
+
+void ComponentLabeler::push(const cv::Mat& strip, const cv::Mat& intensity) {
+    CV_Assert(strip.type() == CV_8UC1);
+    if (strip.empty()) return;
+    if (width_ < 0) width_ = strip.cols;
+    if (strip.cols != width_) CV_Error(cv::Error::StsBadSize, "all strips must have the same width");
+    const bool hasIntensity = !intensity.empty();
+    if (hasIntensity) {
+        CV_Assert(intensity.size() == strip.size() && intensity.channels() == 1);
+        intensity.convertTo(intensity64_, CV_64F);
+    }
+    // with 8-connectivity runs touching diagonally are connected as well
+    const int d = connectivity_ == 8 ? 1 : 0;
+
+    for (int y = 0; y < strip.rows; y++, rows_++) {
+        const uchar* row = strip.ptr<uchar>(y);
+        const double* irow = hasIntensity ? intensity64_.ptr<double>(y) : nullptr;
+        for (int id : active_) nodes_[id].live = false;
+
+        curr_.clear();
+        size_t j = 0;
+        int x = 0;
+        while (x < width_) {
+            while (x < width_ && !row[x]) x++;
+            if (x >= width_) break;
+            const int x0 = x;
+            while (x < width_ && row[x]) x++;
+            const int x1 = x;
+
+            // previous runs overlapping [x0 - d, x1 + d)
+            while (j < prev_.size() && prev_[j].x1 + d <= x0) j++;
+            int node = -1;
+            for (size_t k = j; k < prev_.size() && prev_[k].x0 < x1 + d; k++) {
+                if (node < 0) {
+                    node = find(prev_[k].node);
+                } else {
+                    unite(node, prev_[k].node);
+                    node = find(node);
+                }
+            }
+            if (node < 0) {
+                node = newNode();
+                Node& n = nodes_[node];
+                n = {node, false, 0, x0, rows_, x1 - 1, rows_, x0, 0, 0, 0};
+            }
+
+            Node& n = nodes_[node];
+            const int len = x1 - x0;
+            n.live = true;
+            n.area += len;
+            n.left = std::min(n.left, x0);
+            n.right = std::max(n.right, x1 - 1);
+            n.bottom = rows_;
+            n.sumX += (x0 + x1 - 1) * 0.5 * len;
+            n.sumY += static_cast<double>(rows_) * len;
+            if (irow != nullptr) {
+                double s = 0;
+                for (int i = x0; i < x1; i++) s += irow[i];
+                n.sumI += s;
+            }
+            curr_.push_back({x0, x1, node});
+        }
+        endRow();
+    }
+}
+
+int ComponentLabeler::finish(cv::Mat& stats) {
+    for (int id : active_) {
+        if (nodes_[id].parent == id) emit(nodes_[id]);
+    }
+    std::sort(done_.begin(), done_.end(), [](const Done& a, const Done& b) {
+        return a.top != b.top ? a.top < b.top : a.firstX < b.firstX;
+    });
+
+    const int n = static_cast<int>(done_.size());
+    if (n == 0) {
+        stats.release();
+    } else {
+        stats.create(NUM_STATS, n, CV_64F);
+        for (int i = 0; i < n; i++) {
+            for (int s = 0; s < NUM_STATS; s++) stats.at<double>(s, i) = done_[i].stats[s];
+        }
+    }
+    reset();
+    return n;
+}
+
+}  // namespace cvd
+
+CvStatus* cv_ComponentLabeler_create(int connectivity, int minArea, ComponentLabeler* rval) {
+    BEGIN_WRAP
+    *rval = {new cvd::ComponentLabeler(connectivity, minArea)};
+    END_WRAP
+}
+
+void cv_ComponentLabeler_close(ComponentLabelerPtr self) {
+    CVD_FREE(self);
+}
+
+CvStatus* cv_ComponentLabeler_push(
+    ComponentLabeler self, Mat strip, Mat intensity, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    self.ptr->push(CVDEREF(strip), CVDEREF(intensity));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_ComponentLabeler_finish(
+    ComponentLabeler self, Mat stats, int* rval, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    *rval = self.ptr->finish(CVDEREF(stats));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+void cv_ComponentLabeler_reset(ComponentLabeler self) {
+    self.ptr->reset();
+}
+
+int cv_ComponentLabeler_getConnectivity(ComponentLabeler self) {
+    return self.ptr->connectivity();
+}
+
+int cv_ComponentLabeler_getMinArea(ComponentLabeler self) {
+    return self.ptr->minArea();
+}
+
+void cv_ComponentLabeler_setMinArea(ComponentLabeler self, int minArea) {
+    self.ptr->setMinArea(minArea);
+}
+
+int cv_ComponentLabeler_getRows(ComponentLabeler self) {
+    return self.ptr->rows();
+}
@@ -0,0 +1,119 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_COMPONENT_LABELER_H
+#define DARTCV_LIBRARY_COMPONENT_LABELER_H
+
+#ifdef __cplusplus
+#include <array>
+#include <cstdint>
+#include <opencv2/imgproc.hpp>
+#include <vector>
+
+namespace cvd {
+// Streaming connected-components labeling that only produces per-component statistics.
+//
+// The image is pushed as row strips of any height, each row is run-length encoded and the
+// runs are merged with the overlapping runs of the previous row by union-find, the statistics
+// are accumulated on the union-find roots while labeling. Only the runs of the last row are
+// kept, a component is emitted as soon as it has no run on the current row, and components
+// with area < minArea are dropped, so memory is bounded by the image width, not its height.
+class ComponentLabeler {
+  public:
+    // rows of the columnar stats, 0-4 are the same as cv::ConnectedComponentsTypes
+    enum Stat { LEFT = 0, TOP, WIDTH, HEIGHT, AREA, CX, CY, MEAN, NUM_STATS };
+
+    ComponentLabeler(int connectivity, int minArea);
+
+    // strip: CV_8UC1, non-zero pixels are foreground; intensity: empty or single channel of
+    // the same size, averaged per component
+    void push(const cv::Mat& strip, const cv::Mat& intensity);
+    // flushes the open components and writes NUM_STATS x N CV_64F stats, one column per
+    // component in raster order of their first pixel, then resets for the next image
+    int finish(cv::Mat& stats);
+    void reset();
+
+    int connectivity() const { return connectivity_; }
+    int minArea() const { return minArea_; }
+    void setMinArea(int minArea) { minArea_ = minArea; }
+    int rows() const { return rows_; }
+
+  private:
+    struct Run {
+        int x0, x1;  // [x0, x1)
+        int node;
+    };
+
+    struct Node {
+        int parent;
+        bool live;  // has a run on the current row
+        int64_t area;
+        int left, top, right, bottom, firstX;
+        double sumX, sumY, sumI;
+    };
+
+    int newNode();
+    int find(int n);
+    void unite(int a, int b);
+    void emit(const Node& n);
+    void endRow();
+
+    int connectivity_;
+    int minArea_;
+    int width_ = -1;
+    int rows_ = 0;
+
+    std::vector<Node> nodes_;
+    std::vector<int> free_;
+    std::vector<int> active_;  // allocated nodes
+    std::vector<Run> prev_, curr_;
+    // emitted components, sorted by (top, firstX) in finish()
+    struct Done {
+        int top, firstX;
+        std::array<double, NUM_STATS> stats;
+    };
+    std::vector<Done> done_;
+    cv::Mat intensity64_;
+};
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+CVD_TYPEDEF(cvd::ComponentLabeler, ComponentLabeler);
+#else
+CVD_TYPEDEF(void, ComponentLabeler);
+#endif
+
+// Creates a streaming connected-components labeler, connectivity is 4 or 8,
+// components with area < minArea are dropped.
+CvStatus* cv_ComponentLabeler_create(int connectivity, int minArea, ComponentLabeler* rval);
+void cv_ComponentLabeler_close(ComponentLabelerPtr self);
+
+// Labels the next rows of the image, strip is CV_8UC1 and intensity is empty or a single
+// channel Mat of the same size.
+CvStatus* cv_ComponentLabeler_push(
+    ComponentLabeler self, Mat strip, Mat intensity, CvCallback_0 callback
+);
+
+// Finishes the image, stats is NUM_STATS x N CV_64F (left, top, width, height, area, cx, cy,
+// mean), rval is N, the labeler is then ready for the next image.
+CvStatus* cv_ComponentLabeler_finish(
+    ComponentLabeler self, CVD_OUT Mat stats, CVD_OUT int* rval, CvCallback_0 callback
+);
+
+void cv_ComponentLabeler_reset(ComponentLabeler self);
+int cv_ComponentLabeler_getConnectivity(ComponentLabeler self);
+int cv_ComponentLabeler_getMinArea(ComponentLabeler self);
+void cv_ComponentLabeler_setMinArea(ComponentLabeler self, int minArea);
+int cv_ComponentLabeler_getRows(ComponentLabeler self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_COMPONENT_LABELER_H
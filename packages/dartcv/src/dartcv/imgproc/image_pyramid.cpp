@@ -0,0 +1,128 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/imgproc/image_pyramid.h"
+#include <cmath>
+
+namespace cvd {
+
+ImagePyramid::ImagePyramid(int levels, double scaleFactor, int padding, int borderType) :
+    nlevels_(levels), scaleFactor_(scaleFactor), padding_(padding), borderType_(borderType) {
+    CV_Assert(levels > 0 && scaleFactor > 1 && padding >= 0);
+}
+
+void ImagePyramid::build(const cv::Mat& src) {
+    CV_Assert(!src.empty());
+    const bool gaussian = scaleFactor_ == 2;
+
+    std::vector<cv::Size> sizes(nlevels_);
+    sizes[0] = src.size();
+    for (int i = 1; i < nlevels_; i++) {
+        if (gaussian) {
+            // default dstsize of cv::pyrDown
+            sizes[i] = cv::Size((sizes[i - 1].width + 1) / 2, (sizes[i - 1].height + 1) / 2);
+        } else {
+            const double scale = std::pow(scaleFactor_, i);
+            sizes[i] = cv::Size(cvRound(src.cols / scale), cvRound(src.rows / scale));
+        }
+        CV_Assert(sizes[i].width > 0 && sizes[i].height > 0);
+    }
+
+    padded_.resize(nlevels_);
+    levels_.resize(nlevels_);
+    for (int i = 0; i < nlevels_; i++) {
+        // create() is a no-op when the frame size does not change
+        padded_[i].create(sizes[i].height + padding_ * 2, sizes[i].width + padding_ * 2, src.type());
+        levels_[i] = padded_[i](cv::Rect(padding_, padding_, sizes[i].width, sizes[i].height));
+    }
+
+    src.copyTo(levels_[0]);
+    if (gaussian) {
+        // every level depends on the previous one, cv::pyrDown is parallel itself
+        for (int i = 1; i < nlevels_; i++) {
+            cv::pyrDown(levels_[i - 1], levels_[i], sizes[i]);
+        }
+    } else {
+        cv::parallel_for_(cv::Range(1, nlevels_), [&](const cv::Range& range) {
+            for (int i = range.start; i < range.end; i++) {
+                cv::resize(src, levels_[i], sizes[i], 0, 0, cv::INTER_AREA);
+            }
+        });
+    }
+
+    if (padding_ > 0) {
+        cv::parallel_for_(cv::Range(0, nlevels_), [&](const cv::Range& range) {
+            for (int i = range.start; i < range.end; i++) {
+                // levels_[i] is a ROI of padded_[i], only the border is written
+                cv::copyMakeBorder(
+                    levels_[i],
+                    padded_[i],
+                    padding_,
+                    padding_,
+                    padding_,
+                    padding_,
+                    borderType_ | cv::BORDER_ISOLATED
+                );
+            }
+        });
+    }
+}
+
+}  // namespace cvd
+
+CvStatus* cv_ImagePyramid_create(
+    int levels, double scaleFactor, int padding, int borderType, ImagePyramid* rval
+) {
+    BEGIN_WRAP
+    *rval = {new cvd::ImagePyramid(levels, scaleFactor, padding, borderType)};
+    END_WRAP
+}
+
+void cv_ImagePyramid_close(ImagePyramidPtr self) {
+    CVD_FREE(self);
+}
+
+CvStatus* cv_ImagePyramid_build(ImagePyramid self, Mat src, CvCallback_0 callback) {
+    BEGIN_WRAP
+    self.ptr->build(CVDEREF(src));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_ImagePyramid_getLevels(ImagePyramid self, VecMat* rval) {
+    BEGIN_WRAP
+    CVDEREF_P(rval) = self.ptr->levels();
+    END_WRAP
+}
+
+CvStatus* cv_ImagePyramid_getLevel(ImagePyramid self, int level, Mat rval) {
+    BEGIN_WRAP
+    const auto& levels = self.ptr->levels();
+    if (level < 0 || level >= static_cast<int>(levels.size()))
+        CV_Error(cv::Error::StsOutOfRange, "level is out of range or the pyramid is not built");
+    CVDEREF(rval) = levels[level];
+    END_WRAP
+}
+
+int cv_ImagePyramid_getNumLevels(ImagePyramid self) {
+    return self.ptr->numLevels();
+}
+
+double cv_ImagePyramid_getScaleFactor(ImagePyramid self) {
+    return self.ptr->scaleFactor();
+}
+
+int cv_ImagePyramid_getPadding(ImagePyramid self) {
+    return self.ptr->padding();
+}
+
+int cv_ImagePyramid_getBorderType(ImagePyramid self) {
+    return self.ptr->borderType();
+}
+
+bool cv_ImagePyramid_empty(ImagePyramid self) {
+    return self.ptr->empty();
+}
@@ -0,0 +1,79 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_IMAGE_PYRAMID_H
+#define DARTCV_LIBRARY_IMAGE_PYRAMID_H
+
+#ifdef __cplusplus
+#include <opencv2/imgproc.hpp>
+#include <vector>
+
+namespace cvd {
+// Image pyramid built once per frame and shared by the pyramid-consuming wrappers
+// (calcOpticalFlowPyrLK, ORB, CascadeClassifier).
+//
+// Level i is scaleFactor^i times smaller than the source. With scaleFactor == 2 the levels
+// are the Gaussian pyramid of cv::pyrDown, otherwise every level is resized from the source
+// with INTER_AREA, in parallel. Each level is a ROI inside a buffer padded by `padding`
+// pixels (filled with borderType), the layout expected by cv::calcOpticalFlowPyrLK, and the
+// buffers are reused between frames of the same size.
+class ImagePyramid {
+  public:
+    ImagePyramid(int levels, double scaleFactor, int padding, int borderType);
+
+    void build(const cv::Mat& src);
+
+    const std::vector<cv::Mat>& levels() const { return levels_; }
+    int numLevels() const { return nlevels_; }
+    double scaleFactor() const { return scaleFactor_; }
+    int padding() const { return padding_; }
+    int borderType() const { return borderType_; }
+    bool empty() const { return levels_.empty(); }
+
+  private:
+    int nlevels_;
+    double scaleFactor_;
+    int padding_;
+    int borderType_;
+    std::vector<cv::Mat> padded_;
+    std::vector<cv::Mat> levels_;
+};
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+CVD_TYPEDEF(cvd::ImagePyramid, ImagePyramid);
+#else
+CVD_TYPEDEF(void, ImagePyramid);
+#endif
+
+// Creates an image pyramid of `levels` levels (including the source), each level padded by
+// `padding` pixels with borderType.
+CvStatus* cv_ImagePyramid_create(
+    int levels, double scaleFactor, int padding, int borderType, ImagePyramid* rval
+);
+void cv_ImagePyramid_close(ImagePyramidPtr self);
+
+// Builds the pyramid of src, reusing the buffers of the previous build.
+CvStatus* cv_ImagePyramid_build(ImagePyramid self, Mat src, CvCallback_0 callback);
+
+// Gets the levels, the data is shared with the pyramid.
+CvStatus* cv_ImagePyramid_getLevels(ImagePyramid self, CVD_OUT VecMat* rval);
+CvStatus* cv_ImagePyramid_getLevel(ImagePyramid self, int level, CVD_OUT Mat rval);
+
+int cv_ImagePyramid_getNumLevels(ImagePyramid self);
+double cv_ImagePyramid_getScaleFactor(ImagePyramid self);
+int cv_ImagePyramid_getPadding(ImagePyramid self);
+int cv_ImagePyramid_getBorderType(ImagePyramid self);
+bool cv_ImagePyramid_empty(ImagePyramid self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_IMAGE_PYRAMID_H
@@ -7,6 +7,7 @@
 */
 
 #include "dartcv/imgproc/imgproc.h"
+#include "dartcv/imgproc/morphology.hpp"
 #include <vector>
 
 CvStatus* cv_arcLength(VecPoint curve, bool is_closed, double* rval, CvCallback_0 callback) {
@@ -253,7 +254,7 @@ CvStatus* cv_sqrBoxFilter(
 
 CvStatus* cv_dilate(Mat src, Mat dst, Mat kernel, CvCallback_0 callback) {
     BEGIN_WRAP
-    cv::dilate(CVDEREF(src), CVDEREF(dst), CVDEREF(kernel));
+    cvd::dilate(CVDEREF(src), CVDEREF(dst), CVDEREF(kernel));
     if (callback != nullptr) {
         callback();
     }
@@ -271,7 +272,7 @@ CvStatus* cv_dilate_1(
     CvCallback_0 callback
 ) {
     BEGIN_WRAP
-    cv::dilate(
+    cvd::dilate(
         CVDEREF(src),
         CVDEREF(dst),
         CVDEREF(kernel),
@@ -307,7 +308,7 @@ CvStatus* cv_distanceTransform(
 
 CvStatus* cv_erode(Mat src, Mat dst, Mat kernel, CvCallback_0 callback) {
     BEGIN_WRAP
-    cv::erode(CVDEREF(src), CVDEREF(dst), CVDEREF(kernel));
+    cvd::erode(CVDEREF(src), CVDEREF(dst), CVDEREF(kernel));
     if (callback != nullptr) {
         callback();
     }
@@ -325,7 +326,7 @@ CvStatus* cv_erode_1(
     CvCallback_0 callback
 ) {
     BEGIN_WRAP
-    cv::erode(
+    cvd::erode(
         CVDEREF(src),
         CVDEREF(dst),
         CVDEREF(kernel),
@@ -690,7 +691,7 @@ CvStatus* cv_morphologyDefaultBorderValue(Scalar* rval, CvCallback_0 callback) {
 
 CvStatus* cv_morphologyEx(Mat src, Mat dst, int op, Mat kernel, CvCallback_0 callback) {
     BEGIN_WRAP
-    cv::morphologyEx(CVDEREF(src), CVDEREF(dst), op, CVDEREF(kernel));
+    cvd::morphologyEx(CVDEREF(src), CVDEREF(dst), op, CVDEREF(kernel));
     if (callback != nullptr) {
         callback();
     }
@@ -710,7 +711,7 @@ CvStatus* cv_morphologyEx_1(
 ) {
     BEGIN_WRAP
     auto bv = cv::Scalar(borderValue.val1, borderValue.val2, borderValue.val3, borderValue.val4);
-    cv::morphologyEx(
+    cvd::morphologyEx(
         CVDEREF(src),
         CVDEREF(dst),
         op,
@@ -1516,6 +1517,157 @@ CvStatus* cv_warpPerspective_1(
     END_WRAP
 }
 
+// Source region read by a crop of size dsize through the dst->src transform T, expanded by the
+// interpolation footprint. Falls back to the full source when the projective divisor changes
+// sign inside the crop, or when a non-constant border mode may sample outside the footprint.
+static cv::Rect warpSourceRoi(
+    const cv::Matx33d& T, cv::Size dsize, cv::Size ssize, int flags, int borderMode
+) {
+    const cv::Rect full(0, 0, ssize.width, ssize.height);
+    double minx = DBL_MAX, miny = DBL_MAX, maxx = -DBL_MAX, maxy = -DBL_MAX;
+    for (double y : {0., dsize.height - 1.}) {
+        for (double x : {0., dsize.width - 1.}) {
+            const double w = T(2, 0) * x + T(2, 1) * y + T(2, 2);
+            if (w <= DBL_EPSILON) return full;
+            const double sx = (T(0, 0) * x + T(0, 1) * y + T(0, 2)) / w;
+            const double sy = (T(1, 0) * x + T(1, 1) * y + T(1, 2)) / w;
+            minx = std::min(minx, sx);
+            miny = std::min(miny, sy);
+            maxx = std::max(maxx, sx);
+            maxy = std::max(maxy, sy);
+        }
+    }
+
+    int margin = 2;
+    switch (flags & cv::INTER_MAX) {
+    case cv::INTER_NEAREST: margin = 1; break;
+    case cv::INTER_CUBIC: margin = 3; break;
+    case cv::INTER_LANCZOS4: margin = 5; break;
+    default: break;
+    }
+    // clamp before rounding so that far away crops can not overflow int
+    const double lox = -margin - 1., loy = -margin - 1.;
+    const double hix = ssize.width + margin + 1., hiy = ssize.height + margin + 1.;
+    const int x0 = cvFloor(std::min(std::max(minx, lox), hix)) - margin;
+    const int y0 = cvFloor(std::min(std::max(miny, loy), hiy)) - margin;
+    const int x1 = cvCeil(std::min(std::max(maxx, lox), hix)) + margin + 1;
+    const int y1 = cvCeil(std::min(std::max(maxy, loy), hiy)) + margin + 1;
+    const cv::Rect roi(x0, y0, x1 - x0, y1 - y0);
+
+    if (borderMode != cv::BORDER_CONSTANT && borderMode != cv::BORDER_TRANSPARENT &&
+        (roi & full) != roi)
+        return full;
+    const cv::Rect clipped = roi & full;
+    // entirely outside, let the warp fill the border
+    return clipped.empty() ? full : clipped;
+}
+
+static void warpBatch(
+    const cv::Mat& src,
+    const std::vector<cv::Mat>& Ms,
+    const std::vector<int>& dsizes,
+    int flags,
+    int borderMode,
+    const cv::Scalar& borderValue,
+    bool perspective,
+    std::vector<cv::Mat>& dst
+) {
+    const int n = static_cast<int>(Ms.size());
+    if (dsizes.size() != 2 && dsizes.size() != Ms.size() * 2)
+        CV_Error(cv::Error::StsBadSize, "dsizes must contain 2 or 2*len(Ms) values");
+    const int mrows = perspective ? 3 : 2;
+    for (const auto& m : Ms) CV_Assert(m.rows == mrows && m.cols == 3 && m.channels() == 1);
+
+    dst.resize(n);
+    const bool inverse = (flags & cv::WARP_INVERSE_MAP) != 0;
+    cv::parallel_for_(cv::Range(0, n), [&](const cv::Range& range) {
+        for (int i = range.start; i < range.end; i++) {
+            const size_t j = dsizes.size() == 2 ? 0 : static_cast<size_t>(i) * 2;
+            const cv::Size dsize(dsizes[j], dsizes[j + 1]);
+            cv::Matx33d M = cv::Matx33d::eye();
+            cv::Mat header(mrows, 3, CV_64F, M.val);
+            Ms[i].convertTo(header, CV_64F);
+
+            const cv::Matx33d T = inverse ? M : M.inv();
+            const cv::Rect roi = warpSourceRoi(T, dsize, src.size(), flags, borderMode);
+            // move the origin of the transform to the top-left corner of the roi
+            cv::Matx33d Mroi;
+            if (inverse) {
+                const cv::Matx33d S(1, 0, -roi.x, 0, 1, -roi.y, 0, 0, 1);
+                Mroi = S * M;
+            } else {
+                const cv::Matx33d S(1, 0, roi.x, 0, 1, roi.y, 0, 0, 1);
+                Mroi = M * S;
+            }
+
+            const cv::Mat sub = src(roi);
+            if (perspective) {
+                cv::warpPerspective(
+                    sub, dst[i], cv::Mat(Mroi), dsize, flags, borderMode, borderValue
+                );
+            } else {
+                cv::warpAffine(
+                    sub, dst[i], cv::Mat(Mroi).rowRange(0, 2), dsize, flags, borderMode, borderValue
+                );
+            }
+        }
+    });
+}
+
+CvStatus* cv_warpAffineBatch(
+    Mat src,
+    VecMat Ms,
+    VecI32 dsizes,
+    int flags,
+    int borderMode,
+    Scalar borderValue,
+    VecMat* rval,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    warpBatch(
+        CVDEREF(src),
+        CVDEREF(Ms),
+        CVDEREF(dsizes),
+        flags,
+        borderMode,
+        cv::Scalar(borderValue.val1, borderValue.val2, borderValue.val3, borderValue.val4),
+        false,
+        CVDEREF_P(rval)
+    );
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_warpPerspectiveBatch(
+    Mat src,
+    VecMat Ms,
+    VecI32 dsizes,
+    int flags,
+    int borderMode,
+    Scalar borderValue,
+    VecMat* rval,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    warpBatch(
+        CVDEREF(src),
+        CVDEREF(Ms),
+        CVDEREF(dsizes),
+        flags,
+        borderMode,
+        cv::Scalar(borderValue.val1, borderValue.val2, borderValue.val3, borderValue.val4),
+        true,
+        CVDEREF_P(rval)
+    );
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
 CvStatus* cv_watershed(Mat image, Mat markers, CvCallback_0 callback) {
     BEGIN_WRAP
     cv::watershed(CVDEREF(image), CVDEREF(markers));
@@ -1930,13 +2082,13 @@ void cv_CLAHE_setTilesGridSize(CLAHE self, CvSize size) {
 
 CvStatus* cv_Subdiv2D_create(Subdiv2D* rval) {
     BEGIN_WRAP
-    *rval = {new cv::Subdiv2D()};
+    *rval = {new cvd::Subdiv2D()};
     END_WRAP
 }
 
 CvStatus* cv_Subdiv2D_create_1(CvRect rect, Subdiv2D* rval) {
     BEGIN_WRAP
-    *rval = {new cv::Subdiv2D(cv::Rect(rect.x, rect.y, rect.width, rect.height))};
+    *rval = {new cvd::Subdiv2D(cv::Rect(rect.x, rect.y, rect.width, rect.height))};
     END_WRAP
 }
 
@@ -2135,6 +2287,59 @@ CvStatus* cv_Subdiv2D_symEdge(Subdiv2D self, int edge, int* rval, CvCallback_0 c
     END_WRAP
 }
 
+CvStatus* cv_Subdiv2D_insertBulk(Subdiv2D self, VecF32 xy, VecI32* rval, CvCallback_0 callback) {
+    BEGIN_WRAP
+    const auto& _xy = CVDEREF(xy);
+    if (_xy.size() % 2 != 0) CV_Error(cv::Error::StsBadArg, "xy must have an even length");
+    self.ptr->insertBulk(_xy.data(), _xy.size() / 2, CVDEREF_P(rval));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_Subdiv2D_getTriangleIndices(Subdiv2D self, VecI32* rval, CvCallback_0 callback) {
+    BEGIN_WRAP
+    self.ptr->getTriangleIndices(CVDEREF_P(rval));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_Subdiv2D_getVoronoiFacetListFlat(
+    Subdiv2D self,
+    VecI32 idx,
+    VecF32* facets,
+    VecI32* offsets,
+    VecF32* centers,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    self.ptr->getVoronoiFacetsFlat(
+        CVDEREF(idx), CVDEREF_P(facets), CVDEREF_P(offsets), CVDEREF_P(centers)
+    );
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_Subdiv2D_movePoints(
+    Subdiv2D self, VecI32 vertices, VecF32 xy, bool* rval, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    const auto& _vertices = CVDEREF(vertices);
+    const auto& _xy = CVDEREF(xy);
+    if (_xy.size() != _vertices.size() * 2)
+        CV_Error(cv::Error::StsBadArg, "xy must have 2 values per vertex");
+    *rval = self.ptr->movePoints(_vertices, _xy.data());
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
 CvStatus* cv_invertAffineTransform(Mat src, Mat dst, CvCallback_0 callback) {
     BEGIN_WRAP
     cv::invertAffineTransform(CVDEREF(src), CVDEREF(dst));
@@ -14,12 +14,13 @@
 
 #ifdef __cplusplus
 #include <opencv2/imgproc.hpp>
+#include "dartcv/imgproc/subdiv2d.h"
 extern "C" {
 #endif
 
 #ifdef __cplusplus
 CVD_TYPEDEF(cv::Ptr<cv::CLAHE>, CLAHE);
-CVD_TYPEDEF(cv::Subdiv2D, Subdiv2D);
+CVD_TYPEDEF(cvd::Subdiv2D, Subdiv2D);
 CVD_TYPEDEF(cv::Ptr<cv::LineSegmentDetector>, LineSegmentDetector);
 #else
 CVD_TYPEDEF(void, CLAHE);
@@ -328,6 +329,31 @@ CvStatus* cv_warpPerspective_1(
     CvCallback_0 callback
 );
 
+// Applies a batch of affine (2x3) or perspective (3x3) transformations to one source image,
+// the i-th output is warpAffine/warpPerspective(src, Ms[i], dsize_i), crops run in parallel
+// and each one only reads the source region its transform maps to.
+// dsizes is flattened as [w0, h0, w1, h1, ...], or [w, h] to share one size for all crops.
+CvStatus* cv_warpAffineBatch(
+    Mat src,
+    VecMat Ms,
+    VecI32 dsizes,
+    int flags,
+    int borderMode,
+    Scalar borderValue,
+    CVD_OUT VecMat* rval,
+    CvCallback_0 callback
+);
+CvStatus* cv_warpPerspectiveBatch(
+    Mat src,
+    VecMat Ms,
+    VecI32 dsizes,
+    int flags,
+    int borderMode,
+    Scalar borderValue,
+    CVD_OUT VecMat* rval,
+    CvCallback_0 callback
+);
+
 // TODO
 // Remaps an image to polar or semilog-polar coordinates space.
 // void cv::warpPolar (InputArray src, OutputArray dst, CvSize dsize, CvPoint2f center, double maxRadius, int flags)
@@ -656,6 +682,19 @@ CvStatus* cv_Subdiv2D_rotateEdge(
     Subdiv2D self, int edge, int rotate, int* rval, CvCallback_0 callback
 );
 CvStatus* cv_Subdiv2D_symEdge(Subdiv2D self, int edge, int* rval, CvCallback_0 callback);
+CvStatus* cv_Subdiv2D_insertBulk(Subdiv2D self, VecF32 xy, VecI32* rval, CvCallback_0 callback);
+CvStatus* cv_Subdiv2D_getTriangleIndices(Subdiv2D self, VecI32* rval, CvCallback_0 callback);
+CvStatus* cv_Subdiv2D_getVoronoiFacetListFlat(
+    Subdiv2D self,
+    VecI32 idx,
+    VecF32* facets,
+    VecI32* offsets,
+    VecF32* centers,
+    CvCallback_0 callback
+);
+CvStatus* cv_Subdiv2D_movePoints(
+    Subdiv2D self, VecI32 vertices, VecF32 xy, bool* rval, CvCallback_0 callback
+);
 
 // SECTION - Histograms
 // Calculates the back projection of a histogram.
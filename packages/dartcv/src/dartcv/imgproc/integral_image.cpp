@@ -0,0 +1,226 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/imgproc/integral_image.h"
+
+namespace cvd {
+
+void IntegralImage::compute(const cv::Mat& src) {
+    CV_Assert(!src.empty() && src.channels() <= 4);
+    if (withTilted_) {
+        cv::integral(src, sum_, sqsum_, tilted_, CV_64F, CV_64F);
+    } else {
+        cv::integral(src, sum_, sqsum_, CV_64F, CV_64F);
+        tilted_.release();
+    }
+}
+
+// a + d - b - c of the four corners of a box in an integral image, per channel
+static inline void boxSum(
+    const cv::Mat& I, int x0, int y0, int x1, int y1, int cn, double* out
+) {
+    const double* r0 = I.ptr<double>(y0);
+    const double* r1 = I.ptr<double>(y1);
+    for (int c = 0; c < cn; c++)
+        out[c] = r1[x1 * cn + c] - r1[x0 * cn + c] - r0[x1 * cn + c] + r0[x0 * cn + c];
+}
+
+void IntegralImage::query(const std::vector<cv::Rect>& rects, int op, std::vector<double>& out)
+    const {
+    if (empty()) CV_Error(cv::Error::StsError, "IntegralImage is empty, call compute first");
+    CV_Assert(op == SUM || op == MEAN || op == VARIANCE);
+    const cv::Size sz = size();
+    for (const auto& r : rects) {
+        if (r.x < 0 || r.y < 0 || r.width < 0 || r.height < 0 || r.x + r.width > sz.width ||
+            r.y + r.height > sz.height)
+            CV_Error(cv::Error::StsOutOfRange, "rect is out of the image");
+        if (op != SUM && r.area() == 0) CV_Error(cv::Error::StsBadArg, "rect is empty");
+    }
+
+    const int cn = channels();
+    out.resize(rects.size() * cn);
+    cv::parallel_for_(cv::Range(0, static_cast<int>(rects.size())), [&](const cv::Range& range) {
+        double sq[4];
+        for (int i = range.start; i < range.end; i++) {
+            const cv::Rect& r = rects[i];
+            double* o = out.data() + static_cast<size_t>(i) * cn;
+            boxSum(sum_, r.x, r.y, r.x + r.width, r.y + r.height, cn, o);
+            if (op == SUM) continue;
+            const double inv = 1. / r.area();
+            for (int c = 0; c < cn; c++) o[c] *= inv;
+            if (op == MEAN) continue;
+            boxSum(sqsum_, r.x, r.y, r.x + r.width, r.y + r.height, cn, sq);
+            for (int c = 0; c < cn; c++) o[c] = std::max(sq[c] * inv - o[c] * o[c], 0.);
+        }
+    });
+}
+
+void IntegralImage::tiltedSum(const std::vector<cv::Rect>& rects, std::vector<double>& out)
+    const {
+    if (empty()) CV_Error(cv::Error::StsError, "IntegralImage is empty, call compute first");
+    if (tilted_.empty()) CV_Error(cv::Error::StsError, "tilted integral is not computed");
+    const cv::Size sz = size();
+    for (const auto& r : rects) {
+        if (r.width < 0 || r.height < 0 || r.y < 0 || r.x - r.height < 0 || r.x + r.width > sz.width ||
+            r.y + r.width + r.height > sz.height)
+            CV_Error(cv::Error::StsOutOfRange, "tilted rect is out of the image");
+    }
+
+    const int cn = channels();
+    out.resize(rects.size() * cn);
+    cv::parallel_for_(cv::Range(0, static_cast<int>(rects.size())), [&](const cv::Range& range) {
+        for (int i = range.start; i < range.end; i++) {
+            const cv::Rect& r = rects[i];
+            // same corners as the tilted haar features
+            const double* p0 = tilted_.ptr<double>(r.y) + r.x * cn;
+            const double* p1 = tilted_.ptr<double>(r.y + r.height) + (r.x - r.height) * cn;
+            const double* p2 = tilted_.ptr<double>(r.y + r.width) + (r.x + r.width) * cn;
+            const double* p3 =
+                tilted_.ptr<double>(r.y + r.width + r.height) + (r.x + r.width - r.height) * cn;
+            double* o = out.data() + static_cast<size_t>(i) * cn;
+            for (int c = 0; c < cn; c++) o[c] = p0[c] - p1[c] - p2[c] + p3[c];
+        }
+    });
+}
+
+void IntegralImage::windows(cv::Size ksize, int op, cv::Mat& dst) const {
+    if (empty()) CV_Error(cv::Error::StsError, "IntegralImage is empty, call compute first");
+    CV_Assert(op == SUM || op == MEAN || op == VARIANCE);
+    const cv::Size sz = size();
+    CV_Assert(ksize.width > 0 && ksize.height > 0);
+    CV_Assert(ksize.width <= sz.width && ksize.height <= sz.height);
+
+    // every window sum is a combination of four shifted views of the integral,
+    // so the whole map is computed with vectorized full-row arithmetic
+    const cv::Size osz(sz.width - ksize.width + 1, sz.height - ksize.height + 1);
+    auto dense = [&](const cv::Mat& I, cv::Mat& out) {
+        const cv::Mat a = I(cv::Rect(0, 0, osz.width, osz.height));
+        const cv::Mat b = I(cv::Rect(ksize.width, 0, osz.width, osz.height));
+        const cv::Mat c = I(cv::Rect(0, ksize.height, osz.width, osz.height));
+        const cv::Mat d = I(cv::Rect(ksize.width, ksize.height, osz.width, osz.height));
+        cv::Mat tmp;
+        cv::subtract(d, b, out);
+        cv::subtract(c, a, tmp);
+        cv::subtract(out, tmp, out);
+    };
+
+    if (op == SUM) {
+        dense(sum_, dst);
+        return;
+    }
+    const double inv = 1. / ksize.area();
+    cv::Mat mean;
+    dense(sum_, mean);
+    mean *= inv;
+    if (op == MEAN) {
+        dst = mean;
+        return;
+    }
+    cv::Mat sq;
+    dense(sqsum_, sq);
+    cv::Mat var = sq * inv - mean.mul(mean);
+    dst = cv::max(var, 0.);
+}
+
+}  // namespace cvd
+
+CvStatus* cv_IntegralImage_create(bool tilted, IntegralImage* rval) {
+    BEGIN_WRAP
+    *rval = {new cvd::IntegralImage(tilted)};
+    END_WRAP
+}
+
+void cv_IntegralImage_close(IntegralImagePtr self) {
+    CVD_FREE(self);
+}
+
+CvStatus* cv_IntegralImage_compute(IntegralImage self, Mat src, CvCallback_0 callback) {
+    BEGIN_WRAP
+    self.ptr->compute(CVDEREF(src));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_IntegralImage_sum(
+    IntegralImage self, VecRect rects, VecF64* rval, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    self.ptr->query(CVDEREF(rects), cvd::IntegralImage::SUM, CVDEREF_P(rval));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_IntegralImage_mean(
+    IntegralImage self, VecRect rects, VecF64* rval, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    self.ptr->query(CVDEREF(rects), cvd::IntegralImage::MEAN, CVDEREF_P(rval));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_IntegralImage_variance(
+    IntegralImage self, VecRect rects, VecF64* rval, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    self.ptr->query(CVDEREF(rects), cvd::IntegralImage::VARIANCE, CVDEREF_P(rval));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_IntegralImage_tiltedSum(
+    IntegralImage self, VecRect rects, VecF64* rval, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    self.ptr->tiltedSum(CVDEREF(rects), CVDEREF_P(rval));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_IntegralImage_windows(
+    IntegralImage self, CvSize ksize, int op, Mat dst, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    self.ptr->windows(cv::Size(ksize.width, ksize.height), op, CVDEREF(dst));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_IntegralImage_getSum(IntegralImage self, Mat rval) {
+    BEGIN_WRAP
+    CVDEREF(rval) = self.ptr->sum();
+    END_WRAP
+}
+
+CvStatus* cv_IntegralImage_getSqsum(IntegralImage self, Mat rval) {
+    BEGIN_WRAP
+    CVDEREF(rval) = self.ptr->sqsum();
+    END_WRAP
+}
+
+CvStatus* cv_IntegralImage_getTilted(IntegralImage self, Mat rval) {
+    BEGIN_WRAP
+    CVDEREF(rval) = self.ptr->tilted();
+    END_WRAP
+}
+
+bool cv_IntegralImage_empty(IntegralImage self) {
+    return self.ptr->empty();
+}
+
+int cv_IntegralImage_channels(IntegralImage self) {
+    return self.ptr->channels();
+}
@@ -0,0 +1,96 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_INTEGRAL_IMAGE_H
+#define DARTCV_LIBRARY_INTEGRAL_IMAGE_H
+
+#ifdef __cplusplus
+#include <opencv2/imgproc.hpp>
+#include <vector>
+
+namespace cvd {
+// Owns the integral, squared integral and (optionally) tilted integral of an image and
+// answers batches of box queries without going back to the caller for every box.
+// All integrals are CV_64F so that sums of large 8-bit or float images stay exact.
+class IntegralImage {
+  public:
+    enum Op { SUM = 0, MEAN = 1, VARIANCE = 2 };
+
+    explicit IntegralImage(bool tilted) : withTilted_(tilted) {}
+
+    // recomputes the integrals of src, buffers are reused if the size does not change
+    void compute(const cv::Mat& src);
+
+    // results are stored as [rect0_ch0, rect0_ch1, ..., rect1_ch0, ...]
+    void query(const std::vector<cv::Rect>& rects, int op, std::vector<double>& out) const;
+    // sum of 45 degree rotated rectangles, (x, y) is the top corner, width and height
+    // are the lengths along the two diagonals, the same as the Haar tilted features
+    void tiltedSum(const std::vector<cv::Rect>& rects, std::vector<double>& out) const;
+    // op of every ksize window with stride 1, dst is (W-kw+1)x(H-kh+1) CV_64FC(cn)
+    void windows(cv::Size ksize, int op, cv::Mat& dst) const;
+
+    bool empty() const { return sum_.empty(); }
+    int channels() const { return sum_.channels(); }
+    cv::Size size() const { return empty() ? cv::Size() : cv::Size(sum_.cols - 1, sum_.rows - 1); }
+    const cv::Mat& sum() const { return sum_; }
+    const cv::Mat& sqsum() const { return sqsum_; }
+    const cv::Mat& tilted() const { return tilted_; }
+    // fixed at construction, so tilted() always matches it after compute
+    bool withTilted() const { return withTilted_; }
+
+  private:
+    const bool withTilted_;
+    cv::Mat sum_, sqsum_, tilted_;
+};
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+CVD_TYPEDEF(cvd::IntegralImage, IntegralImage);
+#else
+CVD_TYPEDEF(void, IntegralImage);
+#endif
+
+// Creates an integral image query engine, tilted integral is only computed if tilted is true.
+CvStatus* cv_IntegralImage_create(bool tilted, IntegralImage* rval);
+void cv_IntegralImage_close(IntegralImagePtr self);
+
+// Computes the integrals of src.
+// void cv::integral (InputArray src, OutputArray sum, OutputArray sqsum, OutputArray tilted, int sdepth=-1, int sqdepth=-1)
+CvStatus* cv_IntegralImage_compute(IntegralImage self, Mat src, CvCallback_0 callback);
+
+// Batch queries, rval holds channels() values per rect.
+CvStatus* cv_IntegralImage_sum(
+    IntegralImage self, VecRect rects, CVD_OUT VecF64* rval, CvCallback_0 callback
+);
+CvStatus* cv_IntegralImage_mean(
+    IntegralImage self, VecRect rects, CVD_OUT VecF64* rval, CvCallback_0 callback
+);
+CvStatus* cv_IntegralImage_variance(
+    IntegralImage self, VecRect rects, CVD_OUT VecF64* rval, CvCallback_0 callback
+);
+CvStatus* cv_IntegralImage_tiltedSum(
+    IntegralImage self, VecRect rects, CVD_OUT VecF64* rval, CvCallback_0 callback
+);
+
+// Dense sum/mean/variance (op = 0/1/2) of every window of size ksize.
+CvStatus* cv_IntegralImage_windows(
+    IntegralImage self, CvSize ksize, int op, CVD_OUT Mat dst, CvCallback_0 callback
+);
+
+CvStatus* cv_IntegralImage_getSum(IntegralImage self, CVD_OUT Mat rval);
+CvStatus* cv_IntegralImage_getSqsum(IntegralImage self, CVD_OUT Mat rval);
+CvStatus* cv_IntegralImage_getTilted(IntegralImage self, CVD_OUT Mat rval);
+bool cv_IntegralImage_empty(IntegralImage self);
+int cv_IntegralImage_channels(IntegralImage self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_INTEGRAL_IMAGE_H
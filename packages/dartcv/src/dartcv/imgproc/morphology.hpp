@@ -0,0 +1,239 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_MORPHOLOGY_HPP
+#define DARTCV_LIBRARY_MORPHOLOGY_HPP
+
+#include <cfloat>
+#include <cstring>
+#include <opencv2/core/hal/hal.hpp>
+#include <opencv2/imgproc.hpp>
+
+namespace cvd {
+
+// Erosion/dilation with full rectangular (or horizontal/vertical line) kernels of at least this
+// size use the van Herk/Gil-Werman running min/max, which costs 3 comparisons per pixel and
+// direction regardless of the kernel size. Smaller or arbitrary kernels use OpenCV.
+static const int kMorphVHGWMinSize = 15;
+
+// dst[i] = max/min(a[i], b[i]), vectorized by cv::hal
+static inline void morphRowOp(bool isMax, int depth, const uchar* a, const uchar* b, uchar* dst, int len) {
+#define CVD_MORPH_ROW_OP(DEPTH, T, SUFFIX)                                                                   \
+    case DEPTH:                                                                                              \
+        if (isMax)                                                                                           \
+            cv::hal::max##SUFFIX((const T*)a, 0, (const T*)b, 0, (T*)dst, 0, len, 1, nullptr);               \
+        else                                                                                                 \
+            cv::hal::min##SUFFIX((const T*)a, 0, (const T*)b, 0, (T*)dst, 0, len, 1, nullptr);               \
+        break;
+
+    switch (depth) {
+        CVD_MORPH_ROW_OP(CV_8U, uchar, 8u)
+        CVD_MORPH_ROW_OP(CV_8S, schar, 8s)
+        CVD_MORPH_ROW_OP(CV_16U, ushort, 16u)
+        CVD_MORPH_ROW_OP(CV_16S, short, 16s)
+        CVD_MORPH_ROW_OP(CV_32S, int, 32s)
+        CVD_MORPH_ROW_OP(CV_32F, float, 32f)
+        CVD_MORPH_ROW_OP(CV_64F, double, 64f)
+    default: CV_Error(cv::Error::StsUnsupportedFormat, "unsupported depth");
+    }
+#undef CVD_MORPH_ROW_OP
+}
+
+// Running max/min over every k consecutive rows of P (P.rows = out.rows + k - 1).
+// van Herk/Gil-Werman: P is split into blocks of k rows, g is the forward scan and h the
+// backward scan inside each block, then out[y] = op(h[y], g[y + k - 1]).
+// Columns are split into strips that are processed in parallel.
+static void morphVHGWColumns(const cv::Mat& P, int k, bool isMax, cv::Mat& out) {
+    const int n = P.rows;
+    out.create(n - k + 1, P.cols, P.type());
+    const int depth = P.depth();
+    const size_t esz = P.elemSize1();
+    const int len = P.cols * P.channels();
+    const int nstrips = std::max(1, std::min(cv::getNumThreads(), len / 64));
+    cv::parallel_for_(cv::Range(0, nstrips), [&](const cv::Range& range) {
+        for (int s = range.start; s < range.end; s++) {
+            const int x0 = static_cast<int>(static_cast<int64_t>(len) * s / nstrips);
+            const int x1 = static_cast<int>(static_cast<int64_t>(len) * (s + 1) / nstrips);
+            const int w = x1 - x0;
+            cv::Mat g(n, w, CV_MAKETYPE(depth, 1)), h(n, w, CV_MAKETYPE(depth, 1));
+            for (int y = 0; y < n; y++) {
+                const uchar* p = P.ptr(y) + x0 * esz;
+                if (y % k == 0)
+                    std::memcpy(g.ptr(y), p, w * esz);
+                else
+                    morphRowOp(isMax, depth, g.ptr(y - 1), p, g.ptr(y), w);
+            }
+            for (int y = n - 1; y >= 0; y--) {
+                const uchar* p = P.ptr(y) + x0 * esz;
+                if (y % k == k - 1 || y == n - 1)
+                    std::memcpy(h.ptr(y), p, w * esz);
+                else
+                    morphRowOp(isMax, depth, h.ptr(y + 1), p, h.ptr(y), w);
+            }
+            for (int y = 0; y < out.rows; y++)
+                morphRowOp(isMax, depth, h.ptr(y), g.ptr(y + k - 1), out.ptr(y) + x0 * esz, w);
+        }
+    });
+}
+
+// Whether cv::erode/cv::dilate of src with kernel should take the van Herk/Gil-Werman path,
+// ksize and anchor are the effective kernel size and anchor after folding the iterations
+// (n iterations of a rectangle equal one rectangle, the same as OpenCV does).
+static bool morphUseVHGW(
+    const cv::Mat& src,
+    const cv::Mat& kernel,
+    cv::Point anchor,
+    int iterations,
+    cv::Size& ksize,
+    cv::Point& kanchor
+) {
+    if (src.empty() || src.dims > 2 || src.depth() > CV_64F || src.channels() > 4) return false;
+    if (kernel.empty() || kernel.channels() != 1 || iterations < 1) return false;
+    if (cv::countNonZero(kernel) != kernel.rows * kernel.cols) return false;
+    ksize = kernel.size();
+    if (anchor.x == -1) anchor.x = ksize.width / 2;
+    if (anchor.y == -1) anchor.y = ksize.height / 2;
+    if (!cv::Rect(0, 0, ksize.width, ksize.height).contains(anchor)) return false;
+    if (iterations > 1) {
+        anchor = cv::Point(anchor.x * iterations, anchor.y * iterations);
+        ksize = cv::Size(
+            ksize.width + (iterations - 1) * (ksize.width - 1),
+            ksize.height + (iterations - 1) * (ksize.height - 1)
+        );
+    }
+    kanchor = anchor;
+    return std::max(ksize.width, ksize.height) >= kMorphVHGWMinSize;
+}
+
+// Separable running max (dilate) or min (erode) over a ksize box, see morphUseVHGW.
+static void morphVHGW(
+    bool isMax,
+    const cv::Mat& src,
+    cv::Mat& dst,
+    cv::Size ksize,
+    cv::Point anchor,
+    int borderType,
+    const cv::Scalar& borderValue
+) {
+    cv::Scalar bv = borderValue;
+    // the default value means the border never wins, the same as cv::erode/cv::dilate
+    if (bv == cv::morphologyDefaultBorderValue()) bv = cv::Scalar::all(isMax ? -DBL_MAX : DBL_MAX);
+    cv::Mat padded;
+    cv::copyMakeBorder(
+        src,
+        padded,
+        anchor.y,
+        ksize.height - 1 - anchor.y,
+        anchor.x,
+        ksize.width - 1 - anchor.x,
+        borderType,
+        bv
+    );
+
+    // rows are handled as the columns of the transposed image, so both passes are
+    // full-width vector operations
+    cv::Mat rows = padded;
+    if (ksize.width > 1) {
+        cv::Mat t, r;
+        cv::transpose(padded, t);
+        morphVHGWColumns(t, ksize.width, isMax, r);
+        cv::transpose(r, rows);
+    }
+    if (ksize.height > 1)
+        morphVHGWColumns(rows, ksize.height, isMax, dst);
+    else
+        rows.copyTo(dst);
+}
+
+static void erode(
+    const cv::Mat& src,
+    cv::Mat& dst,
+    const cv::Mat& kernel,
+    cv::Point anchor = cv::Point(-1, -1),
+    int iterations = 1,
+    int borderType = cv::BORDER_CONSTANT,
+    const cv::Scalar& borderValue = cv::morphologyDefaultBorderValue()
+) {
+    cv::Size ksize;
+    cv::Point kanchor;
+    if (morphUseVHGW(src, kernel, anchor, iterations, ksize, kanchor))
+        morphVHGW(false, src, dst, ksize, kanchor, borderType, borderValue);
+    else
+        cv::erode(src, dst, kernel, anchor, iterations, borderType, borderValue);
+}
+
+static void dilate(
+    const cv::Mat& src,
+    cv::Mat& dst,
+    const cv::Mat& kernel,
+    cv::Point anchor = cv::Point(-1, -1),
+    int iterations = 1,
+    int borderType = cv::BORDER_CONSTANT,
+    const cv::Scalar& borderValue = cv::morphologyDefaultBorderValue()
+) {
+    cv::Size ksize;
+    cv::Point kanchor;
+    if (morphUseVHGW(src, kernel, anchor, iterations, ksize, kanchor))
+        morphVHGW(true, src, dst, ksize, kanchor, borderType, borderValue);
+    else
+        cv::dilate(src, dst, kernel, anchor, iterations, borderType, borderValue);
+}
+
+static void morphologyEx(
+    const cv::Mat& src,
+    cv::Mat& dst,
+    int op,
+    const cv::Mat& kernel,
+    cv::Point anchor = cv::Point(-1, -1),
+    int iterations = 1,
+    int borderType = cv::BORDER_CONSTANT,
+    const cv::Scalar& borderValue = cv::morphologyDefaultBorderValue()
+) {
+    cv::Size ksize;
+    cv::Point kanchor;
+    if (op == cv::MORPH_HITMISS || !morphUseVHGW(src, kernel, anchor, iterations, ksize, kanchor)) {
+        cv::morphologyEx(src, dst, op, kernel, anchor, iterations, borderType, borderValue);
+        return;
+    }
+    // the same compositions as cv::morphologyEx
+    cv::Mat tmp;
+    switch (op) {
+    case cv::MORPH_ERODE: morphVHGW(false, src, dst, ksize, kanchor, borderType, borderValue); break;
+    case cv::MORPH_DILATE: morphVHGW(true, src, dst, ksize, kanchor, borderType, borderValue); break;
+    case cv::MORPH_OPEN:
+        morphVHGW(false, src, tmp, ksize, kanchor, borderType, borderValue);
+        morphVHGW(true, tmp, dst, ksize, kanchor, borderType, borderValue);
+        break;
+    case cv::MORPH_CLOSE:
+        morphVHGW(true, src, tmp, ksize, kanchor, borderType, borderValue);
+        morphVHGW(false, tmp, dst, ksize, kanchor, borderType, borderValue);
+        break;
+    case cv::MORPH_GRADIENT: {
+        cv::Mat eroded;
+        morphVHGW(false, src, eroded, ksize, kanchor, borderType, borderValue);
+        morphVHGW(true, src, tmp, ksize, kanchor, borderType, borderValue);
+        cv::subtract(tmp, eroded, dst);
+        break;
+    }
+    case cv::MORPH_TOPHAT: {
+        cv::Mat opened;
+        morphVHGW(false, src, tmp, ksize, kanchor, borderType, borderValue);
+        morphVHGW(true, tmp, opened, ksize, kanchor, borderType, borderValue);
+        cv::subtract(src, opened, dst);
+        break;
+    }
+    case cv::MORPH_BLACKHAT: {
+        cv::Mat closed;
+        morphVHGW(true, src, tmp, ksize, kanchor, borderType, borderValue);
+        morphVHGW(false, tmp, closed, ksize, kanchor, borderType, borderValue);
+        cv::subtract(closed, src, dst);
+        break;
+    }
+    default: cv::morphologyEx(src, dst, op, kernel, anchor, iterations, borderType, borderValue);
+    }
+}
+
+}  // namespace cvd
+
+#endif  // DARTCV_LIBRARY_MORPHOLOGY_HPP
@@ -0,0 +1,168 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/imgproc/sliding_histogram.h"
+
+namespace cvd {
+
+SlidingHistogram::SlidingHistogram(
+    const std::vector<int>& channels,
+    const std::vector<int>& histSize,
+    const std::vector<float>& ranges,
+    int window,
+    cv::Size grid
+) :
+    channels_(channels), histSize_(histSize), ranges_(ranges), window_(window), grid_(grid) {
+    CV_Assert(!channels.empty() && channels.size() == histSize.size());
+    CV_Assert(ranges.size() == histSize.size() * 2);
+    CV_Assert(window > 0 && grid.width > 0 && grid.height > 0);
+    sums_.resize(grid.area());
+}
+
+void SlidingHistogram::push(const cv::Mat& frame, const cv::Mat& mask) {
+    CV_Assert(!frame.empty());
+    CV_Assert(mask.empty() || (mask.size() == frame.size() && mask.type() == CV_8UC1));
+    CV_Assert(frame.cols >= grid_.width && frame.rows >= grid_.height);
+
+    const int ncells = grid_.area();
+    std::vector<cv::Mat> cells(ncells);
+    cv::parallel_for_(cv::Range(0, ncells), [&](const cv::Range& range) {
+        for (int i = range.start; i < range.end; i++) {
+            const int gx = i % grid_.width, gy = i / grid_.width;
+            const int x0 = gx * frame.cols / grid_.width, x1 = (gx + 1) * frame.cols / grid_.width;
+            const int y0 = gy * frame.rows / grid_.height, y1 = (gy + 1) * frame.rows / grid_.height;
+            const cv::Rect roi(x0, y0, x1 - x0, y1 - y0);
+            std::vector<cv::Mat> images{frame(roi)};
+            cv::calcHist(
+                images, channels_, mask.empty() ? cv::Mat() : mask(roi), cells[i], histSize_, ranges_
+            );
+        }
+    });
+
+    for (int i = 0; i < ncells; i++) {
+        if (sums_[i].empty()) {
+            cells[i].convertTo(sums_[i], CV_64F);
+        } else {
+            cv::Mat h64;
+            cells[i].convertTo(h64, CV_64F);
+            sums_[i] += h64;
+        }
+    }
+    frames_.push_back(std::move(cells));
+
+    if (static_cast<int>(frames_.size()) > window_) {
+        const auto& evicted = frames_.front();
+        for (int i = 0; i < ncells; i++) {
+            cv::Mat h64;
+            evicted[i].convertTo(h64, CV_64F);
+            sums_[i] -= h64;
+        }
+        frames_.pop_front();
+    }
+}
+
+void SlidingHistogram::reset() {
+    frames_.clear();
+    for (auto& s : sums_) s.release();
+}
+
+void SlidingHistogram::hist(int cell, cv::Mat& dst) const {
+    if (frames_.empty()) CV_Error(cv::Error::StsError, "SlidingHistogram is empty");
+    if (cell >= static_cast<int>(sums_.size()))
+        CV_Error(cv::Error::StsOutOfRange, "cell index out of range");
+    if (cell >= 0) {
+        sums_[cell].convertTo(dst, CV_32F);
+        return;
+    }
+    cv::Mat total = sums_[0].clone();
+    for (size_t i = 1; i < sums_.size(); i++) total += sums_[i];
+    total.convertTo(dst, CV_32F);
+}
+
+void SlidingHistogram::compare(
+    const cv::Mat& reference, int method, std::vector<double>& scores
+) const {
+    if (frames_.empty()) CV_Error(cv::Error::StsError, "SlidingHistogram is empty");
+    cv::Mat ref32;
+    reference.convertTo(ref32, CV_32F);
+    scores.resize(sums_.size());
+    cv::parallel_for_(cv::Range(0, static_cast<int>(sums_.size())), [&](const cv::Range& range) {
+        for (int i = range.start; i < range.end; i++) {
+            cv::Mat h;
+            sums_[i].convertTo(h, CV_32F);
+            scores[i] = cv::compareHist(h, ref32, method);
+        }
+    });
+}
+
+}  // namespace cvd
+
+CvStatus* cv_SlidingHistogram_create(
+    VecI32 channels,
+    VecI32 histSize,
+    VecF32 ranges,
+    int window,
+    int gridCols,
+    int gridRows,
+    SlidingHistogram* rval
+) {
+    BEGIN_WRAP
+    *rval = {new cvd::SlidingHistogram(
+        CVDEREF(channels), CVDEREF(histSize), CVDEREF(ranges), window, cv::Size(gridCols, gridRows)
+    )};
+    END_WRAP
+}
+
+void cv_SlidingHistogram_close(SlidingHistogramPtr self) {
+    CVD_FREE(self);
+}
+
+CvStatus* cv_SlidingHistogram_push(
+    SlidingHistogram self, Mat frame, Mat mask, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    self.ptr->push(CVDEREF(frame), CVDEREF(mask));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_SlidingHistogram_getHist(
+    SlidingHistogram self, int cell, Mat dst, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    self.ptr->hist(cell, CVDEREF(dst));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+CvStatus* cv_SlidingHistogram_compare(
+    SlidingHistogram self, Mat reference, int method, VecF64* rval, CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    self.ptr->compare(CVDEREF(reference), method, CVDEREF_P(rval));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+void cv_SlidingHistogram_reset(SlidingHistogram self) {
+    self.ptr->reset();
+}
+
+int cv_SlidingHistogram_getWindow(SlidingHistogram self) {
+    return self.ptr->window();
+}
+
+int cv_SlidingHistogram_getCount(SlidingHistogram self) {
+    return self.ptr->count();
+}
+
+int cv_SlidingHistogram_getNumCells(SlidingHistogram self) {
+    return self.ptr->grid().area();
+}
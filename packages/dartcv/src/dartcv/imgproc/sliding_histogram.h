@@ -0,0 +1,102 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_SLIDING_HISTOGRAM_H
+#define DARTCV_LIBRARY_SLIDING_HISTOGRAM_H
+
+#ifdef __cplusplus
+#include <deque>
+#include <opencv2/imgproc.hpp>
+#include <vector>
+
+namespace cvd {
+// Running histogram of the last `window` frames. Each pushed frame is split into a
+// gridCols x gridRows grid and one histogram per cell is computed, the running sums are
+// updated by adding the new cell histograms and subtracting those of the evicted frame,
+// so old frames are never scanned again.
+class SlidingHistogram {
+  public:
+    SlidingHistogram(
+        const std::vector<int>& channels,
+        const std::vector<int>& histSize,
+        const std::vector<float>& ranges,
+        int window,
+        cv::Size grid
+    );
+
+    void push(const cv::Mat& frame, const cv::Mat& mask);
+    void reset();
+
+    // cell < 0 returns the histogram of the whole frame (sum of all cells), CV_32F
+    void hist(int cell, cv::Mat& dst) const;
+    // one score per cell, comparing reference with the running histogram of each cell
+    void compare(const cv::Mat& reference, int method, std::vector<double>& scores) const;
+
+    int window() const { return window_; }
+    int count() const { return static_cast<int>(frames_.size()); }
+    cv::Size grid() const { return grid_; }
+
+  private:
+    std::vector<int> channels_, histSize_;
+    std::vector<float> ranges_;
+    int window_;
+    cv::Size grid_;
+    // per frame, per cell histograms (CV_32F, as produced by calcHist)
+    std::deque<std::vector<cv::Mat>> frames_;
+    // per cell running sums, CV_64F so that add/subtract never drifts
+    std::vector<cv::Mat> sums_;
+};
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+CVD_TYPEDEF(cvd::SlidingHistogram, SlidingHistogram);
+#else
+CVD_TYPEDEF(void, SlidingHistogram);
+#endif
+
+// Creates a sliding-window histogram of the last `window` frames, channels, histSize and
+// ranges are the same as cv::calcHist, each frame is divided into gridCols x gridRows cells.
+CvStatus* cv_SlidingHistogram_create(
+    VecI32 channels,
+    VecI32 histSize,
+    VecF32 ranges,
+    int window,
+    int gridCols,
+    int gridRows,
+    SlidingHistogram* rval
+);
+void cv_SlidingHistogram_close(SlidingHistogramPtr self);
+
+// Adds the histograms of frame (optionally masked), evicting the oldest frame when the window
+// is full. mask may be empty.
+CvStatus* cv_SlidingHistogram_push(
+    SlidingHistogram self, Mat frame, Mat mask, CvCallback_0 callback
+);
+
+// Gets the running histogram of a cell, or of the whole frame if cell < 0.
+CvStatus* cv_SlidingHistogram_getHist(
+    SlidingHistogram self, int cell, CVD_OUT Mat dst, CvCallback_0 callback
+);
+
+// Compares reference with the running histogram of every cell, see cv::compareHist.
+// double cv::compareHist (InputArray H1, InputArray H2, int method)
+CvStatus* cv_SlidingHistogram_compare(
+    SlidingHistogram self, Mat reference, int method, CVD_OUT VecF64* rval, CvCallback_0 callback
+);
+
+void cv_SlidingHistogram_reset(SlidingHistogram self);
+int cv_SlidingHistogram_getWindow(SlidingHistogram self);
+int cv_SlidingHistogram_getCount(SlidingHistogram self);
+int cv_SlidingHistogram_getNumCells(SlidingHistogram self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_SLIDING_HISTOGRAM_H
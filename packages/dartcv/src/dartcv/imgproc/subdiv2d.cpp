@@ -0,0 +1,249 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/imgproc/subdiv2d.h"
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <utility>
+
+namespace cvd {
+
+// distance along a Hilbert curve of order 16
+static uint64_t hilbertIndex(uint32_t x, uint32_t y) {
+    const uint32_t n = 1u << 16;
+    uint64_t d = 0;
+    for (uint32_t s = n / 2; s > 0; s /= 2) {
+        const uint32_t rx = (x & s) > 0;
+        const uint32_t ry = (y & s) > 0;
+        d += static_cast<uint64_t>(s) * s * ((3 * rx) ^ ry);
+        if (ry == 0) {
+            if (rx == 1) {
+                x = n - 1 - x;
+                y = n - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+static double orient(const cv::Point2f& a, const cv::Point2f& b, const cv::Point2f& c) {
+    return (static_cast<double>(b.x) - a.x) * (static_cast<double>(c.y) - a.y) -
+           (static_cast<double>(b.y) - a.y) * (static_cast<double>(c.x) - a.x);
+}
+
+// > 0 if d is inside the circumcircle of a, b, c when orient(a, b, c) > 0
+static double inCircle(
+    const cv::Point2f& a, const cv::Point2f& b, const cv::Point2f& c, const cv::Point2f& d
+) {
+    const double adx = a.x - static_cast<double>(d.x), ady = a.y - static_cast<double>(d.y);
+    const double bdx = b.x - static_cast<double>(d.x), bdy = b.y - static_cast<double>(d.y);
+    const double cdx = c.x - static_cast<double>(d.x), cdy = c.y - static_cast<double>(d.y);
+    return (adx * adx + ady * ady) * (bdx * cdy - cdx * bdy) -
+           (bdx * bdx + bdy * bdy) * (adx * cdy - cdx * ady) +
+           (cdx * cdx + cdy * cdy) * (adx * bdy - bdx * ady);
+}
+
+void Subdiv2D::insertBulk(const float* xy, size_t n, std::vector<int>& ids) {
+    ids.assign(n, 0);
+    if (n == 0) return;
+    // same bounds as insert(), checked before anything is inserted so a bad point leaves the
+    // subdivision unchanged
+    for (size_t i = 0; i < n; i++) {
+        const float x = xy[i * 2], y = xy[i * 2 + 1];
+        if (x < topLeft.x || y < topLeft.y || x >= bottomRight.x || y >= bottomRight.y) {
+            CV_Error(
+                cv::Error::StsOutOfRange, "point " + std::to_string(i) + " is outside the rect"
+            );
+        }
+    }
+    const double sx = 65535.0 / std::max(bottomRight.x - topLeft.x, FLT_EPSILON);
+    const double sy = 65535.0 / std::max(bottomRight.y - topLeft.y, FLT_EPSILON);
+    std::vector<std::pair<uint64_t, size_t>> order(n);
+    for (size_t i = 0; i < n; i++) {
+        const double x = std::min(std::max((xy[i * 2] - topLeft.x) * sx, 0.0), 65535.0);
+        const double y = std::min(std::max((xy[i * 2 + 1] - topLeft.y) * sy, 0.0), 65535.0);
+        order[i] = {hilbertIndex(static_cast<uint32_t>(x), static_cast<uint32_t>(y)), i};
+    }
+    std::sort(order.begin(), order.end());
+    for (const auto& o : order) {
+        ids[o.second] = insert(cv::Point2f(xy[o.second * 2], xy[o.second * 2 + 1]));
+    }
+}
+
+void Subdiv2D::getTriangleIndices(std::vector<int>& indices) const {
+    indices.clear();
+    std::vector<int> leading;
+    getLeadingEdgeList(leading);
+    indices.reserve(leading.size() * 3);
+    for (int edge : leading) {
+        const int a = edgeOrg(edge);
+        edge = getEdge(edge, NEXT_AROUND_LEFT);
+        const int b = edgeOrg(edge);
+        edge = getEdge(edge, NEXT_AROUND_LEFT);
+        const int c = edgeOrg(edge);
+        if (a < 4 || b < 4 || c < 4) continue;
+        indices.push_back(a);
+        indices.push_back(b);
+        indices.push_back(c);
+    }
+}
+
+void Subdiv2D::getVoronoiFacetsFlat(
+    const std::vector<int>& idx,
+    std::vector<float>& facets,
+    std::vector<int>& offsets,
+    std::vector<float>& centers
+) {
+    std::vector<std::vector<cv::Point2f>> facetList;
+    std::vector<cv::Point2f> facetCenters;
+    getVoronoiFacetList(idx, facetList, facetCenters);
+
+    size_t total = 0;
+    for (const auto& f : facetList) total += f.size();
+    facets.clear();
+    facets.reserve(total * 2);
+    offsets.assign(1, 0);
+    offsets.reserve(facetList.size() + 1);
+    for (const auto& f : facetList) {
+        for (const auto& p : f) {
+            facets.push_back(p.x);
+            facets.push_back(p.y);
+        }
+        offsets.push_back(offsets.back() + static_cast<int>(f.size()));
+    }
+    centers.clear();
+    centers.reserve(facetCenters.size() * 2);
+    for (const auto& p : facetCenters) {
+        centers.push_back(p.x);
+        centers.push_back(p.y);
+    }
+}
+
+// vtx[].firstEdge is not updated when cv::Subdiv2D swaps an edge away from a vertex, so it is
+// checked and the quad-edges are scanned if it is stale.
+int Subdiv2D::vertexEdge(int vertex) const {
+    const int edge = vtx[vertex].firstEdge;
+    if (edge > 0 && edgeOrg(edge) == vertex) return edge;
+    for (size_t i = 1; i < qedges.size(); i++) {
+        if (qedges[i].isfree()) continue;
+        if (qedges[i].pt[0] == vertex) return static_cast<int>(i * 4);
+        if (qedges[i].pt[2] == vertex) return static_cast<int>(i * 4 + 2);
+    }
+    CV_Error(cv::Error::StsInternal, "vertex has no edge");
+}
+
+bool Subdiv2D::tryMove(int vertex, cv::Point2f pt) {
+    const cv::Point2f old = vtx[vertex].pt;
+    const int first = vertexEdge(vertex);
+    int edge = first;
+    // the move is local only if no incident triangle flips
+    do {
+        const int next = getEdge(edge, NEXT_AROUND_ORG);
+        const cv::Point2f& a = vtx[edgeDst(edge)].pt;
+        const cv::Point2f& b = vtx[edgeDst(next)].pt;
+        if (orient(old, a, b) * orient(pt, a, b) <= 0) return false;
+        edge = next;
+    } while (edge != first);
+
+    vtx[vertex].pt = pt;
+    std::vector<int> edges;
+    edge = first;
+    do {
+        edges.push_back(edge);
+        edges.push_back(getEdge(edge, NEXT_AROUND_LEFT));
+        edge = getEdge(edge, NEXT_AROUND_ORG);
+    } while (edge != first);
+    return legalize(edges);
+}
+
+// Lawson flips: every edge whose opposite vertex is inside the circumcircle of the other
+// triangle is swapped and the edges of its quadrilateral are checked again.
+bool Subdiv2D::legalize(std::vector<int>& edges) {
+    size_t budget = vtx.size() * 64 + 1024;
+    while (!edges.empty()) {
+        const int edge = edges.back();
+        edges.pop_back();
+        const int a = edgeOrg(edge), b = edgeDst(edge);
+        // the edges of the outer triangle have no triangle on one side
+        if (a < 4 && b < 4) continue;
+        const int sym = symEdge(edge);
+        const int c = edgeDst(getEdge(edge, NEXT_AROUND_LEFT));
+        const int d = edgeDst(getEdge(sym, NEXT_AROUND_LEFT));
+        const cv::Point2f &pa = vtx[a].pt, &pb = vtx[b].pt, &pc = vtx[c].pt, &pd = vtx[d].pt;
+        if (inCircle(pa, pb, pc, pd) * orient(pa, pb, pc) <= 0) continue;
+        if (orient(pc, pd, pa) * orient(pc, pd, pb) >= 0) continue;
+        if (budget-- == 0) return false;
+
+        const int quad[4] = {
+            getEdge(edge, NEXT_AROUND_LEFT),
+            getEdge(edge, PREV_AROUND_LEFT),
+            getEdge(sym, NEXT_AROUND_LEFT),
+            getEdge(sym, PREV_AROUND_LEFT),
+        };
+        const int ea = getEdge(edge, NEXT_AROUND_ORG), eb = getEdge(sym, NEXT_AROUND_ORG);
+        swapEdge(edge);
+        if (edgeOrg(vtx[a].firstEdge) != a) vtx[a].firstEdge = ea;
+        if (edgeOrg(vtx[b].firstEdge) != b) vtx[b].firstEdge = eb;
+        edges.insert(edges.end(), quad, quad + 4);
+    }
+    return true;
+}
+
+void Subdiv2D::rebuild() {
+    std::vector<cv::Point2f> pts;
+    pts.reserve(vtx.size());
+    for (size_t i = 4; i < vtx.size(); i++) pts.push_back(vtx[i].pt);
+    initDelaunay(cv::Rect(
+        cvRound(topLeft.x),
+        cvRound(topLeft.y),
+        cvRound(bottomRight.x - topLeft.x),
+        cvRound(bottomRight.y - topLeft.y)
+    ));
+    // the ids were assigned in this order, so they are kept
+    for (size_t i = 0; i < pts.size(); i++) {
+        const int id = insert(pts[i]);
+        CV_Assert(id == static_cast<int>(i) + 4);
+    }
+}
+
+bool Subdiv2D::movePoints(const std::vector<int>& vertices, const float* xy) {
+    const int nvtx = static_cast<int>(vtx.size());
+    std::set<int> moved;
+    std::set<std::pair<float, float>> targets;
+    for (size_t i = 0; i < vertices.size(); i++) {
+        const int v = vertices[i];
+        const cv::Point2f pt(xy[i * 2], xy[i * 2 + 1]);
+        if (v < 4 || v >= nvtx || vtx[v].isfree())
+            CV_Error(cv::Error::StsOutOfRange, "invalid vertex id");
+        if (pt.x < topLeft.x || pt.y < topLeft.y || pt.x >= bottomRight.x || pt.y >= bottomRight.y)
+            CV_Error(cv::Error::StsOutOfRange, "point is outside the subdivision rect");
+        if (!moved.insert(v).second) CV_Error(cv::Error::StsBadArg, "vertex is moved twice");
+        if (!targets.insert({pt.x, pt.y}).second)
+            CV_Error(cv::Error::StsBadArg, "two vertices are moved to the same point");
+    }
+    // vertices must stay distinct, otherwise the ids could not be kept
+    for (size_t i = 0; i < vertices.size(); i++) {
+        int edge = 0, vertex = 0;
+        const cv::Point2f pt(xy[i * 2], xy[i * 2 + 1]);
+        if (locate(pt, edge, vertex) == PTLOC_VERTEX && moved.count(vertex) == 0)
+            CV_Error(cv::Error::StsBadArg, "vertex is moved onto another vertex");
+    }
+
+    bool rebuilt = false;
+    for (size_t i = 0; i < vertices.size(); i++) {
+        const cv::Point2f pt(xy[i * 2], xy[i * 2 + 1]);
+        if (!rebuilt && tryMove(vertices[i], pt)) continue;
+        vtx[vertices[i]].pt = pt;
+        rebuilt = true;
+    }
+    if (rebuilt) rebuild();
+    validGeometry = false;
+    return rebuilt;
+}
+
+}  // namespace cvd
@@ -0,0 +1,52 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_SUBDIV2D_H
+#define DARTCV_LIBRARY_SUBDIV2D_H
+
+#include <opencv2/imgproc.hpp>
+#include <vector>
+
+namespace cvd {
+// cv::Subdiv2D with bulk insertion, flat outputs and incremental point moves.
+//
+// It only adds methods, so every cv::Subdiv2D operation keeps working on it, vertex ids are the
+// same as cv::Subdiv2D (0 is unused and 1-3 are the outer bounding triangle).
+class Subdiv2D : public cv::Subdiv2D {
+  public:
+    Subdiv2D() = default;
+    explicit Subdiv2D(cv::Rect rect) : cv::Subdiv2D(rect) {}
+
+    // Inserts n points from a flat x0,y0,x1,y1... buffer in Hilbert curve order, so every
+    // point location starts next to the previous insertion, ids are in input order. Throws
+    // before inserting anything if a point is outside the rect.
+    void insertBulk(const float* xy, size_t n, std::vector<int>& ids);
+
+    // Triangles as 3 vertex ids each, the triangles touching the outer vertices are skipped
+    // the same way as getTriangleList.
+    void getTriangleIndices(std::vector<int>& indices) const;
+
+    // Voronoi facets of idx (all if empty) as a flat x,y buffer with n + 1 offsets (in points).
+    void getVoronoiFacetsFlat(
+        const std::vector<int>& idx,
+        std::vector<float>& facets,
+        std::vector<int>& offsets,
+        std::vector<float>& centers
+    );
+
+    // Moves vertices to new positions. A vertex whose incident triangles keep their
+    // orientation is moved in place and the Delaunay property is restored by edge flips
+    // around it, otherwise the whole subdivision is rebuilt with the same vertex ids.
+    // Returns true if it was rebuilt.
+    bool movePoints(const std::vector<int>& vertices, const float* xy);
+
+  private:
+    int vertexEdge(int vertex) const;
+    bool tryMove(int vertex, cv::Point2f pt);
+    bool legalize(std::vector<int>& edges);
+    void rebuild();
+};
+}  // namespace cvd
+
+#endif  // DARTCV_LIBRARY_SUBDIV2D_H
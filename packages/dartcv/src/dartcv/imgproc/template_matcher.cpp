@@ -0,0 +1,254 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/imgproc/template_matcher.h"
+#include <algorithm>
+#include <cfloat>
+
+namespace cvd {
+
+// templates are not downsampled below this size
+static const int kMinTemplSize = 8;
+// search radius of the refinement at the next finer level, in pixels of that level
+static const int kRefineRadius = 2;
+// marks invalid scores, since all scores are turned into "higher is better"
+static const double kInvalid = -FLT_MAX;
+
+TemplateMatcher::TemplateMatcher(
+    const cv::Mat& templ,
+    const std::vector<double>& scales,
+    const std::vector<double>& angles,
+    int method,
+    int levels,
+    int topK
+) :
+    topK_(topK), method_(method), levels_(levels), templSize_(templ.size()) {
+    CV_Assert(!templ.empty());
+    CV_Assert(
+        method == cv::TM_SQDIFF_NORMED || method == cv::TM_CCORR_NORMED ||
+        method == cv::TM_CCOEFF_NORMED
+    );
+    CV_Assert(levels >= 1 && topK >= 1);
+
+    const std::vector<double> ss = scales.empty() ? std::vector<double>{1.} : scales;
+    const std::vector<double> as = angles.empty() ? std::vector<double>{0.} : angles;
+    const cv::Point2f center((templ.cols - 1) * 0.5f, (templ.rows - 1) * 0.5f);
+    for (double scale : ss) {
+        CV_Assert(scale > 0);
+        for (double angle : as) {
+            Variant v{scale, angle, {}, {}};
+            cv::Mat t, m;
+            if (std::fmod(angle, 360.) == 0) {
+                const cv::Size sz(cvRound(templ.cols * scale), cvRound(templ.rows * scale));
+                if (sz.width < 1 || sz.height < 1) continue;
+                cv::resize(templ, t, sz, 0, 0, scale < 1 ? cv::INTER_AREA : cv::INTER_LINEAR);
+            } else {
+                // rotate into the bounding box of the rotated template, pixels outside
+                // the original template are excluded by the mask
+                const double rad = angle * CV_PI / 180;
+                const double c = std::abs(std::cos(rad)), s = std::abs(std::sin(rad));
+                const cv::Size sz(
+                    cvRound((templ.cols * c + templ.rows * s) * scale),
+                    cvRound((templ.cols * s + templ.rows * c) * scale)
+                );
+                if (sz.width < 1 || sz.height < 1) continue;
+                cv::Mat M = cv::getRotationMatrix2D(center, -angle, scale);
+                M.at<double>(0, 2) += (sz.width - 1) * 0.5 - center.x;
+                M.at<double>(1, 2) += (sz.height - 1) * 0.5 - center.y;
+                cv::warpAffine(templ, t, M, sz, cv::INTER_LINEAR, cv::BORDER_CONSTANT);
+                cv::warpAffine(
+                    cv::Mat(templ.size(), CV_8UC1, cv::Scalar(255)),
+                    m,
+                    M,
+                    sz,
+                    cv::INTER_NEAREST,
+                    cv::BORDER_CONSTANT
+                );
+            }
+
+            v.templ.push_back(t);
+            v.mask.push_back(m);
+            for (int l = 1; l < levels; l++) {
+                const cv::Mat& prev = v.templ.back();
+                if (std::min(prev.cols, prev.rows) / 2 < kMinTemplSize) break;
+                cv::Mat tl, ml;
+                cv::pyrDown(prev, tl);
+                if (!m.empty()) cv::resize(v.mask.back(), ml, tl.size(), 0, 0, cv::INTER_NEAREST);
+                v.templ.push_back(tl);
+                v.mask.push_back(ml);
+            }
+            variants_.push_back(std::move(v));
+        }
+    }
+}
+
+void TemplateMatcher::matchAt(const cv::Mat& image, const Variant& v, int level, cv::Mat& result)
+    const {
+    const cv::Mat& mask = v.mask[level];
+    if (mask.empty())
+        cv::matchTemplate(image, v.templ[level], result, method_);
+    else
+        cv::matchTemplate(image, v.templ[level], result, method_, mask);
+    if (method_ == cv::TM_SQDIFF_NORMED) cv::subtract(1., result, result);
+    // masked normed methods may divide by zero on flat regions
+    cv::patchNaNs(result, kInvalid);
+    result.setTo(kInvalid, result > 1 + 1e-3);
+}
+
+void TemplateMatcher::match(
+    const cv::Mat& image,
+    double threshold,
+    int maxMatches,
+    std::vector<cv::RotatedRect>& boxes,
+    std::vector<float>& scores
+) const {
+    CV_Assert(!image.empty());
+    std::vector<cv::Mat> pyr;
+    cv::buildPyramid(image, pyr, levels_ - 1);
+    const double thr = method_ == cv::TM_SQDIFF_NORMED ? 1 - threshold : threshold;
+
+    std::vector<std::vector<Candidate>> found(variants_.size());
+    cv::parallel_for_(cv::Range(0, static_cast<int>(variants_.size())), [&](const cv::Range& range) {
+        cv::Mat result;
+        for (int vi = range.start; vi < range.end; vi++) {
+            const Variant& v = variants_[vi];
+            int top = static_cast<int>(v.templ.size()) - 1;
+            while (top >= 0 &&
+                   (pyr[top].cols < v.templ[top].cols || pyr[top].rows < v.templ[top].rows))
+                top--;
+            if (top < 0) continue;
+
+            // full correlation at the coarsest level only, keep the best topK peaks
+            matchAt(pyr[top], v, top, result);
+            std::vector<Candidate> cands;
+            const cv::Size sup(v.templ[top].cols / 2, v.templ[top].rows / 2);
+            const cv::Rect rbounds(0, 0, result.cols, result.rows);
+            for (int k = 0; k < topK_; k++) {
+                double maxVal;
+                cv::Point maxLoc;
+                cv::minMaxLoc(result, nullptr, &maxVal, nullptr, &maxLoc);
+                if (maxVal <= kInvalid) break;
+                cands.push_back({maxLoc, maxVal, vi});
+                const cv::Rect r(
+                    maxLoc.x - sup.width, maxLoc.y - sup.height, sup.width * 2 + 1, sup.height * 2 + 1
+                );
+                result(r & rbounds).setTo(kInvalid);
+            }
+
+            // refine every candidate in a small window of the next finer level
+            for (int l = top - 1; l >= 0; l--) {
+                const cv::Mat& img = pyr[l];
+                const cv::Mat& t = v.templ[l];
+                const cv::Rect bounds(0, 0, img.cols, img.rows);
+                for (auto& c : cands) {
+                    if (c.score <= kInvalid) continue;
+                    const cv::Rect roi = cv::Rect(
+                                             c.pt.x * 2 - kRefineRadius,
+                                             c.pt.y * 2 - kRefineRadius,
+                                             t.cols + 2 * kRefineRadius,
+                                             t.rows + 2 * kRefineRadius
+                                         ) &
+                                         bounds;
+                    if (roi.width < t.cols || roi.height < t.rows) {
+                        c.score = kInvalid;
+                        continue;
+                    }
+                    matchAt(img(roi), v, l, result);
+                    double maxVal;
+                    cv::Point maxLoc;
+                    cv::minMaxLoc(result, nullptr, &maxVal, nullptr, &maxLoc);
+                    c.pt = roi.tl() + maxLoc;
+                    c.score = maxVal;
+                }
+            }
+            for (const auto& c : cands) {
+                if (c.score > kInvalid && c.score >= thr) found[vi].push_back(c);
+            }
+        }
+    });
+
+    std::vector<Candidate> all;
+    for (const auto& f : found) all.insert(all.end(), f.begin(), f.end());
+    std::stable_sort(all.begin(), all.end(), [](const Candidate& a, const Candidate& b) {
+        return a.score > b.score;
+    });
+
+    // greedy suppression of matches whose centers are closer than half of the template
+    boxes.clear();
+    scores.clear();
+    std::vector<float> radii;
+    for (const auto& c : all) {
+        if (maxMatches > 0 && static_cast<int>(boxes.size()) >= maxMatches) break;
+        const Variant& v = variants_[c.variant];
+        const cv::Point2f center(
+            c.pt.x + (v.templ[0].cols - 1) * 0.5f, c.pt.y + (v.templ[0].rows - 1) * 0.5f
+        );
+        const cv::Size2f size(
+            static_cast<float>(templSize_.width * v.scale),
+            static_cast<float>(templSize_.height * v.scale)
+        );
+        const float radius = 0.5f * std::min(size.width, size.height);
+        bool suppressed = false;
+        for (size_t j = 0; j < boxes.size() && !suppressed; j++) {
+            suppressed = cv::norm(center - boxes[j].center) < std::max(radius, radii[j]);
+        }
+        if (suppressed) continue;
+        boxes.emplace_back(center, size, static_cast<float>(v.angle));
+        scores.push_back(
+            static_cast<float>(method_ == cv::TM_SQDIFF_NORMED ? 1 - c.score : c.score)
+        );
+        radii.push_back(radius);
+    }
+}
+
+}  // namespace cvd
+
+CvStatus* cv_TemplateMatcher_create(
+    Mat templ,
+    VecF64 scales,
+    VecF64 angles,
+    int method,
+    int levels,
+    int topK,
+    TemplateMatcher* rval
+) {
+    BEGIN_WRAP
+    *rval = {new cvd::TemplateMatcher(
+        CVDEREF(templ), CVDEREF(scales), CVDEREF(angles), method, levels, topK
+    )};
+    END_WRAP
+}
+
+void cv_TemplateMatcher_close(TemplateMatcherPtr self) {
+    CVD_FREE(self);
+}
+
+CvStatus* cv_TemplateMatcher_match(
+    TemplateMatcher self,
+    Mat image,
+    double threshold,
+    int maxMatches,
+    VecRotatedRect* boxes,
+    VecF32* scores,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    self.ptr->match(CVDEREF(image), threshold, maxMatches, CVDEREF_P(boxes), CVDEREF_P(scores));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+int cv_TemplateMatcher_getMethod(TemplateMatcher self) {
+    return self.ptr->method();
+}
+
+int cv_TemplateMatcher_getLevels(TemplateMatcher self) {
+    return self.ptr->levels();
+}
+
+int cv_TemplateMatcher_getTopK(TemplateMatcher self) {
+    return self.ptr->topK();
+}
@@ -0,0 +1,113 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_TEMPLATE_MATCHER_H
+#define DARTCV_LIBRARY_TEMPLATE_MATCHER_H
+
+#ifdef __cplusplus
+#include <opencv2/imgproc.hpp>
+#include <vector>
+
+namespace cvd {
+// Coarse-to-fine template matcher over a set of scales and rotations.
+// Rotated/scaled templates and their pyramids are built once. For every image, the
+// full correlation only runs at the coarsest pyramid level, the best topK peaks are then
+// refined level by level inside small windows, so the cost of the finer levels does not
+// depend on the image size. More levels or a smaller topK trade accuracy for speed.
+class TemplateMatcher {
+  public:
+    TemplateMatcher(
+        const cv::Mat& templ,
+        const std::vector<double>& scales,
+        const std::vector<double>& angles,
+        int method,
+        int levels,
+        int topK
+    );
+
+    // boxes are centered on the matches with the size of the scaled template and the
+    // rotation angle, scores are in the domain of method, sorted from best to worst.
+    void match(
+        const cv::Mat& image,
+        double threshold,
+        int maxMatches,
+        std::vector<cv::RotatedRect>& boxes,
+        std::vector<float>& scores
+    ) const;
+
+    int method() const { return method_; }
+    int levels() const { return levels_; }
+    int topK() const { return topK_; }
+
+  private:
+    struct Variant {
+        double scale, angle;
+        // per pyramid level, masks are empty for unrotated templates
+        std::vector<cv::Mat> templ, mask;
+    };
+    struct Candidate {
+        cv::Point pt;
+        double score;
+        int variant;
+    };
+
+    void matchAt(
+        const cv::Mat& image, const Variant& v, int level, cv::Mat& result
+    ) const;
+
+    const int topK_;
+    int method_, levels_;
+    cv::Size templSize_;
+    std::vector<Variant> variants_;
+};
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+CVD_TYPEDEF(cvd::TemplateMatcher, TemplateMatcher);
+#else
+CVD_TYPEDEF(void, TemplateMatcher);
+#endif
+
+// Creates a multi-scale, multi-rotation pyramid template matcher.
+// method must be one of TM_SQDIFF_NORMED, TM_CCORR_NORMED or TM_CCOEFF_NORMED,
+// angles are in degrees (clockwise, the same as RotatedRect), levels is the number of
+// pyramid levels (1 disables the pyramid), topK is the number of candidates refined per
+// scale/rotation.
+CvStatus* cv_TemplateMatcher_create(
+    Mat templ,
+    VecF64 scales,
+    VecF64 angles,
+    int method,
+    int levels,
+    int topK,
+    TemplateMatcher* rval
+);
+void cv_TemplateMatcher_close(TemplateMatcherPtr self);
+
+// Finds at most maxMatches non-overlapping matches whose score passes threshold.
+// void cv::matchTemplate (InputArray image, InputArray templ, OutputArray result, int method, InputArray mask=noArray())
+CvStatus* cv_TemplateMatcher_match(
+    TemplateMatcher self,
+    Mat image,
+    double threshold,
+    int maxMatches,
+    CVD_OUT VecRotatedRect* boxes,
+    CVD_OUT VecF32* scores,
+    CvCallback_0 callback
+);
+
+int cv_TemplateMatcher_getMethod(TemplateMatcher self);
+int cv_TemplateMatcher_getLevels(TemplateMatcher self);
+int cv_TemplateMatcher_getTopK(TemplateMatcher self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_TEMPLATE_MATCHER_H
@@ -0,0 +1,235 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#include "dartcv/imgproc/video_clahe.h"
+
+namespace cvd {
+
+VideoCLAHE::VideoCLAHE(double clipLimit, cv::Size tiles, double smoothing) :
+    clipLimit_(clipLimit), tiles_(tiles), smoothing_(0) {
+    CV_Assert(tiles.width > 0 && tiles.height > 0);
+    setSmoothing(smoothing);
+}
+
+void VideoCLAHE::setSmoothing(double smoothing) {
+    CV_Assert(smoothing >= 0 && smoothing < 1);
+    smoothing_ = smoothing;
+}
+
+void VideoCLAHE::reset() {
+    frames_ = 0;
+    size_ = cv::Size();
+    type_ = -1;
+}
+
+// Histogram, clipping and redistribution are the same as cv::CLAHE, the mapping is kept in
+// float and blended with the previous one before it is rounded to the LUT.
+template <typename T, int histSize>
+void VideoCLAHE::calcLut(const cv::Mat& srcForLut, cv::Size tileSize) {
+    const int ntiles = tiles_.area();
+    const int tileSizeTotal = tileSize.area();
+    const float lutScale = static_cast<float>(histSize - 1) / tileSizeTotal;
+    int clipLimit = 0;
+    if (clipLimit_ > 0.0) {
+        clipLimit = static_cast<int>(clipLimit_ * tileSizeTotal / histSize);
+        clipLimit = std::max(clipLimit, 1);
+    }
+    const bool first = frames_ == 0;
+    const float a = static_cast<float>(smoothing_), b = 1.f - a;
+
+    cv::parallel_for_(cv::Range(0, ntiles), [&](const cv::Range& range) {
+        for (int k = range.start; k < range.end; k++) {
+            const int tx = k % tiles_.width, ty = k / tiles_.width;
+            const cv::Mat tile = srcForLut(
+                cv::Rect(tx * tileSize.width, ty * tileSize.height, tileSize.width, tileSize.height)
+            );
+
+            int* tileHist = &hist_[static_cast<size_t>(k) * histSize];
+            std::fill(tileHist, tileHist + histSize, 0);
+            for (int y = 0; y < tile.rows; y++) {
+                const T* row = tile.ptr<T>(y);
+                for (int x = 0; x < tile.cols; x++) tileHist[row[x]]++;
+            }
+
+            if (clipLimit > 0) {
+                int clipped = 0;
+                for (int i = 0; i < histSize; i++) {
+                    if (tileHist[i] > clipLimit) {
+                        clipped += tileHist[i] - clipLimit;
+                        tileHist[i] = clipLimit;
+                    }
+                }
+                const int redistBatch = clipped / histSize;
+                int residual = clipped - redistBatch * histSize;
+                for (int i = 0; i < histSize; i++) tileHist[i] += redistBatch;
+                if (residual != 0) {
+                    const int residualStep = std::max(histSize / residual, 1);
+                    for (int i = 0; i < histSize && residual > 0; i += residualStep, residual--)
+                        tileHist[i]++;
+                }
+            }
+
+            float* tileLutf = lutf_.ptr<float>(k);
+            T* tileLut = lut_.ptr<T>(k);
+            int sum = 0;
+            for (int i = 0; i < histSize; i++) {
+                sum += tileHist[i];
+                const float v = sum * lutScale;
+                tileLutf[i] = first ? v : a * tileLutf[i] + b * v;
+                tileLut[i] = cv::saturate_cast<T>(tileLutf[i]);
+            }
+        }
+    });
+}
+
+// Bilinear interpolation between the four nearest tile mappings, same as cv::CLAHE.
+template <typename T, int histSize>
+void VideoCLAHE::interpolate(const cv::Mat& src, cv::Mat& dst, cv::Size tileSize) const {
+    const float inv_tw = 1.0f / tileSize.width;
+    const float inv_th = 1.0f / tileSize.height;
+
+    std::vector<int> ind(src.cols * 2);
+    std::vector<float> xa(src.cols * 2);
+    int* ind1_p = ind.data();
+    int* ind2_p = ind1_p + src.cols;
+    float* xa_p = xa.data();
+    float* xa1_p = xa_p + src.cols;
+    for (int x = 0; x < src.cols; x++) {
+        const float txf = x * inv_tw - 0.5f;
+        int tx1 = cvFloor(txf);
+        int tx2 = tx1 + 1;
+        xa_p[x] = txf - tx1;
+        xa1_p[x] = 1.0f - xa_p[x];
+        tx1 = std::max(tx1, 0);
+        tx2 = std::min(tx2, tiles_.width - 1);
+        ind1_p[x] = tx1 * histSize;
+        ind2_p[x] = tx2 * histSize;
+    }
+
+    cv::parallel_for_(cv::Range(0, src.rows), [&](const cv::Range& range) {
+        for (int y = range.start; y < range.end; y++) {
+            const T* srcRow = src.ptr<T>(y);
+            T* dstRow = dst.ptr<T>(y);
+            const float tyf = y * inv_th - 0.5f;
+            int ty1 = cvFloor(tyf);
+            int ty2 = ty1 + 1;
+            const float ya = tyf - ty1, ya1 = 1.0f - ya;
+            ty1 = std::max(ty1, 0);
+            ty2 = std::min(ty2, tiles_.height - 1);
+            const T* lutPlane1 = lut_.ptr<T>(ty1 * tiles_.width);
+            const T* lutPlane2 = lut_.ptr<T>(ty2 * tiles_.width);
+            for (int x = 0; x < src.cols; x++) {
+                const int srcVal = srcRow[x];
+                const int ind1 = ind1_p[x] + srcVal;
+                const int ind2 = ind2_p[x] + srcVal;
+                const float res = (lutPlane1[ind1] * xa1_p[x] + lutPlane1[ind2] * xa_p[x]) * ya1 +
+                                  (lutPlane2[ind1] * xa1_p[x] + lutPlane2[ind2] * xa_p[x]) * ya;
+                dstRow[x] = cv::saturate_cast<T>(res);
+            }
+        }
+    });
+}
+
+void VideoCLAHE::apply(const cv::Mat& src, cv::Mat& dst) {
+    CV_Assert(src.type() == CV_8UC1 || src.type() == CV_16UC1);
+    if (src.size() != size_ || src.type() != type_) {
+        reset();
+        size_ = src.size();
+        type_ = src.type();
+    }
+
+    const int histSize = src.type() == CV_8UC1 ? 256 : 65536;
+    cv::Size tileSize;
+    cv::Mat srcForLut;
+    if (src.cols % tiles_.width == 0 && src.rows % tiles_.height == 0) {
+        tileSize = cv::Size(src.cols / tiles_.width, src.rows / tiles_.height);
+        srcForLut = src;
+    } else {
+        cv::copyMakeBorder(
+            src,
+            srcExt_,
+            0,
+            tiles_.height - (src.rows % tiles_.height),
+            0,
+            tiles_.width - (src.cols % tiles_.width),
+            cv::BORDER_REFLECT_101
+        );
+        tileSize = cv::Size(srcExt_.cols / tiles_.width, srcExt_.rows / tiles_.height);
+        srcForLut = srcExt_;
+    }
+
+    const int ntiles = tiles_.area();
+    hist_.resize(static_cast<size_t>(ntiles) * histSize);
+    lutf_.create(ntiles, histSize, CV_32F);
+    lut_.create(ntiles, histSize, src.type());
+
+    // the LUTs are computed before dst is written, so src and dst may share data
+    dst.create(src.size(), src.type());
+    if (src.type() == CV_8UC1) {
+        calcLut<uchar, 256>(srcForLut, tileSize);
+        interpolate<uchar, 256>(src, dst, tileSize);
+    } else {
+        calcLut<ushort, 65536>(srcForLut, tileSize);
+        interpolate<ushort, 65536>(src, dst, tileSize);
+    }
+    frames_++;
+}
+
+}  // namespace cvd
+
+CvStatus* cv_VideoCLAHE_create(
+    double clipLimit, CvSize tileGridSize, double smoothing, VideoCLAHE* rval
+) {
+    BEGIN_WRAP
+    *rval = {new cvd::VideoCLAHE(
+        clipLimit, cv::Size(tileGridSize.width, tileGridSize.height), smoothing
+    )};
+    END_WRAP
+}
+
+void cv_VideoCLAHE_close(VideoCLAHEPtr self) {
+    CVD_FREE(self);
+}
+
+CvStatus* cv_VideoCLAHE_apply(VideoCLAHE self, Mat src, Mat dst, CvCallback_0 callback) {
+    BEGIN_WRAP
+    self.ptr->apply(CVDEREF(src), CVDEREF(dst));
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
+
+void cv_VideoCLAHE_reset(VideoCLAHE self) {
+    self.ptr->reset();
+}
+
+double cv_VideoCLAHE_getClipLimit(VideoCLAHE self) {
+    return self.ptr->clipLimit();
+}
+
+void cv_VideoCLAHE_setClipLimit(VideoCLAHE self, double clipLimit) {
+    self.ptr->setClipLimit(clipLimit);
+}
+
+double cv_VideoCLAHE_getSmoothing(VideoCLAHE self) {
+    return self.ptr->smoothing();
+}
+
+CvStatus* cv_VideoCLAHE_setSmoothing(VideoCLAHE self, double smoothing) {
+    BEGIN_WRAP
+    self.ptr->setSmoothing(smoothing);
+    END_WRAP
+}
+
+CvStatus* cv_VideoCLAHE_getTilesGridSize(VideoCLAHE self, CvSize* rval) {
+    BEGIN_WRAP
+    auto tiles = self.ptr->tiles();
+    *rval = {tiles.width, tiles.height};
+    END_WRAP
+}
+
+int cv_VideoCLAHE_getFrames(VideoCLAHE self) {
+    return self.ptr->frames();
+}
@@ -0,0 +1,89 @@
+/*
+    Licensed: Apache 2.0 license. Copyright (c) 2026 Rainyl.
+*/
+
+#ifndef DARTCV_LIBRARY_VIDEO_CLAHE_H
+#define DARTCV_LIBRARY_VIDEO_CLAHE_H
+
+#ifdef __cplusplus
+#include <opencv2/imgproc.hpp>
+#include <vector>
+
+namespace cvd {
+// CLAHE for video streams, same algorithm as cv::CLAHE but:
+//   - tile histograms and LUTs are computed in parallel, one tile per task;
+//   - the clipped tile mappings are blended with those of the previous frames,
+//     lut = smoothing * lut_prev + (1 - smoothing) * lut_cur, to avoid flicker;
+//   - padded source, histograms and LUTs are kept between calls.
+// With smoothing == 0 the output is the same as cv::CLAHE.
+class VideoCLAHE {
+  public:
+    VideoCLAHE(double clipLimit, cv::Size tiles, double smoothing);
+
+    void apply(const cv::Mat& src, cv::Mat& dst);
+    // forgets the mappings of previous frames, e.g., on scene cuts
+    void reset();
+
+    double clipLimit() const { return clipLimit_; }
+    void setClipLimit(double clipLimit) { clipLimit_ = clipLimit; }
+    double smoothing() const { return smoothing_; }
+    void setSmoothing(double smoothing);
+    cv::Size tiles() const { return tiles_; }
+    int frames() const { return frames_; }
+
+  private:
+    template <typename T, int histSize>
+    void calcLut(const cv::Mat& srcForLut, cv::Size tileSize);
+    template <typename T, int histSize>
+    void interpolate(const cv::Mat& src, cv::Mat& dst, cv::Size tileSize) const;
+
+    double clipLimit_;
+    cv::Size tiles_;
+    double smoothing_;
+
+    // state of the previous frames, reset when the size or type changes
+    cv::Size size_;
+    int type_ = -1;
+    int frames_ = 0;
+
+    cv::Mat srcExt_;
+    std::vector<int> hist_;  // tiles * histSize
+    cv::Mat lutf_;           // tiles x histSize, CV_32F, smoothed mappings
+    cv::Mat lut_;            // tiles x histSize, src type
+};
+}  // namespace cvd
+
+extern "C" {
+#endif
+#include "dartcv/core/types.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+CVD_TYPEDEF(cvd::VideoCLAHE, VideoCLAHE);
+#else
+CVD_TYPEDEF(void, VideoCLAHE);
+#endif
+
+// Creates a CLAHE for video streams, clipLimit and tileGridSize are the same as cv::createCLAHE,
+// smoothing in [0, 1) is the weight of the previous frames' tile mappings.
+CvStatus* cv_VideoCLAHE_create(
+    double clipLimit, CvSize tileGridSize, double smoothing, VideoCLAHE* rval
+);
+void cv_VideoCLAHE_close(VideoCLAHEPtr self);
+
+// Equalizes src (CV_8UC1 or CV_16UC1) and updates the smoothed tile mappings.
+CvStatus* cv_VideoCLAHE_apply(VideoCLAHE self, Mat src, CVD_OUT Mat dst, CvCallback_0 callback);
+
+void cv_VideoCLAHE_reset(VideoCLAHE self);
+double cv_VideoCLAHE_getClipLimit(VideoCLAHE self);
+void cv_VideoCLAHE_setClipLimit(VideoCLAHE self, double clipLimit);
+double cv_VideoCLAHE_getSmoothing(VideoCLAHE self);
+CvStatus* cv_VideoCLAHE_setSmoothing(VideoCLAHE self, double smoothing);
+CvStatus* cv_VideoCLAHE_getTilesGridSize(VideoCLAHE self, CVD_OUT CvSize* rval);
+int cv_VideoCLAHE_getFrames(VideoCLAHE self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //DARTCV_LIBRARY_VIDEO_CLAHE_H
@@ -120,6 +120,41 @@ CvStatus* cv_CascadeClassifier_detectMultiScale_3(
     }
     END_WRAP
 }
+CvStatus* cv_CascadeClassifier_detectMultiScalePyramid(
+    CascadeClassifier self,
+    VecMat pyramid,
+    double scaleFactor,
+    VecRect* objects,
+    int minNeighbors,
+    int flags,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    const auto& levels = CVDEREF(pyramid);
+    CV_Assert(!levels.empty() && scaleFactor > 1);
+    const auto win = self.ptr->getOriginalWindowSize();
+    auto& rects = CVDEREF_P(objects);
+    rects.clear();
+    for (size_t level = 0; level < levels.size(); level++) {
+        const auto& img = levels[level];
+        if (img.cols < win.width || img.rows < win.height) break;
+        // minSize == maxSize == window size, so only the scale 1 of this level is scanned
+        std::vector<cv::Rect> found;
+        self.ptr->detectMultiScale(img, found, 1.1, 0, flags, win, win);
+        const double scale = std::pow(scaleFactor, static_cast<double>(level));
+        for (const auto& r : found) {
+            rects.emplace_back(
+                cvRound(r.x * scale), cvRound(r.y * scale), cvRound(r.width * scale), cvRound(r.height * scale)
+            );
+        }
+    }
+    // same grouping as detectMultiScale, GROUP_EPS = 0.2
+    if (minNeighbors > 0) cv::groupRectangles(rects, minNeighbors, 0.2);
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
 bool cv_CascadeClassifier_empty(CascadeClassifier self) {
     return self.ptr->empty();
 }
@@ -79,6 +79,18 @@ CvStatus* cv_CascadeClassifier_detectMultiScale_3(
     bool outputRejectLevels,
     CvCallback_0 callback
 );
+// Detects objects on the levels of a prebuilt pyramid (level i is scaleFactor^i times smaller)
+// at the classifier window size only, instead of resizing the image for every scale,
+// detections are mapped back to level 0 and grouped with minNeighbors.
+CvStatus* cv_CascadeClassifier_detectMultiScalePyramid(
+    CascadeClassifier self,
+    VecMat pyramid,
+    double scaleFactor,
+    VecRect* objects,
+    int minNeighbors,
+    int flags,
+    CvCallback_0 callback
+);
 bool cv_CascadeClassifier_empty(CascadeClassifier self);
 int cv_CascadeClassifier_getFeatureType(CascadeClassifier self);
 CvSize cv_CascadeClassifier_getOriginalWindowSize(CascadeClassifier self);
@@ -122,6 +122,41 @@ CvStatus* cv_calcOpticalFlowPyrLK_1(
     }
     END_WRAP
 }
+CvStatus* cv_calcOpticalFlowPyrLK_2(
+    VecMat prevPyr,
+    VecMat nextPyr,
+    VecPoint2f prevPts,
+    VecPoint2f* nextPts,
+    VecUChar* status,
+    VecF32* err,
+    CvSize winSize,
+    int maxLevel,
+    TermCriteria criteria,
+    int flags,
+    double minEigThreshold,
+    CvCallback_0 callback
+) {
+    BEGIN_WRAP
+    auto tc = cv::TermCriteria(criteria.type, criteria.maxCount, criteria.epsilon);
+    // std::vector<cv::Mat> inputs are taken as pyramids by calcOpticalFlowPyrLK
+    cv::calcOpticalFlowPyrLK(
+        CVDEREF(prevPyr),
+        CVDEREF(nextPyr),
+        CVDEREF(prevPts),
+        CVDEREF_P(nextPts),
+        CVDEREF_P(status),
+        CVDEREF_P(err),
+        cv::Size(winSize.width, winSize.height),
+        maxLevel,
+        tc,
+        flags,
+        minEigThreshold
+    );
+    if (callback != nullptr) {
+        callback();
+    }
+    END_WRAP
+}
 CvStatus* cv_calcOpticalFlowFarneback(
     Mat prevImg,
     Mat nextImg,
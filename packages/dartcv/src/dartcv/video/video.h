@@ -73,6 +73,22 @@ CvStatus* cv_calcOpticalFlowPyrLK_1(
     double minEigThreshold,
     CvCallback_0 callback
 );
+// Same as cv_calcOpticalFlowPyrLK_1 but with prebuilt pyramids (e.g., cvd::ImagePyramid levels,
+// scale factor 2, padded by at least winSize), maxLevel is clipped to the pyramid levels.
+CvStatus* cv_calcOpticalFlowPyrLK_2(
+    VecMat prevPyr,
+    VecMat nextPyr,
+    VecPoint2f prevPts,
+    VecPoint2f* nextPts,
+    VecUChar* status,
+    VecF32* err,
+    CvSize winSize,
+    int maxLevel,
+    TermCriteria criteria,
+    int flags,
+    double minEigThreshold,
+    CvCallback_0 callback
+);
 CvStatus* cv_calcOpticalFlowFarneback(
     Mat prevImg,
     Mat nextImg,
@@ -0,0 +1,125 @@
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+void main() {
+  cv.Mat cameraMatrix() {
+    final k = cv.Mat.zeros(3, 3, cv.MatType.CV_64FC1);
+    k.set<double>(0, 0, 842.0261028);
+    k.set<double>(0, 2, 667.7569792);
+    k.set<double>(1, 1, 707.3668897);
+    k.set<double>(1, 2, 385.56476464);
+    k.set<double>(2, 2, 1.0);
+    return k;
+  }
+
+  cv.Mat distCoeffs() {
+    return cv.Mat.fromList(1, 5, cv.MatType.CV_64FC1, <double>[
+      -3.65584802e-01,
+      1.41555815e-01,
+      -2.62985819e-03,
+      2.05841873e-04,
+      -2.35021914e-02,
+    ]);
+  }
+
+  test('cv.RemapCache undistort', () async {
+    final img = cv.imread("test/images/distortion.jpg", flags: cv.IMREAD_UNCHANGED);
+    expect(img.isEmpty, false);
+
+    final k = cameraMatrix();
+    final d = distCoeffs();
+    final (newC, _) = cv.getOptimalNewCameraMatrix(k, d, (img.cols, img.rows), 1);
+
+    final cache = cv.RemapCache();
+    expect(cache.isEmpty, true);
+    expect(() => cache.apply(img), throwsException);
+
+    expect(cache.initUndistortRectifyMap(k, d, (img.cols, img.rows), newCameraMatrix: newC), true);
+    expect(cache.isEmpty, false);
+    // same key, maps are reused
+    expect(cache.initUndistortRectifyMap(k, d, (img.cols, img.rows), newCameraMatrix: newC), false);
+    expect(
+      await cache.initUndistortRectifyMapAsync(k, d, (img.cols, img.rows), newCameraMatrix: newC),
+      false,
+    );
+
+    final (map1, map2) = cache.maps;
+    expect(map1.type, cv.MatType.CV_16SC2);
+    expect(map2.type, cv.MatType.CV_16UC1);
+    expect((map1.cols, map1.rows), (img.cols, img.rows));
+
+    final dst = cache.apply(img);
+    expect(dst.isEmpty, false);
+    expect(dst.size, img.size);
+
+    // must match remap with float maps
+    final (fmap1, fmap2) = cv.initUndistortRectifyMap(k, d, cv.Mat.empty(), newC, (img.cols, img.rows), 5);
+    final expected = cv.remap(img, fmap1, fmap2, cv.INTER_LINEAR);
+    final diff = cv.absDiff(dst, expected);
+    expect(cv.mean(diff).val1, lessThan(1.0));
+
+    final dst1 = await cache.applyAsync(img);
+    expect(dst1.isEmpty, false);
+
+    // key changed, maps are rebuilt
+    d.set<double>(0, 4, 0.0);
+    expect(cache.initUndistortRectifyMap(k, d, (img.cols, img.rows), newCameraMatrix: newC), true);
+
+    cache.release();
+    expect(cache.isEmpty, true);
+    cache.dispose();
+  });
+
+  test('cv.RemapCache warp', () async {
+    final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_COLOR);
+    expect(img.isEmpty, false);
+    final dsize = (img.cols ~/ 2, img.rows ~/ 2);
+
+    final cache = cv.RemapCache(interpolation: cv.INTER_LINEAR, borderValue: cv.Scalar.all(0));
+    {
+      final M = cv.getRotationMatrix2D(cv.Point2f(img.cols / 2, img.rows / 2), 30, 0.5);
+      expect(cache.initWarpAffine(M, dsize), true);
+      expect(cache.initWarpAffine(M, dsize), false);
+      expect(cache.initWarpAffine(M, dsize, inverseMap: true), true);
+      expect(cache.initWarpAffine(M, dsize), true);
+
+      final dst = cache.apply(img);
+      expect(dst.size, [dsize.$2, dsize.$1]);
+      final expected = cv.warpAffine(img, M, dsize);
+      expect(cv.mean(cv.absDiff(dst, expected)).val1, lessThan(1.0));
+    }
+
+    {
+      final src = cv.VecPoint2f.fromList([
+        cv.Point2f(0, 0),
+        cv.Point2f(img.cols - 1, 0),
+        cv.Point2f(img.cols - 1, img.rows - 1),
+        cv.Point2f(0, img.rows - 1),
+      ]);
+      final dst = cv.VecPoint2f.fromList([
+        cv.Point2f(10, 20),
+        cv.Point2f(dsize.$1 - 30, 5),
+        cv.Point2f(dsize.$1 - 1, dsize.$2 - 1),
+        cv.Point2f(0, dsize.$2 - 10),
+      ]);
+      final H = cv.getPerspectiveTransform2f(src, dst);
+      expect(cache.initWarpPerspective(H, dsize), true);
+      expect(cache.initWarpPerspective(H, dsize), false);
+
+      final out = await cache.applyAsync(img);
+      expect(out.size, [dsize.$2, dsize.$1]);
+      final expected = cv.warpPerspective(img, H, dsize);
+      expect(cv.mean(cv.absDiff(out, expected)).val1, lessThan(1.0));
+    }
+
+    final nearest = cv.RemapCache(interpolation: cv.INTER_NEAREST);
+    final M = cv.Mat.fromList(2, 3, cv.MatType.CV_64FC1, <double>[1, 0, 5, 0, 1, 5]);
+    expect(nearest.initWarpAffine(M, dsize), true);
+    final (map1, map2) = nearest.maps;
+    expect(map1.type, cv.MatType.CV_16SC2);
+    expect(map2.isEmpty, true);
+
+    cache.dispose();
+    nearest.dispose();
+  });
+}
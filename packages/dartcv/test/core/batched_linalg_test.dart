@@ -0,0 +1,105 @@
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+cv.Mat pack(cv.Mat rows, int r, int c) => rows.reshapeTo(1, [rows.rows, r, c]);
+
+cv.Mat item(cv.Mat batch, int i) {
+  final sizes = batch.size;
+  return batch.reshapeTo(1, [sizes[0], sizes[1] * sizes[2]]).row(i).reshape(1, sizes[1]);
+}
+
+void main() {
+  test('cv.gemmBatched', () async {
+    const n = 200;
+    for (final (m, type) in [(3, cv.MatType.CV_64FC1), (4, cv.MatType.CV_32FC1), (5, cv.MatType.CV_64FC1)]) {
+      final a = pack(cv.Mat.randu(n, m * m, type), m, m);
+      final b = pack(cv.Mat.randu(n, m * m, type), m, m);
+      final c = pack(cv.Mat.randu(n, m * m, type), m, m);
+      final dst = cv.gemmBatched(a, b, 2, c, 0.5, flags: cv.GEMM_2_T);
+      expect(dst.size.toList(), [n, m, m]);
+      for (final i in [0, 17, n - 1]) {
+        final expected = cv.gemm(item(a, i), item(b, i), 2, item(c, i), 0.5, flags: cv.GEMM_2_T);
+        expect(cv.norm1(item(dst, i), expected, normType: cv.NORM_INF), closeTo(0, 1e-4));
+      }
+    }
+
+    // one 3x4 matrix broadcast against 4x2 matrices
+    final t = cv.Mat.randu(3, 4, cv.MatType.CV_64FC1);
+    final p = pack(cv.Mat.randu(50, 8, cv.MatType.CV_64FC1), 4, 2);
+    final tp = await cv.gemmBatchedAsync(t, p, 1, cv.Mat.empty(), 0);
+    expect(tp.size.toList(), [50, 3, 2]);
+    final expected = cv.gemm(t, item(p, 9), 1, cv.Mat.empty(), 0);
+    expect(cv.norm1(item(tp, 9), expected, normType: cv.NORM_INF), closeTo(0, 1e-9));
+
+    expect(() => cv.gemmBatched(t, t, 1, cv.Mat.empty(), 0), throwsException);
+  });
+
+  test('cv.invertBatched and cv.solveBatched', () async {
+    const n = 100;
+    for (final m in [2, 3, 4, 6]) {
+      final a = pack(cv.Mat.randu(n, m * m, cv.MatType.CV_64FC1), m, m);
+      // a singular item
+      item(a, 5).setTo(cv.Scalar.all(1));
+      final (status, inv) = cv.invertBatched(a);
+      expect((status.rows, status.type), (n, cv.MatType.CV_64FC1));
+      expect(status.at<double>(5, 0), 0);
+      expect(cv.countNonZero(item(inv, 5)), 0);
+      for (final i in [0, 42, n - 1]) {
+        expect(status.at<double>(i, 0), 1);
+        final (_, expected) = cv.invert(item(a, i));
+        expect(cv.norm1(item(inv, i), expected, normType: cv.NORM_INF), closeTo(0, 1e-6));
+      }
+
+      final b = pack(cv.Mat.randu(n, m * 2, cv.MatType.CV_64FC1), m, 2);
+      final (solved, x) = await cv.solveBatchedAsync(a, b);
+      expect((solved.type, solved.at<int>(5, 0), solved.at<int>(42, 0)), (cv.MatType.CV_8UC1, 0, 1));
+      final (_, expected) = cv.solve(item(a, 42), item(b, 42));
+      expect(cv.norm1(item(x, 42), expected, normType: cv.NORM_INF), closeTo(0, 1e-6));
+    }
+
+    // small but well conditioned items are not singular, like cv.invert
+    final tiny = pack(
+      cv.Mat.fromList(1, 9, cv.MatType.CV_32FC1, <double>[2e-7, 1e-8, 0, 0, 1e-7, 0, 3e-8, 0, 3e-7]),
+      3,
+      3,
+    );
+    final (tinyStatus, tinyInv) = cv.invertBatched(tiny);
+    final (tinyExpectedStatus, tinyExpected) = cv.invert(item(tiny, 0));
+    expect(tinyStatus.at<double>(0, 0), tinyExpectedStatus);
+    expect(tinyStatus.at<double>(0, 0), 1);
+    final tinyError = cv.norm1(item(tinyInv, 0), tinyExpected, normType: cv.NORM_RELATIVE | cv.NORM_INF);
+    expect(tinyError, lessThan(1e-5));
+
+    // least squares through the fallback
+    final a = pack(cv.Mat.randu(10, 12, cv.MatType.CV_32FC1), 4, 3);
+    final (status, pinv) = cv.invertBatched(a, flags: cv.DECOMP_SVD);
+    expect(status.rows, 10);
+    expect(pinv.size.toList(), [10, 3, 4]);
+  });
+
+  test('cv.SVDecompBatched', () async {
+    const n = 64;
+    final a = pack(cv.Mat.randu(n, 12, cv.MatType.CV_64FC1), 4, 3);
+    final (w, u, vt) = await cv.SVDecompBatchedAsync(a);
+    expect(w.size.toList(), [n, 3, 1]);
+    expect(u.size.toList(), [n, 4, 3]);
+    expect(vt.size.toList(), [n, 3, 3]);
+    for (final i in [0, n - 1]) {
+      final (w1, u1, vt1) = cv.SVDecomp(item(a, i));
+      expect(cv.norm1(item(w, i), w1, normType: cv.NORM_INF), closeTo(0, 1e-9));
+      // singular vectors are unique up to sign, compare the reconstruction
+      final d = cv.Mat.zeros(3, 3, cv.MatType.CV_64FC1);
+      for (var j = 0; j < 3; j++) {
+        d.set<double>(j, j, w.at<double>(i, j, 0));
+      }
+      final ud = cv.gemm(item(u, i), d, 1, cv.Mat.empty(), 0);
+      final rec = cv.gemm(ud, item(vt, i), 1, cv.Mat.empty(), 0);
+      expect(cv.norm1(rec, item(a, i), normType: cv.NORM_INF), closeTo(0, 1e-9));
+      expect((u1.rows, vt1.rows), (4, 3));
+    }
+
+    final (w2, u2, vt2) = cv.SVDecompBatched(a, flags: 2);
+    expect(cv.norm1(w2, w, normType: cv.NORM_INF), closeTo(0, 1e-9));
+    expect((u2.isEmpty, vt2.isEmpty), (true, true));
+  });
+}
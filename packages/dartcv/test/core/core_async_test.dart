@@ -631,6 +631,15 @@ void main() async {
     expect(dst.at<int>(0, 0), 2);
   });
 
+  test('cv.topK async', () async {
+    final src = cv.Mat.randu(1000, 30, cv.MatType.CV_64FC1);
+    final (values, indices) = await cv.topKAsync(src, 3, flags: cv.SORT_EVERY_COLUMN + cv.SORT_ASCENDING);
+    expect((values.rows, values.cols, indices.rows, indices.cols), (3, 30, 3, 30));
+    final sorted = await cv.sortAsync(src, cv.SORT_EVERY_COLUMN);
+    expect(cv.norm1(values, sorted.rowRange(0, 3), normType: cv.NORM_INF), 0);
+    expect(src.at<double>(indices.at<int>(2, 11), 11), values.at<double>(2, 11));
+  });
+
   test('cv.split async', () async {
     final src = await cv.imreadAsync("test/images/lenna.png", flags: cv.IMREAD_COLOR);
     final chans = await cv.splitAsync(src);
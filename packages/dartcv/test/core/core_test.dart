@@ -909,6 +909,46 @@ void main() async {
     final dst = cv.sortIdx(src, cv.SORT_EVERY_ROW + cv.SORT_DESCENDING);
     expect(dst.isEmpty, false);
     expect(dst.at<int>(0, 0), 2);
+
+    // in place, dst is reallocated as CV_32S
+    cv.sortIdx(src, cv.SORT_EVERY_ROW + cv.SORT_DESCENDING, dst: src);
+    expect(src.type, cv.MatType.CV_32SC1);
+    expect([src.at<int>(1, 0), src.at<int>(1, 1), src.at<int>(1, 2)], [2, 1, 0]);
+  });
+
+  test('cv.sort parallel', () {
+    final src = cv.Mat.randu(300, 500, cv.MatType.CV_32FC1);
+    final rows = cv.sort(src, cv.SORT_EVERY_ROW + cv.SORT_DESCENDING);
+    final cols = cv.sort(src, cv.SORT_EVERY_COLUMN);
+    final idx = cv.sortIdx(src, cv.SORT_EVERY_COLUMN);
+    for (final i in [0, 123, 299]) {
+      for (var j = 1; j < 300; j++) {
+        expect(rows.at<double>(i, j - 1), greaterThanOrEqualTo(rows.at<double>(i, j)));
+        expect(cols.at<double>(j - 1, i), lessThanOrEqualTo(cols.at<double>(j, i)));
+        expect(src.at<double>(idx.at<int>(j, i), i), cols.at<double>(j, i));
+      }
+    }
+  });
+
+  test('cv.topK', () {
+    final src = cv.Mat.randu(200, 1000, cv.MatType.CV_32FC1);
+    final (values, indices) = cv.topK(src, 5);
+    expect((values.rows, values.cols, values.type), (200, 5, cv.MatType.CV_32FC1));
+    expect((indices.rows, indices.cols, indices.type), (200, 5, cv.MatType.CV_32SC1));
+    final sorted = cv.sort(src, cv.SORT_EVERY_ROW + cv.SORT_DESCENDING);
+    expect(cv.norm1(values, sorted.colRange(0, 5), normType: cv.NORM_INF), 0);
+    for (var j = 0; j < 5; j++) {
+      expect(src.at<double>(7, indices.at<int>(7, j)), values.at<double>(7, j));
+    }
+
+    // k smallest of every column, ties go to the lower index
+    final u8 = cv.Mat.fromList(4, 3, cv.MatType.CV_8UC1, [3, 1, 0, 2, 1, 0, 3, 5, 0, 0, 2, 0]);
+    final (v, i) = cv.topK(u8, 2, flags: cv.SORT_EVERY_COLUMN + cv.SORT_ASCENDING);
+    expect((v.rows, v.cols), (2, 3));
+    expect(List.generate(6, (n) => v.at<int>(n ~/ 3, n % 3)), [0, 1, 0, 2, 1, 0]);
+    expect(List.generate(6, (n) => i.at<int>(n ~/ 3, n % 3)), [3, 0, 0, 1, 1, 1]);
+
+    expect(() => cv.topK(src, 1001), throwsException);
   });
 
   test('cv.split', () {
@@ -0,0 +1,52 @@
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+void main() {
+  test('cv.DFTPlan', () async {
+    final src = cv.Mat.randu(100, 120, cv.MatType.CV_32FC1);
+    final plan = cv.DFTPlan((120, 100), cv.MatType.CV_32FC1, flags: cv.DFT_COMPLEX_OUTPUT);
+    expect(plan.size, (120, 100));
+    expect((plan.type, plan.dstType), (cv.MatType.CV_32FC1, cv.MatType.CV_32FC2));
+
+    final expected = cv.dft(src, flags: cv.DFT_COMPLEX_OUTPUT);
+    final spectrum = plan.execute(src);
+    expect(spectrum.type, cv.MatType.CV_32FC2);
+    expect(cv.norm1(spectrum, expected, normType: cv.NORM_INF), closeTo(0, 1e-2));
+    // reused
+    final spectrum1 = await plan.executeAsync(src, dst: spectrum);
+    expect(cv.norm1(spectrum1, expected, normType: cv.NORM_INF), closeTo(0, 1e-2));
+
+    final inverse = cv.DFTPlan(
+      (120, 100),
+      cv.MatType.CV_32FC2,
+      flags: cv.DFT_INVERSE | cv.DFT_SCALE | cv.DFT_REAL_OUTPUT,
+    );
+    expect(inverse.dstType, cv.MatType.CV_32FC1);
+    final back = inverse.execute(spectrum);
+    expect(cv.norm1(back, src, normType: cv.NORM_INF), closeTo(0, 1e-2));
+
+    expect(() => plan.execute(cv.Mat.randu(50, 50, cv.MatType.CV_32FC1)), throwsException);
+    expect(() => plan.execute(cv.Mat.randu(100, 120, cv.MatType.CV_64FC1)), throwsException);
+    expect(() => cv.DFTPlan((10, 10), cv.MatType.CV_8UC1), throwsException);
+    plan.dispose();
+    inverse.dispose();
+  });
+
+  test('cv.DFTPlan pad and batch', () async {
+    final plan = cv.DFTPlan((97, 61), cv.MatType.CV_64FC1, pad: true);
+    final (width, height) = plan.size;
+    expect((width, height), (cv.getOptimalDFTSize(97), cv.getOptimalDFTSize(61)));
+
+    final images = List.generate(8, (i) => cv.Mat.randu(61, 97, cv.MatType.CV_64FC1)).cvd;
+    final spectra = await plan.executeBatchAsync(images);
+    expect(spectra.length, 8);
+    for (var i = 0; i < 8; i++) {
+      final padded = cv.copyMakeBorder(images[i], 0, height - 61, 0, width - 97, cv.BORDER_CONSTANT);
+      final expected = cv.dft(padded);
+      expect((spectra[i].rows, spectra[i].cols), (height, width));
+      expect(cv.norm1(spectra[i], expected, normType: cv.NORM_INF), closeTo(0, 1e-6));
+    }
+    expect(plan.executeBatch(cv.VecMat()).length, 0);
+    plan.dispose();
+  });
+}
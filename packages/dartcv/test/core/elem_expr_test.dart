@@ -0,0 +1,56 @@
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+void main() {
+  test('cv.ElemExpr', () async {
+    final a = cv.Mat.randu(240, 320, cv.MatType.CV_8UC3, high: cv.Scalar.all(255));
+    final b = cv.Mat.randu(240, 320, cv.MatType.CV_8UC3, high: cv.Scalar.all(255));
+
+    final expr = cv.ElemExpr();
+    final na = expr.input(a), nb = expr.input(b);
+    // convertScaleAbs((a - b) * 2 + 10) in one pass
+    final root = ((na - nb) * 2 + 10).abs();
+    final dst = expr.evaluate(root, dtype: cv.MatType.CV_8U);
+    expect((dst.rows, dst.cols, dst.type), (240, 320, cv.MatType.CV_8UC3));
+    final expected = cv.convertScaleAbs(cv.addWeighted(a, 2, b, -2, 10, dtype: cv.MatType.CV_32F));
+    expect(cv.norm1(dst, expected, normType: cv.NORM_INF), 0);
+
+    // min, max, compare and per-channel scalars
+    final clamped = await expr.evaluateAsync(na.max(nb).min(cv.Scalar(100, 150, 200)));
+    final upper = cv.Mat.fromScalar(240, 320, cv.MatType.CV_8UC3, cv.Scalar(100, 150, 200));
+    expect(cv.norm1(clamped, cv.min(cv.max(a, b), upper), normType: cv.NORM_INF), 0);
+    final mask = expr.evaluate(na > nb);
+    expect(cv.norm1(mask, cv.compare(a, b, cv.CMP_GT), normType: cv.NORM_INF), 0);
+
+    final quotient = expr.evaluate(na / (nb + 1), dtype: cv.MatType.CV_32F);
+    final expectedQuotient = cv.divide(
+      a.convertTo(cv.MatType.CV_32FC3),
+      b.convertTo(cv.MatType.CV_32FC3, beta: 1),
+    );
+    expect(cv.norm1(quotient, expectedQuotient, normType: cv.NORM_INF), lessThan(1e-4));
+    // like cv.divide, division by zero gives 0 for integer types
+    final zeros = cv.Mat.zeros(240, 320, cv.MatType.CV_8UC3);
+    expect(cv.norm1(expr.evaluate(na / 0), zeros, normType: cv.NORM_INF), 0);
+    // and inf or NaN for float types
+    final inf = expr.evaluate(na / 0, dtype: cv.MatType.CV_32F);
+    expect(inf.atVec<cv.Vec3f>(0, 0).val.every((e) => e.isInfinite || e.isNaN), true);
+
+    // the intermediate cast saturates like a u8 subtract
+    final sat = expr.evaluate((na - nb).cast(cv.MatType.CV_8U) + 0);
+    expect(cv.norm1(sat, cv.subtract(a, b), normType: cv.NORM_INF), 0);
+
+    // same expression on new inputs
+    expr.setInput(nb, zeros);
+    final dst1 = expr.evaluate(root);
+    expect(cv.norm1(dst1, cv.convertScaleAbs(a, alpha: 2, beta: 10), normType: cv.NORM_INF), 0);
+
+    expect(() => expr.setInput(root, zeros), throwsException);
+    expr.setInput(nb, cv.Mat.zeros(10, 10, cv.MatType.CV_8UC3));
+    expect(() => expr.evaluate(root), throwsException);
+    expect(() => expr.evaluate(expr.constant(1)), throwsException);
+    expect(expr.length, greaterThan(2));
+    expr.clear();
+    expect(expr.length, 0);
+    expr.dispose();
+  });
+}
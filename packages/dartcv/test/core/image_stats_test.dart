@@ -0,0 +1,74 @@
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+void main() {
+  test('cv.imageStats', () async {
+    final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_COLOR);
+    final stats = cv.imageStats(img, histBins: 8);
+    expect((stats.stats.rows, stats.stats.cols), (3, 13));
+    expect((stats.hist.rows, stats.hist.cols), (3, 8));
+
+    final (mean, stddev) = cv.meanStdDev(img);
+    final sum = cv.sum(img);
+    final channels = cv.split(img);
+    for (var c = 0; c < 3; c++) {
+      final ch = channels[c];
+      expect(stats.count(channel: c), img.rows * img.cols);
+      expect(stats.sum(channel: c), closeTo(sum.val[c], 1e-6));
+      expect(stats.mean(channel: c), closeTo(mean.val[c], 1e-6));
+      expect(stats.stddev(channel: c), closeTo(stddev.val[c], 1e-6));
+
+      final (minVal, maxVal, minLoc, maxLoc) = cv.minMaxLoc(ch);
+      expect((stats.min(channel: c), stats.max(channel: c)), (minVal, maxVal));
+      expect((stats.minLoc(channel: c), stats.maxLoc(channel: c)), (minLoc, maxLoc));
+
+      expect(stats.nonZero(channel: c), cv.countNonZero(ch));
+      expect(stats.normL1(channel: c), closeTo(cv.norm(ch, normType: cv.NORM_L1), 1e-6));
+      expect(stats.normL2(channel: c), closeTo(cv.norm(ch, normType: cv.NORM_L2), 1e-6));
+
+      final hist = cv.calcHist(cv.VecMat.fromList([ch]), [0].i32, cv.Mat.empty(), [8].i32, [0.0, 256.0].f32);
+      expect(stats.histogram(channel: c), List.generate(8, (i) => hist.at<double>(i, 0).toInt()));
+    }
+    stats.dispose();
+  });
+
+  test('cv.imageStats grid and mask', () async {
+    final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_GRAYSCALE);
+    final mask = cv.Mat.zeros(img.rows, img.cols, cv.MatType.CV_8UC1);
+    cv.rectangle(mask, cv.Rect(0, 0, img.cols ~/ 2, img.rows), cv.Scalar.all(255), thickness: -1);
+
+    final stats = await cv.imageStatsAsync(
+      img,
+      flags: cv.STATS_MEAN | cv.STATS_MINMAX,
+      mask: mask,
+      grid: (2, 3),
+    );
+    expect((stats.stats.rows, stats.hist.isEmpty), (6, true));
+    for (var gy = 0; gy < 3; gy++) {
+      for (var gx = 0; gx < 2; gx++) {
+        final y0 = img.rows * gy ~/ 3, y1 = img.rows * (gy + 1) ~/ 3;
+        final x0 = img.cols * gx ~/ 2, x1 = img.cols * (gx + 1) ~/ 2;
+        final rect = cv.Rect(x0, y0, x1 - x0, y1 - y0);
+        final roi = img.region(rect);
+        final roiMask = mask.region(rect);
+        expect(stats.sum(cellX: gx, cellY: gy), 0); // not requested
+
+        if (gx == 1) {
+          // fully masked out
+          expect(stats.count(cellX: gx, cellY: gy), 0);
+          expect(stats.minLoc(cellX: gx, cellY: gy), cv.Point(-1, -1));
+          continue;
+        }
+        expect(stats.mean(cellX: gx, cellY: gy), closeTo(cv.mean(roi, mask: roiMask).val1, 1e-6));
+        final (minVal, maxVal, minLoc, maxLoc) = cv.minMaxLoc(roi, mask: roiMask);
+        expect((stats.min(cellX: gx, cellY: gy), stats.max(cellX: gx, cellY: gy)), (minVal, maxVal));
+        expect(stats.minLoc(cellX: gx, cellY: gy), cv.Point(minLoc.x + x0, minLoc.y + y0));
+        expect(stats.maxLoc(cellX: gx, cellY: gy), cv.Point(maxLoc.x + x0, maxLoc.y + y0));
+      }
+    }
+
+    expect(() => cv.imageStats(img, grid: (0, 1)), throwsException);
+    expect(() => cv.imageStats(img, histRange: (10, 10)), throwsException);
+    stats.dispose();
+  });
+}
@@ -0,0 +1,82 @@
+import 'dart:io';
+import 'dart:math' as math;
+
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+void main() {
+  test('cv.IncrementalPCA', () async {
+    // 600 samples of 8 dims with decreasing variances
+    final rng = math.Random(0);
+    final data = List.generate(600 * 8, (i) => (rng.nextDouble() - 0.5) * (8 - i % 8) * 10 + i % 8);
+    final samples = cv.Mat.fromList(600, 8, cv.MatType.CV_64FC1, data);
+
+    final pca = cv.IncrementalPCA(maxComponents: 3);
+    expect((pca.maxComponents, pca.dims, pca.numSamples), (3, 0, 0));
+    expect(() => pca.mean, throwsException);
+    for (var i = 0; i < 600; i += 100) {
+      final batch = samples.region(cv.Rect(0, i, 8, 100));
+      if (i == 0) {
+        pca.partialFit(batch);
+      } else {
+        await pca.partialFitAsync(batch);
+      }
+    }
+    expect((pca.dims, pca.numSamples), (8, 600));
+
+    final mean0 = cv.Mat.empty();
+    final (mean, eigenvalues, eigenvectors) = cv.PCACompute(samples, mean0, maxComponents: 3);
+    expect(cv.norm1(pca.mean, mean, normType: cv.NORM_INF), closeTo(0, 1e-9));
+    expect(cv.norm1(pca.eigenvalues, eigenvalues, normType: cv.NORM_INF), closeTo(0, 1e-6));
+    expect((pca.eigenvectors.rows, pca.eigenvectors.cols), (3, 8));
+    // components are the same up to their sign
+    for (var r = 0; r < 3; r++) {
+      var dot = 0.0;
+      for (var c = 0; c < 8; c++) {
+        dot += pca.eigenvectors.at<double>(r, c) * eigenvectors.at<double>(r, c);
+      }
+      expect(dot.abs(), closeTo(1, 1e-6));
+    }
+
+    final projected = await pca.projectAsync(samples);
+    expect((projected.rows, projected.cols), (600, 3));
+    final reconstructed = pca.backProject(projected);
+    final (_, projected0) = cv.PCAProject(samples, mean, eigenvectors);
+    final reconstructed0 = cv.PCABackProject(projected0, mean, eigenvectors);
+    expect(cv.norm1(reconstructed, reconstructed0, normType: cv.NORM_INF), closeTo(0, 1e-6));
+
+    // CV_32F batches are converted, within float precision
+    final pca32 = cv.IncrementalPCA(maxComponents: 3);
+    pca32.partialFit(samples.convertTo(cv.MatType.CV_32FC1));
+    expect(cv.norm1(pca32.mean, mean, normType: cv.NORM_INF), closeTo(0, 1e-5));
+    pca32.dispose();
+
+    expect(() => pca.partialFit(cv.Mat.zeros(10, 5, cv.MatType.CV_32FC1)), throwsException);
+    pca.dispose();
+  });
+
+  test('cv.IncrementalPCA save and load', () async {
+    final samples = cv.Mat.randu(200, 16, cv.MatType.CV_32FC1);
+    final pca = cv.IncrementalPCA(maxComponents: 4);
+    pca.partialFit(samples);
+
+    final dir = Directory.systemTemp.createTempSync("dartcv_ipca");
+    final path = "${dir.path}/pca.yml";
+    pca.save(path);
+
+    final loaded = cv.IncrementalPCA.load(path);
+    expect((loaded.maxComponents, loaded.dims, loaded.numSamples), (4, 16, 200));
+    expect(cv.norm1(pca.project(samples), loaded.project(samples), normType: cv.NORM_INF), closeTo(0, 1e-9));
+
+    // keeps fitting after load
+    loaded.partialFit(samples);
+    pca.partialFit(samples);
+    expect(loaded.numSamples, 400);
+    expect(cv.norm1(pca.eigenvalues, loaded.eigenvalues, normType: cv.NORM_INF), closeTo(0, 1e-9));
+
+    expect(() => cv.IncrementalPCA.load("${dir.path}/not_exist.yml"), throwsException);
+    dir.deleteSync(recursive: true);
+    pca.dispose();
+    loaded.dispose();
+  });
+}
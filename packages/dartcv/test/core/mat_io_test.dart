@@ -0,0 +1,73 @@
+import 'dart:io';
+
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+void main() {
+  late Directory dir;
+  setUpAll(() => dir = Directory.systemTemp.createTempSync("dartcv_mat_io"));
+  tearDownAll(() => dir.deleteSync(recursive: true));
+
+  test('cv.saveMat, cv.loadMat', () async {
+    final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_COLOR);
+    final path = "${dir.path}/lenna.bin";
+    cv.saveMat(path, img);
+    // 64 bytes file header, 64 bytes Mat header + shape, payload padded to 64 bytes
+    expect(File(path).lengthSync(), 64 + 64 + 64 + (img.total * 3 + 63) ~/ 64 * 64);
+
+    for (final mmap in [false, true]) {
+      final loaded = cv.loadMat(path, mmap: mmap);
+      expect((loaded.rows, loaded.cols, loaded.type), (img.rows, img.cols, img.type));
+      expect(cv.norm1(img, loaded, normType: cv.NORM_INF), 0);
+    }
+
+    // copy-on-write, the file is not modified
+    final mapped = await cv.loadMatAsync(path, mmap: true);
+    mapped.setTo(cv.Scalar.all(0));
+    expect(cv.norm1(img, cv.loadMat(path), normType: cv.NORM_INF), 0);
+
+    // a region is not continuous
+    final roi = img.region(cv.Rect(10, 20, 100, 50));
+    await cv.saveMatAsync(path, roi);
+    expect(cv.norm1(roi, cv.loadMat(path, mmap: true), normType: cv.NORM_INF), 0);
+  });
+
+  test('cv.saveMats, cv.loadMats', () async {
+    final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_COLOR);
+    final blob = cv.blobFromImage(img, size: (64, 32));
+    final f16 = cv.Mat.fromList(2, 3, cv.MatType.CV_16FC1, <double>[0.5, 1.0, 2.0, -3.0, 1024.0, 0.25]);
+    final mats = [blob, cv.Mat.empty(), f16, cv.Mat.zeros(0, 5, cv.MatType.CV_8UC1)].cvd;
+    final path = "${dir.path}/mats.bin";
+    await cv.saveMatsAsync(path, mats);
+
+    for (final mmap in [false, true]) {
+      final loaded = await cv.loadMatsAsync(path, mmap: mmap);
+      expect(loaded.length, 4);
+      expect(loaded[0].size.toList(), [1, 3, 32, 64]);
+      expect(cv.norm1(blob, loaded[0], normType: cv.NORM_INF), 0);
+      expect(loaded[1].isEmpty, true);
+      expect(loaded[2].type, cv.MatType.CV_16FC1);
+      expect(loaded[2].at<double>(1, 1), 1024);
+      expect(loaded[3].isEmpty, true);
+    }
+    expect(cv.loadMats(path).length, 4);
+  });
+
+  test('cv.loadMat errors', () {
+    final path = "${dir.path}/bad.bin";
+    File(path).writeAsStringSync("not a Mat file at all" * 10);
+    expect(() => cv.loadMat(path), throwsException);
+    expect(() => cv.loadMat("${dir.path}/not_exist.bin", mmap: true), throwsException);
+
+    final empty = "${dir.path}/empty.bin";
+    cv.saveMats(empty, cv.VecMat());
+    expect(cv.loadMats(empty).length, 0);
+    expect(() => cv.loadMat(empty), throwsException);
+
+    // truncated payload
+    cv.saveMat(path, cv.Mat.ones(100, 100, cv.MatType.CV_8UC1));
+    final bytes = File(path).readAsBytesSync();
+    File(path).writeAsBytesSync(bytes.sublist(0, bytes.length - 100));
+    expect(() => cv.loadMat(path), throwsException);
+  });
+}
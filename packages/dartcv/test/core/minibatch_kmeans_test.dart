@@ -0,0 +1,70 @@
+import 'dart:math' as math;
+
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+void main() {
+  test('cv.MiniBatchKMeans', () async {
+    // 3 well separated blobs of 1000 points
+    final truth = [(20.0, 20.0), (200.0, 40.0), (100.0, 180.0)];
+    final rng = math.Random(0);
+    final data = <double>[];
+    for (var i = 0; i < 3000; i++) {
+      final (x, y) = truth[i % 3];
+      data.addAll([x + rng.nextDouble() * 10 - 5, y + rng.nextDouble() * 10 - 5]);
+    }
+    final samples = cv.Mat.fromList(3000, 2, cv.MatType.CV_32FC1, data);
+
+    final kmeans = cv.MiniBatchKMeans(3, batchSize: 256);
+    expect((kmeans.k, kmeans.batchSize), (3, 256));
+    final (compactness, labels, centers) = kmeans.fit(samples);
+    expect((labels.rows, labels.cols, labels.type), (3000, 1, cv.MatType.CV_32SC1));
+    expect((centers.rows, centers.cols), (3, 2));
+    expect(kmeans.iterations, greaterThan(0));
+    // every point within 5 * sqrt(2) of its center
+    expect(compactness, lessThan(3000 * 50));
+
+    for (final (x, y) in truth) {
+      final dist = List.generate(
+        3,
+        (c) => (centers.at<double>(c, 0) - x).abs() + (centers.at<double>(c, 1) - y).abs(),
+      );
+      expect(dist.reduce(math.min), lessThan(3));
+    }
+    // points of the same blob share a label
+    for (var i = 3; i < 3000; i++) {
+      expect(labels.at<int>(i, 0), labels.at<int>(i % 3, 0));
+    }
+
+    // predict gives the same labels
+    final (compactness1, labels1) = kmeans.predict(samples);
+    expect(compactness1, closeTo(compactness, 1e-6));
+    expect(cv.norm1(labels, labels1, normType: cv.NORM_INF), 0);
+
+    // warm start on shifted data keeps the center order
+    final shifted = samples.convertTo(cv.MatType.CV_32FC1, beta: 3);
+    final (_, labels2, centers2) = await kmeans.fitAsync(shifted, warmStart: true);
+    expect(cv.norm1(labels, labels2, normType: cv.NORM_INF), 0);
+    for (var c = 0; c < 3; c++) {
+      expect(centers2.at<double>(c, 0), closeTo(centers.at<double>(c, 0) + 3, 1));
+    }
+    kmeans.dispose();
+  });
+
+  test('cv.MiniBatchKMeans image', () async {
+    final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_COLOR);
+    final kmeans = cv.MiniBatchKMeans(8);
+    final (_, labels, centers) = await kmeans.fitAsync(img);
+    expect((labels.rows, centers.rows, centers.cols), (img.rows * img.cols, 8, 3));
+
+    // a given palette
+    kmeans.centers = cv.Mat.fromList(8, 3, cv.MatType.CV_32FC1, List.generate(24, (i) => i * 10.0));
+    final (_, labels1) = await kmeans.predictAsync(img);
+    expect(labels1.rows, img.rows * img.cols);
+    expect(kmeans.centers.at<double>(7, 2), 230);
+
+    expect(() => kmeans.centers = cv.Mat.zeros(3, 3, cv.MatType.CV_32FC1), throwsException);
+    expect(() => cv.MiniBatchKMeans(0), throwsException);
+    kmeans.dispose();
+  });
+}
@@ -0,0 +1,69 @@
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+void main() {
+  test('cv.RngStream fill', () async {
+    final stream = cv.RngStream(42, stream: 3);
+    expect((stream.seed, stream.stream, stream.position), (42, 3, 0));
+
+    final (low, high) = (cv.Scalar(0, 10, 100), cv.Scalar(1, 20, 200));
+    final a = stream.fill(cv.Mat.zeros(480, 640, cv.MatType.CV_32FC3), cv.RNG_DIST_UNIFORM, low, high);
+    expect(stream.position, 480 * 640 * 3);
+    final (minB, maxB, _, _) = cv.minMaxLoc(cv.extractChannel(a, 0));
+    expect(minB, greaterThanOrEqualTo(0));
+    expect(maxB, lessThan(1));
+    final mean = a.mean();
+    expect(mean.val1, closeTo(0.5, 0.01));
+    expect(mean.val2, closeTo(15, 0.1));
+    expect(mean.val3, closeTo(150, 1));
+
+    // same seed, stream and position give the same values
+    final b = cv.Mat.zeros(480, 640, cv.MatType.CV_32FC3);
+    await cv.RngStream(42, stream: 3).fillAsync(b, cv.RNG_DIST_UNIFORM, low, high);
+    expect(cv.norm1(a, b, normType: cv.NORM_INF), 0);
+    // another stream does not
+    cv.RngStream(42, stream: 4).fill(b, cv.RNG_DIST_UNIFORM, low, high);
+    expect(cv.norm1(a, b, normType: cv.NORM_INF), greaterThan(0));
+
+    // filling the two halves one after the other draws the same values
+    final c = cv.Mat.zeros(480, 640, cv.MatType.CV_32FC3);
+    final replay = cv.RngStream(42, stream: 3)..position = 0;
+    for (final rect in [cv.Rect(0, 0, 640, 240), cv.Rect(0, 240, 640, 240)]) {
+      replay.fill(c.region(rect), cv.RNG_DIST_UNIFORM, low, high);
+    }
+    expect(cv.norm1(a, c, normType: cv.NORM_INF), 0);
+
+    final n = cv.Mat.zeros(500, 500, cv.MatType.CV_64FC1);
+    stream.fill(n, cv.RNG_DIST_NORMAL, cv.Scalar.all(5), cv.Scalar.all(2));
+    final (m, sd) = cv.meanStdDev(n);
+    expect(m.val1, closeTo(5, 0.02));
+    expect(sd.val1, closeTo(2, 0.02));
+
+    final u8 = cv.Mat.zeros(100, 100, cv.MatType.CV_8UC1);
+    stream.fill(u8, cv.RNG_DIST_UNIFORM, cv.Scalar.all(0), cv.Scalar.all(4));
+    final (min8, max8, _, _) = cv.minMaxLoc(u8);
+    expect((min8, max8), (0, 3));
+
+    expect(
+      () => stream.fill(cv.Mat.zeros(2, 2, cv.MatType.CV_8UC1), 5, cv.Scalar.all(0), cv.Scalar.all(1)),
+      throwsException,
+    );
+    stream.dispose();
+  });
+
+  test('cv.RngStream shuffle', () async {
+    final values = List.generate(10000, (i) => i);
+    final mat = cv.Mat.fromList(100, 100, cv.MatType.CV_32SC1, values);
+    final shuffled = cv.randShuffle(mat.clone(), stream: cv.RngStream(7));
+    final shuffled1 = await cv.randShuffleAsync(mat.clone(), stream: cv.RngStream(7));
+    expect(cv.norm1(shuffled, shuffled1, normType: cv.NORM_INF), 0);
+    expect(cv.norm1(shuffled, mat, normType: cv.NORM_INF), greaterThan(0));
+    // a permutation
+    final sorted = List.generate(10000, (i) => shuffled.at<int>(i ~/ 100, i % 100))..sort();
+    expect(sorted, values);
+
+    final stream = cv.RngStream(7);
+    await stream.shuffleAsync(cv.Mat.zeros(3, 3, cv.MatType.CV_8UC3));
+    expect(stream.position, 9);
+  });
+}
@@ -325,6 +325,26 @@ void main() {
     vec1.dispose();
   });
 
+  test('VecF16 float32 conversions', () {
+    final points = List.generate(1000, (i) => (i - 500) / 8.0);
+    final vec = cv.VecF16.fromList(points);
+    expect(vec.length, 1000);
+    // exactly representable in float16
+    expect(vec.toFloat32List(), points);
+    expect(vec.data[8], cv.float16Inv(points[8]));
+
+    final vecF32 = vec.toVecF32();
+    expect(vecF32.toList(), points);
+    final vec1 = vecF32.toVecF16();
+    expect(vec1.data, vec.data);
+
+    // rounds to nearest
+    final vec2 = cv.VecF16.fromList([1.0 / 3, 65504, 1e6, -1e6]);
+    expect(vec2.data, [0x3555, 0x7bff, 0x7c00, 0xfc00]);
+    expect(cv.VecF16(3, 0.5).toList(), [0.5, 0.5, 0.5]);
+    expect(cv.VecF16().toFloat32List(), isEmpty);
+  });
+
   test('VecRect', () {
     final points = List.generate(100, (index) => cv.Rect(index, index, index + 10, index + 20));
     final vec = points.cvd;
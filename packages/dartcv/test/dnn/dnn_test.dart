@@ -267,6 +267,21 @@ void main() async {
     expect(cv.getBlobSize(blob), [2, 1, 480, 512]);
   });
 
+  test('cv.blobFromImage CV_16F', () {
+    final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_COLOR);
+    final blob = cv.blobFromImage(img, scalefactor: 1 / 255.0, size: (224, 224));
+    final blob16 = cv.blobFromImage(img, scalefactor: 1 / 255.0, size: (224, 224), ddepth: cv.MatType.CV_16F);
+    expect(blob16.type.depth, cv.MatType.CV_16F);
+    expect(cv.getBlobSize(blob16), [1, 3, 224, 224]);
+    final blob32 = blob16.convertTo(cv.MatType.CV_32FC1);
+    expect(cv.norm1(blob, blob32, normType: cv.NORM_INF), lessThan(1e-3));
+
+    final imgs = [img, img].cvd;
+    final blobs16 = cv.blobFromImages(imgs, ddepth: cv.MatType.CV_16F);
+    expect(blobs16.type.depth, cv.MatType.CV_16F);
+    expect(cv.getBlobSize(blobs16), [2, 3, 480, 512]);
+  });
+
   test('cv.NMSBoxes', () {
     final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_COLOR);
     expect(img.isEmpty, false);
@@ -371,6 +371,33 @@ void main() async {
     }
   });
 
+  test('cv.ORB.detectAndComputePyramid', () async {
+    final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_GRAYSCALE);
+    final pyramid = cv.ImagePyramid(levels: 8, scaleFactor: 1.2, padding: 0)..build(img);
+    final orb = cv.ORB.create();
+
+    final (kp, desc) = orb.detectAndComputePyramid(pyramid);
+    expect(kp.length, inInclusiveRange(1, 500));
+    expect((desc.rows, desc.cols), (kp.length, 32));
+    for (final k in kp) {
+      expect(k.octave, inInclusiveRange(0, 7));
+      expect(k.x, inInclusiveRange(0, img.cols));
+      expect(k.y, inInclusiveRange(0, img.rows));
+    }
+    expect(kp.map((k) => k.octave).toSet().length, greaterThan(1));
+    // settings of the ORB are restored
+    expect((orb.maxFeatures, orb.nLevels), (500, 8));
+
+    final mask = cv.Mat.zeros(img.rows, img.cols, cv.MatType.CV_8UC1);
+    mask.region(cv.Rect(0, 0, img.cols ~/ 2, img.rows)).setTo(cv.Scalar.all(255));
+    final (kp1, desc1) = await orb.detectAndComputePyramidAsync(pyramid, mask: mask);
+    expect(kp1.length, desc1.rows);
+    for (final k in kp1) {
+      expect(k.x, lessThan(img.cols / 2 + 4));
+    }
+    orb.dispose();
+  });
+
   test('cv.SimpleBlobDetector', () {
     final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_COLOR);
     expect(img.isEmpty, false);
@@ -1,6 +1,9 @@
+import 'dart:ffi' as ffi;
 import 'dart:io';
+import 'dart:typed_data';
 
 import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:ffi/ffi.dart';
 import 'package:test/test.dart';
 
 void main() async {
@@ -116,4 +119,144 @@ void main() async {
     expect(cvimgDecode.width, equals(cvImage.width));
     expect(cvimgDecode.channels, equals(cvImage.channels));
   });
+
+  test("cv2.imdecodeBuffer", () async {
+    final cvImage = cv.imread("test/images/circles.jpg", flags: cv.IMREAD_COLOR);
+    final (success, buf) = cv.imencodeVec(".png", cvImage);
+    expect(success, true);
+
+    // decoded in place into a pooled Mat
+    final dst = cv.Mat.zeros(512, 512, cv.MatType.CV_8UC3);
+    final address = dst.dataPtr.address;
+    cv.imdecodeBuffer(buf.dataPtr.cast(), buf.length, cv.IMREAD_COLOR, dst: dst);
+    expect(dst.dataPtr.address, address);
+    expect(cv.norm1(dst, cvImage, normType: cv.NORM_INF), 0);
+
+    final dst1 = await cv.imdecodeBufferAsync(buf.dataPtr.cast(), buf.length, cv.IMREAD_GRAYSCALE);
+    expect((dst1.rows, dst1.cols, dst1.channels), (512, 512, 1));
+
+    cv.imdecodeBuffer(buf.dataPtr.cast(), 16, cv.IMREAD_COLOR, dst: dst);
+    expect(dst.isEmpty, true);
+  });
+
+  test("cv2.imreadRegion, cv2.imdecodeRegion", () async {
+    const path = "test/images/circles.jpg";
+    final full = cv.imread(path, flags: cv.IMREAD_COLOR);
+    final reduced = cv.imread(path, flags: cv.IMREAD_REDUCED_COLOR_2);
+    final half = cv.imreadRegion(path, reduce: 2);
+    expect((half.rows, half.cols), (256, 256));
+    expect(cv.norm1(half, reduced, normType: cv.NORM_INF), 0);
+
+    final roi = cv.Rect(100, 50, 200, 120);
+    final crop = await cv.imreadRegionAsync(path, roi: roi);
+    expect(cv.norm1(crop, full.region(roi), normType: cv.NORM_INF), 0);
+
+    final bytes = File(path).readAsBytesSync();
+    final dst = cv.Mat.empty();
+    cv.imdecodeRegion(bytes, roi: roi, reduce: 4, dst: dst);
+    expect((dst.rows, dst.cols), (31, 50));
+    final quarter = cv.imread(path, flags: cv.IMREAD_REDUCED_COLOR_4);
+    expect(cv.norm1(dst, quarter.region(cv.Rect(25, 12, 50, 31)), normType: cv.NORM_INF), 0);
+    // a pooled dst does not keep stale pixels if the data cannot be decoded
+    cv.imdecodeRegion(bytes.sublist(0, 16), dst: dst);
+    expect(dst.isEmpty, true);
+
+    final gray = await cv.imdecodeRegionAsync(bytes, flags: cv.IMREAD_GRAYSCALE, reduce: 8);
+    expect((gray.rows, gray.cols, gray.channels), (64, 64, 1));
+
+    expect(() => cv.imreadRegion(path, reduce: 3), throwsException);
+    expect(() => cv.imreadRegion(path, roi: cv.Rect(600, 600, 10, 10)), throwsException);
+  });
+
+  test("cv2.imreadBatch, cv2.imdecodeBatch, cv2.imencodeBatch", () async {
+    final paths = ["test/images/circles.jpg", "test/images/face.jpg", "test/images/gocvlogo.png"];
+    final (mats, status) = cv.imreadBatch([...paths, "test/images/not_exist.jpg"], numThreads: 2);
+    expect(status, [cv.BATCH_CODEC_OK, cv.BATCH_CODEC_OK, cv.BATCH_CODEC_OK, cv.BATCH_CODEC_FAILED]);
+    expect(mats.length, 4);
+    expect(mats[3].isEmpty, true);
+    for (var i = 0; i < paths.length; i++) {
+      expect(cv.norm1(mats[i], cv.imread(paths[i]), normType: cv.NORM_INF), 0);
+    }
+
+    final bufs = [for (final p in paths) File(p).readAsBytesSync()];
+    final (thumbs, status1) = await cv.imdecodeBatchAsync(
+      [...bufs, Uint8List.fromList([1, 2, 3])],
+      flags: cv.IMREAD_GRAYSCALE,
+      dsize: (64, 0),
+    );
+    expect(status1, [cv.BATCH_CODEC_OK, cv.BATCH_CODEC_OK, cv.BATCH_CODEC_OK, cv.BATCH_CODEC_FAILED]);
+    for (var i = 0; i < paths.length; i++) {
+      expect((thumbs[i].cols, thumbs[i].channels), (64, 1));
+      expect(thumbs[i].rows, (mats[i].rows * 64 / mats[i].cols).round());
+    }
+
+    final (encoded, status2) = cv.imencodeBatch(".png", mats, dsize: (32, 32));
+    expect(status2, [cv.BATCH_CODEC_OK, cv.BATCH_CODEC_OK, cv.BATCH_CODEC_OK, cv.BATCH_CODEC_FAILED]);
+    expect(encoded[3].isEmpty, true);
+    final decoded = cv.imdecode(encoded[1], cv.IMREAD_COLOR);
+    expect((decoded.rows, decoded.cols), (32, 32));
+
+    final (encoded1, status3) = await cv.imencodeBatchAsync(".jpg", cv.VecMat.fromList([mats[0]]));
+    expect(status3, [cv.BATCH_CODEC_OK]);
+    expect(encoded1[0].isNotEmpty, true);
+  });
+
+  test("cv2.ImageEncoder", () async {
+    final img = cv.imread("test/images/circles.jpg");
+    final params = cv.VecI32.fromList([cv.IMWRITE_JPEG_QUALITY, 80]);
+    final encoder = cv.ImageEncoder(".jpg", params: params);
+    expect(encoder.ext, ".jpg");
+
+    final (success, data) = encoder.encode(img);
+    expect(success, true);
+    final (_, expected) = cv.imencode(".jpg", img, params: params);
+    expect(data, expected);
+    final capacity = encoder.capacity;
+    expect(capacity, greaterThanOrEqualTo(data.length));
+    expect((await encoder.encodeAsync(img)).$2, expected);
+
+    final (success1, view) = encoder.encodeView(img);
+    expect(success1, true);
+    expect(view, expected);
+    final (success2, view1) = await encoder.encodeViewAsync(img);
+    expect((success2, view1.length, encoder.capacity), (true, expected.length, capacity));
+
+    final buf = calloc<ffi.Uint8>(expected.length);
+    expect(encoder.encodeTo(img, buf, 16), (false, expected.length));
+    expect(await encoder.encodeToAsync(img, buf, expected.length), (true, expected.length));
+    expect(buf.asTypedList(expected.length), expected);
+    calloc.free(buf);
+
+    final (bufs, status) = encoder.encodeBatch(cv.VecMat.fromList([img, cv.Mat.empty(), img]));
+    expect(status, [cv.BATCH_CODEC_OK, cv.BATCH_CODEC_FAILED, cv.BATCH_CODEC_OK]);
+    expect(bufs[2], expected);
+    final (bufs1, _) = await encoder.encodeBatchAsync(cv.VecMat.fromList([img]), numThreads: 1);
+    expect(bufs1[0], expected);
+
+    encoder.dispose();
+    expect(() => cv.ImageEncoder(".not_a_format"), throwsException);
+  });
+
+  test("cv2.improbe", () async {
+    for (final path in ["test/images/circles.jpg", "test/images/gocvlogo.png", "test/images/sample.webp"]) {
+      final header = cv.improbe(path)!;
+      final img = cv.imread(path, flags: cv.IMREAD_UNCHANGED);
+      expect((header.width, header.height, header.type), (img.cols, img.rows, img.type));
+      expect((header.orientation, header.pages), (1, 1));
+
+      final bytes = File(path).readAsBytesSync();
+      expect(cv.improbeBytes(bytes).toString(), header.toString());
+      expect((await cv.improbeBytesAsync(bytes)).toString(), header.toString());
+      expect((await cv.improbeAsync(path)).toString(), header.toString());
+    }
+
+    final header = cv.improbe("test/images/gocvlogo.png")!;
+    expect((header.width, header.height, header.channels, header.depth), (400, 343, 4, cv.MatType.CV_8U));
+
+    expect(cv.improbe("test/images/not_exist.jpg"), null);
+    expect(cv.improbe("test/images/small.mp4"), null);
+    final truncated = File("test/images/circles.jpg").readAsBytesSync().sublist(0, 16);
+    expect(cv.improbeBytes(truncated), null);
+    expect(cv.improbeBytes(Uint8List(0)), null);
+  });
 }
@@ -0,0 +1,96 @@
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+void main() {
+  final gray = cv.imread("test/images/circles.jpg", flags: cv.IMREAD_GRAYSCALE);
+  final (_, binary) = cv.threshold(gray, 127, 255, cv.THRESH_BINARY_INV);
+
+  // (left, top, width, height, area) of every component, sorted
+  List<List<int>> keys(List<List<int>> stats) => stats
+    ..sort((a, b) {
+      for (var i = 0; i < a.length; i++) {
+        if (a[i] != b[i]) return a[i] - b[i];
+      }
+      return 0;
+    });
+
+  for (final connectivity in [4, 8]) {
+    test("cv.ComponentLabeler connectivity=$connectivity", () async {
+      final labels = cv.Mat.empty();
+      final ocvStats = cv.Mat.empty();
+      final centroids = cv.Mat.empty();
+      final n = cv.connectedComponentsWithStats(
+        binary,
+        labels,
+        ocvStats,
+        centroids,
+        connectivity,
+        cv.MatType.CV_32SC1.value,
+        cv.CCL_WU,
+      );
+
+      final (count, stats) = cv.ComponentLabeler.compute(binary, intensity: gray, connectivity: connectivity);
+      expect(count, n - 1);
+      expect((stats.rows, stats.cols, stats.type), (8, n - 1, cv.MatType.CV_64FC1));
+
+      final expected = keys([
+        for (var i = 1; i < n; i++) [for (var s = 0; s < 5; s++) ocvStats.at<int>(i, s)],
+      ]);
+      final actual = keys([
+        for (var i = 0; i < count; i++) [for (var s = 0; s < 5; s++) stats.at<double>(s, i).toInt()],
+      ]);
+      expect(actual, expected);
+
+      // centroid and mean intensity of the first component
+      final first = stats.at<double>(cv.CC_STAT_AREA, 0).toInt();
+      final label = List.generate(n - 1, (i) => i + 1).firstWhere(
+        (i) =>
+            ocvStats.at<int>(i, cv.CC_STAT_LEFT) == stats.at<double>(cv.CC_STAT_LEFT, 0).toInt() &&
+            ocvStats.at<int>(i, cv.CC_STAT_TOP) == stats.at<double>(cv.CC_STAT_TOP, 0).toInt() &&
+            ocvStats.at<int>(i, cv.CC_STAT_AREA) == first,
+      );
+      expect(stats.at<double>(cv.CC_STAT_CX, 0), closeTo(centroids.at<double>(label, 0), 1e-6));
+      expect(stats.at<double>(cv.CC_STAT_CY, 0), closeTo(centroids.at<double>(label, 1), 1e-6));
+      final mask = cv.inRangebyScalar(labels, cv.Scalar.all(label.toDouble()), cv.Scalar.all(label.toDouble()));
+      expect(stats.at<double>(cv.CC_STAT_MEAN, 0), closeTo(cv.mean(gray, mask: mask).val1, 1e-6));
+
+      // streaming in strips gives the same stats
+      final labeler = cv.ComponentLabeler(connectivity: connectivity);
+      for (var y = 0; y < binary.rows; y += 7) {
+        final end = y + 7 < binary.rows ? y + 7 : binary.rows;
+        await labeler.pushAsync(binary.rowRange(y, end), intensity: gray.rowRange(y, end));
+      }
+      expect(labeler.rows, binary.rows);
+      final (count1, stats1) = await labeler.finishAsync();
+      expect(count1, count);
+      expect(cv.norm1(stats1, stats, normType: cv.NORM_INF), closeTo(0, 1e-9));
+      expect(labeler.rows, 0);
+
+      // small components are dropped natively
+      labeler.minArea = 100;
+      expect(labeler.minArea, 100);
+      labeler.push(binary);
+      final (count2, stats2) = labeler.finish();
+      var big = 0;
+      for (var i = 1; i < n; i++) {
+        if (ocvStats.at<int>(i, cv.CC_STAT_AREA) >= 100) big++;
+      }
+      expect(count2, big);
+      for (var i = 0; i < count2; i++) {
+        expect(stats2.at<double>(cv.CC_STAT_AREA, i), greaterThanOrEqualTo(100));
+      }
+      labeler.dispose();
+    });
+  }
+
+  test("cv.ComponentLabeler empty", () {
+    final labeler = cv.ComponentLabeler(connectivity: 4);
+    expect(labeler.connectivity, 4);
+    labeler.push(cv.Mat.zeros(10, 10, cv.MatType.CV_8UC1));
+    final (count, stats) = labeler.finish();
+    expect(count, 0);
+    expect(stats.isEmpty, true);
+    expect(() => cv.ComponentLabeler(connectivity: 6), throwsException);
+    labeler.dispose();
+  });
+}
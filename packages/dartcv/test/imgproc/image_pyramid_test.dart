@@ -0,0 +1,48 @@
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+void main() {
+  test("cv.ImagePyramid", () async {
+    final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_GRAYSCALE);
+    final pyramid = cv.ImagePyramid(levels: 4, padding: 8);
+    expect(pyramid.isEmpty, true);
+    expect((pyramid.numLevels, pyramid.scaleFactor, pyramid.padding), (4, 2.0, 8));
+    expect(pyramid.borderType, cv.BORDER_REFLECT_101);
+
+    pyramid.build(img);
+    expect(pyramid.isEmpty, false);
+    final levels = pyramid.levels;
+    expect(levels.length, 4);
+
+    // same as successive pyrDown
+    var expected = img;
+    for (var i = 0; i < 4; i++) {
+      final level = pyramid.level(i);
+      expect((level.rows, level.cols), (expected.rows, expected.cols));
+      expect(cv.norm1(level, expected, normType: cv.NORM_INF), 0);
+      expected = cv.pyrDown(expected);
+    }
+    expect(() => pyramid.level(4), throwsException);
+
+    // buffers are reused for frames of the same size
+    final level1 = pyramid.level(1);
+    final flipped = cv.flip(img, 1);
+    await pyramid.buildAsync(flipped);
+    expect(cv.norm1(level1, cv.pyrDown(flipped), normType: cv.NORM_INF), 0);
+    pyramid.dispose();
+  });
+
+  test("cv.ImagePyramid scaleFactor", () {
+    final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_COLOR);
+    final pyramid = cv.ImagePyramid(levels: 5, scaleFactor: 1.5, padding: 0);
+    pyramid.build(img);
+    for (var i = 0; i < 5; i++) {
+      final level = pyramid.level(i);
+      expect(level.cols, (img.cols / pyramid.scale(i)).round());
+      expect(level.rows, (img.rows / pyramid.scale(i)).round());
+      expect(level.channels, 3);
+    }
+    expect(() => cv.ImagePyramid(scaleFactor: 1), throwsException);
+    pyramid.dispose();
+  });
+}
@@ -721,6 +721,23 @@ void main() async {
     expect((dst.rows, dst.cols), (img.rows, img.cols));
   });
 
+  test('cv.warpAffineBatchAsync, cv.warpPerspectiveBatchAsync', () async {
+    final img = await cv.imreadAsync("test/images/lenna.png", flags: cv.IMREAD_COLOR);
+    expect(img.isEmpty, false);
+
+    final m = cv.getRotationMatrix2D(cv.Point2f(200, 200), 30, 1.0);
+    final crops = await cv.warpAffineBatchAsync(img, [m, m].cvd, [(64, 64), (32, 16)]);
+    expect(crops.length, 2);
+    expect((crops[1].cols, crops[1].rows), (32, 16));
+    final expected = await cv.warpAffineAsync(img, m, (64, 64));
+    expect(cv.norm1(crops[0], expected, normType: cv.NORM_INF), lessThanOrEqualTo(1));
+
+    final h = cv.Mat.fromList(3, 3, cv.MatType.CV_64FC1, <double>[1, 0.1, -50, 0, 1, -80, 0, 0.0005, 1]);
+    final warped = await cv.warpPerspectiveBatchAsync(img, [h].cvd, [(100, 80)]);
+    final expected1 = await cv.warpPerspectiveAsync(img, h, (100, 80));
+    expect(cv.norm1(warped[0], expected1, normType: cv.NORM_INF), lessThanOrEqualTo(1));
+  });
+
   // watershed
   test('cv.watershedAsync', () async {
     final src = await cv.imreadAsync("test/images/lenna.png", flags: cv.IMREAD_UNCHANGED);
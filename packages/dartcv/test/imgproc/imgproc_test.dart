@@ -221,6 +221,42 @@ void main() async {
     expect((dst.width, dst.height, dst.channels), (src.width, src.height, src.channels));
   });
 
+  test('cv.dilate, cv.erode large rect kernels', () {
+    final src = cv.imread("test/images/circles.jpg", flags: cv.IMREAD_GRAYSCALE);
+    // a 31x31 rect equals 15 successive 3x3 rects, run them one by one to stay on the OpenCV path
+    (cv.Mat, cv.Mat) reference(cv.Mat src, (int, int) step, int n) {
+      final k = cv.getStructuringElement(cv.MORPH_RECT, step);
+      var d = src.clone(), e = src.clone();
+      for (var i = 0; i < n; i++) {
+        d = cv.dilate(d, k);
+        e = cv.erode(e, k);
+      }
+      return (d, e);
+    }
+
+    for (final m in [src, src.convertTo(cv.MatType.CV_32FC1)]) {
+      final (d, e) = reference(m, (3, 3), 15);
+      final kernel = cv.getStructuringElement(cv.MORPH_RECT, (31, 31));
+      expect(cv.norm1(cv.dilate(m, kernel), d, normType: cv.NORM_INF), 0);
+      expect(cv.norm1(cv.erode(m, kernel), e, normType: cv.NORM_INF), 0);
+
+      final grad = cv.morphologyEx(m, cv.MORPH_GRADIENT, kernel);
+      expect(cv.norm1(grad, cv.subtract(d, e), normType: cv.NORM_INF), 0);
+    }
+
+    {
+      final (d, e) = reference(src, (3, 1), 20);
+      final kernel = cv.getStructuringElement(cv.MORPH_RECT, (41, 1));
+      expect(cv.norm1(cv.dilate(src, kernel), d, normType: cv.NORM_INF), 0);
+      expect(cv.norm1(cv.erode(src, kernel), e, normType: cv.NORM_INF), 0);
+    }
+
+    // non-rect kernels fall back to OpenCV
+    final ellipse = cv.getStructuringElement(cv.MORPH_ELLIPSE, (31, 31));
+    final dst = cv.dilate(src, ellipse);
+    expect((dst.width, dst.height, dst.channels), (src.width, src.height, src.channels));
+  });
+
   // cv.contourArea
   test('cv.contourArea', () {
     {
@@ -714,6 +750,59 @@ void main() async {
     expect((dst.rows, dst.cols), (img.rows, img.cols));
   });
 
+  test('cv.warpAffineBatch, cv.warpPerspectiveBatch', () {
+    final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_COLOR);
+    expect(img.isEmpty, false);
+
+    final centers = [cv.Point2f(100, 100), cv.Point2f(256, 256), cv.Point2f(400, 300), cv.Point2f(-50, 10)];
+    final sizes = [(64, 64), (128, 96), (32, 48), (64, 64)];
+    final ms = <cv.Mat>[];
+    for (var i = 0; i < centers.length; i++) {
+      final m = cv.getRotationMatrix2D(centers[i], 15.0 * i, 1.0);
+      // move the rotation center to the crop center
+      m.set<double>(0, 2, m.at<double>(0, 2) - centers[i].x + sizes[i].$1 / 2);
+      m.set<double>(1, 2, m.at<double>(1, 2) - centers[i].y + sizes[i].$2 / 2);
+      ms.add(m);
+    }
+
+    final crops = cv.warpAffineBatch(img, ms.cvd, sizes);
+    expect(crops.length, centers.length);
+    for (var i = 0; i < crops.length; i++) {
+      final expected = cv.warpAffine(img, ms[i], sizes[i]);
+      expect((crops[i].cols, crops[i].rows), sizes[i]);
+      expect(cv.norm1(crops[i], expected, normType: cv.NORM_INF), lessThanOrEqualTo(1));
+    }
+
+    // one shared size, inverse maps and a non-constant border
+    final crops1 = cv.warpAffineBatch(
+      img,
+      ms.cvd,
+      [(50, 40)],
+      flags: cv.INTER_CUBIC | cv.WARP_INVERSE_MAP,
+      borderMode: cv.BORDER_REFLECT,
+    );
+    for (var i = 0; i < crops1.length; i++) {
+      final expected = cv.warpAffine(
+        img,
+        ms[i],
+        (50, 40),
+        flags: cv.INTER_CUBIC | cv.WARP_INVERSE_MAP,
+        borderMode: cv.BORDER_REFLECT,
+      );
+      expect(cv.norm1(crops1[i], expected, normType: cv.NORM_INF), lessThanOrEqualTo(1));
+    }
+
+    final pvs = [cv.Point2f(100, 100), cv.Point2f(300, 120), cv.Point2f(320, 300), cv.Point2f(80, 280)];
+    final pvd = [cv.Point2f(0, 0), cv.Point2f(99, 0), cv.Point2f(99, 99), cv.Point2f(0, 99)];
+    final h = cv.getPerspectiveTransform2f(pvs.cvd, pvd.cvd);
+    final warped = cv.warpPerspectiveBatch(img, [h, h].cvd, [(100, 100)]);
+    expect(warped.length, 2);
+    final expected = cv.warpPerspective(img, h, (100, 100));
+    expect(cv.norm1(warped[0], expected, normType: cv.NORM_INF), lessThanOrEqualTo(1));
+
+    expect(() => cv.warpAffineBatch(img, ms.cvd, [(1, 1), (2, 2)]), throwsException);
+  });
+
   // watershed
   test('cv.watershed', () {
     final src = cv.imread("test/images/lenna.png", flags: cv.IMREAD_UNCHANGED);
@@ -0,0 +1,63 @@
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+void main() {
+  test("cv.IntegralImage", () async {
+    // 4x6, pixel value = row * 6 + col
+    final src = cv.Mat.fromList(4, 6, cv.MatType.CV_8UC1, List.generate(24, (i) => i));
+    final integral = cv.IntegralImage(src, tilted: true);
+    expect(integral.isEmpty, false);
+    expect(integral.channels, 1);
+    expect((integral.sumImage.rows, integral.sumImage.cols), (5, 7));
+    expect(integral.sqsumImage.isEmpty, false);
+    expect(integral.tiltedImage.isEmpty, false);
+
+    final rects = [cv.Rect(0, 0, 6, 4), cv.Rect(1, 1, 2, 2), cv.Rect(5, 3, 1, 1), cv.Rect(2, 0, 0, 3)].cvd;
+    final sums = integral.sum(rects);
+    expect(sums.toList(), [276.0, 7.0 + 8 + 13 + 14, 23.0, 0.0]);
+
+    final means = integral.mean([cv.Rect(1, 1, 2, 2), cv.Rect(0, 2, 6, 1)].cvd);
+    expect(means.toList(), [10.5, 14.5]);
+
+    final vars = await integral.varianceAsync([cv.Rect(1, 1, 2, 2)].cvd);
+    // 7, 8, 13, 14 -> mean 10.5, var = (3.5^2 + 2.5^2 + 2.5^2 + 3.5^2) / 4
+    expect(vars.first, closeTo(9.25, 1e-9));
+
+    // top corner (2, 0) of the integral grid, one step along each diagonal covers
+    // the pixels (x=1, y=0) and (x=1, y=1)
+    final tilted = integral.tiltedSum([cv.Rect(2, 0, 1, 1)].cvd);
+    expect(tilted.first, closeTo(1.0 + 7, 1e-9));
+
+    expect(() => integral.sum([cv.Rect(4, 0, 3, 1)].cvd), throwsException);
+    expect(() => integral.mean([cv.Rect(0, 0, 0, 1)].cvd), throwsException);
+
+    final dense = integral.windows((2, 2));
+    expect((dense.rows, dense.cols), (3, 5));
+    expect(dense.type, cv.MatType.CV_64FC1);
+    expect(dense.at<double>(1, 1), 7.0 + 8 + 13 + 14);
+    final denseVar = await integral.windowsAsync((2, 2), op: cv.IntegralImage.OP_VARIANCE);
+    expect(denseVar.at<double>(1, 1), closeTo(9.25, 1e-9));
+    final denseMean = integral.windows((6, 4), op: cv.IntegralImage.OP_MEAN);
+    expect(denseMean.at<double>(0, 0), closeTo(11.5, 1e-9));
+
+    // reuse for another frame
+    final color = cv.Mat.fromScalar(10, 10, cv.MatType.CV_8UC3, cv.Scalar(1, 2, 3, 0));
+    await integral.computeAsync(color);
+    expect(integral.channels, 3);
+    final colorSums = await integral.sumAsync([cv.Rect(0, 0, 2, 5)].cvd);
+    expect(colorSums.toList(), [10.0, 20.0, 30.0]);
+    final colorMeans = await integral.meanAsync([cv.Rect(0, 0, 2, 5)].cvd);
+    expect(colorMeans.toList(), [1.0, 2.0, 3.0]);
+    final colorTilted = await integral.tiltedSumAsync([cv.Rect(3, 0, 2, 2)].cvd);
+    expect(colorTilted.length, 3);
+
+    integral.dispose();
+
+    final noTilted = cv.IntegralImage.empty();
+    expect(noTilted.isEmpty, true);
+    expect(() => noTilted.sum([cv.Rect(0, 0, 1, 1)].cvd), throwsException);
+    noTilted.compute(src);
+    expect(() => noTilted.tiltedSum([cv.Rect(2, 0, 1, 1)].cvd), throwsException);
+    noTilted.dispose();
+  });
+}
@@ -0,0 +1,59 @@
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+void main() {
+  test("cv.SlidingHistogram", () async {
+    final hist = cv.SlidingHistogram([0], [16], [0, 256], window: 2, grid: (2, 2));
+    expect(hist.window, 2);
+    expect(hist.count, 0);
+    expect(hist.numCells, 4);
+    expect(() => hist.hist(), throwsException);
+
+    final frames = [
+      cv.Mat.fromScalar(40, 60, cv.MatType.CV_8UC1, cv.Scalar.all(10)),
+      cv.Mat.fromScalar(40, 60, cv.MatType.CV_8UC1, cv.Scalar.all(100)),
+      cv.Mat.randu(40, 60, cv.MatType.CV_8UC1, low: cv.Scalar.all(0), high: cv.Scalar.all(256)),
+    ];
+    for (final f in frames) {
+      hist.push(f);
+    }
+    // window is full, the first frame has been evicted
+    expect(hist.count, 2);
+
+    final total = hist.hist();
+    expect(total.type, cv.MatType.CV_32FC1);
+    expect(cv.sum(total).val1, closeTo(2 * 40 * 60, 1e-6));
+    expect(total.at<double>(6, 0), greaterThanOrEqualTo(40 * 60));
+
+    final expected = cv.calcHist([frames[1]].cvd, [0].i32, cv.Mat.empty(), [16].i32, [0.0, 256.0].f32);
+    cv.calcHist(
+      [frames[2]].cvd,
+      [0].i32,
+      cv.Mat.empty(),
+      [16].i32,
+      [0.0, 256.0].f32,
+      hist: expected,
+      accumulate: true,
+    );
+    expect(cv.norm1(total, expected, normType: cv.NORM_INF), closeTo(0, 1e-6));
+
+    // a single cell is a quarter of the frame
+    final cell = await hist.histAsync(cell: 3);
+    expect(cv.sum(cell).val1, closeTo(2 * 20 * 30, 1e-6));
+
+    final scores = hist.compare(cell, cv.HISTCMP_CORREL);
+    expect(scores.length, 4);
+    expect(scores[3], closeTo(1.0, 1e-6));
+    final scores1 = await hist.compareAsync(cell, cv.HISTCMP_CORREL);
+    expect(scores1, scores);
+
+    // masked pixels are excluded
+    await hist.pushAsync(frames[0], mask: cv.Mat.zeros(40, 60, cv.MatType.CV_8UC1));
+    expect(hist.count, 2);
+    expect(cv.sum(hist.hist()).val1, closeTo(40 * 60, 1e-6));
+
+    hist.reset();
+    expect(hist.count, 0);
+    hist.dispose();
+  });
+}
@@ -1,3 +1,5 @@
+import 'dart:math' as math;
+
 import 'package:dartcv4/dartcv.dart' as cv;
 import 'package:test/test.dart';
 
@@ -178,4 +180,96 @@ void main() {
       expect(sEdge, 2);
     }
   });
+
+  List<String> sortedTriangles(cv.VecI32 indices) {
+    final ids = indices.toList();
+    final tris = <String>[];
+    for (var i = 0; i < ids.length; i += 3) {
+      tris.add((ids.sublist(i, i + 3)..sort()).join(","));
+    }
+    return tris..sort();
+  }
+
+  test('cv.Subdiv2D insertBulk, getTriangleIndices', () async {
+    final rng = math.Random(42);
+    final xy = List.generate(2000, (_) => rng.nextDouble() * 399);
+    final subdiv = cv.Subdiv2D.fromRect(cv.Rect(0, 0, 400, 400));
+    final ids = subdiv.insertBulk(xy.f32);
+    expect(ids.length, 1000);
+    // ids are in input order
+    for (var i = 0; i < ids.length; i++) {
+      final (pt, _) = subdiv.getVertex(ids[i]);
+      expect(pt.x, closeTo(xy[i * 2], 1e-3));
+      expect(pt.y, closeTo(xy[i * 2 + 1], 1e-3));
+    }
+
+    final indices = subdiv.getTriangleIndices();
+    final triangleList = subdiv.getTriangleList();
+    expect(indices.length, triangleList.length * 3);
+    for (var i = 0; i < triangleList.length; i++) {
+      final tri = triangleList[i];
+      final (a, _) = subdiv.getVertex(indices[i * 3]);
+      final (b, _) = subdiv.getVertex(indices[i * 3 + 1]);
+      final (c, _) = subdiv.getVertex(indices[i * 3 + 2]);
+      expect([a.x, a.y, b.x, b.y, c.x, c.y], [tri.val1, tri.val2, tri.val3, tri.val4, tri.val5, tri.val6]);
+    }
+
+    // same triangulation as one by one insertion
+    final subdiv1 = cv.Subdiv2D.fromRect(cv.Rect(0, 0, 400, 400));
+    subdiv1.insertVec(List.generate(1000, (i) => cv.Point2f(xy[i * 2], xy[i * 2 + 1])).cvd);
+    expect(sortedTriangles(await subdiv.getTriangleIndicesAsync()), sortedTriangles(subdiv1.getTriangleIndices()));
+
+    final (facets, offsets, centers) = subdiv.getVoronoiFacetListFlat(cv.VecI32());
+    final (facetList, facetCenters) = subdiv.getVoronoiFacetList(cv.VecI32());
+    expect(offsets.length, facetList.length + 1);
+    expect(centers.length, facetCenters.length * 2);
+    expect(facets.length, offsets.last * 2);
+    expect(offsets[1] - offsets[0], facetList.first.length);
+    expect(facets[0], facetList.first.first.x);
+
+    expect(() => subdiv.insertBulk([1.0, 2.0, 3.0].f32), throwsException);
+    // nothing is inserted if a point is outside the rect
+    final numIndices = indices.length;
+    expect(() => subdiv.insertBulk([10.5, 10.5, 500.0, 10.0].f32), throwsException);
+    expect(subdiv.getTriangleIndices().length, numIndices);
+    subdiv.dispose();
+    subdiv1.dispose();
+  });
+
+  test('cv.Subdiv2D movePoints', () async {
+    final rng = math.Random(7);
+    final xy = List.generate(400, (_) => 20 + rng.nextDouble() * 360);
+    final subdiv = cv.Subdiv2D.fromRect(cv.Rect(0, 0, 400, 400));
+    final ids = subdiv.insertBulk(xy.f32);
+
+    Future<void> expectSameAsRebuilt(cv.Subdiv2D subdiv, List<double> xy) async {
+      final rebuilt = cv.Subdiv2D.fromRect(cv.Rect(0, 0, 400, 400));
+      rebuilt.insertBulk(xy.f32);
+      expect(sortedTriangles(subdiv.getTriangleIndices()), sortedTriangles(rebuilt.getTriangleIndices()));
+      rebuilt.dispose();
+    }
+
+    // small moves are done in place
+    final moved = [ids[3], ids[10], ids[50]];
+    for (final i in [3, 10, 50]) {
+      xy[i * 2] += 0.5;
+      xy[i * 2 + 1] -= 0.5;
+    }
+    final movedXY = [for (final i in [3, 10, 50]) ...[xy[i * 2], xy[i * 2 + 1]]];
+    expect(subdiv.movePoints(moved.i32, movedXY.f32), false);
+    await expectSameAsRebuilt(subdiv, xy);
+
+    // a vertex moved across the triangulation needs a rebuild, ids are kept
+    xy[0] = 399 - xy[0];
+    xy[1] = 399 - xy[1];
+    expect(await subdiv.movePointsAsync([ids[0]].i32, [xy[0], xy[1]].f32), true);
+    await expectSameAsRebuilt(subdiv, xy);
+    final (pt, _) = subdiv.getVertex(ids[0]);
+    expect(pt.x, closeTo(xy[0], 1e-3));
+
+    expect(() => subdiv.movePoints([ids[1]].i32, [500.0, 10.0].f32), throwsException);
+    expect(() => subdiv.movePoints([ids[1]].i32, [xy[4], xy[5]].f32), throwsException);
+    expect(() => subdiv.movePoints([0].i32, [1.0, 1.0].f32), throwsException);
+    subdiv.dispose();
+  });
 }
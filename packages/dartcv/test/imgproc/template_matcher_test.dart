@@ -0,0 +1,61 @@
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+void main() {
+  test("cv.TemplateMatcher scales", () async {
+    final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_GRAYSCALE);
+    expect(img.isEmpty, false);
+    final templ = img.region(cv.Rect(200, 200, 64, 64)).clone();
+    // the template appears at half size, centered on (115.5, 115.5)
+    final scene = cv.resize(img, (img.cols ~/ 2, img.rows ~/ 2), interpolation: cv.INTER_AREA);
+
+    final matcher = cv.TemplateMatcher(templ, scales: [0.5, 0.75, 1.0], levels: 3, topK: 3);
+    expect(matcher.method, cv.TM_CCOEFF_NORMED);
+    expect(matcher.levels, 3);
+    expect(matcher.topK, 3);
+
+    final (boxes, scores) = matcher.match(scene, threshold: 0.8, maxMatches: 1);
+    expect(boxes.length, 1);
+    expect(scores.first, greaterThan(0.9));
+    expect(boxes.first.center.x, closeTo(115.5, 2));
+    expect(boxes.first.center.y, closeTo(115.5, 2));
+    expect(boxes.first.size.width, closeTo(32, 1e-3));
+    expect(boxes.first.angle, closeTo(0, 1e-6));
+
+    final matcher1 = cv.TemplateMatcher(templ, scales: [0.5, 0.75, 1.0], levels: 3, topK: 1);
+    expect(matcher1.topK, 1);
+    final (boxes1, scores1) = await matcher1.matchAsync(scene, threshold: 0.8);
+    expect(boxes1, isNotEmpty);
+    expect(scores1.first, closeTo(scores.first, 1e-3));
+
+    // nothing passes an impossible threshold
+    final (boxes2, _) = matcher.match(scene, threshold: 1.01);
+    expect(boxes2, isEmpty);
+
+    matcher.dispose();
+    matcher1.dispose();
+  });
+
+  test("cv.TemplateMatcher rotations", () {
+    final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_GRAYSCALE);
+    final templ = img.region(cv.Rect(200, 200, 64, 64)).clone();
+    // (x, y) -> (rows - 1 - y, x), the center (231.5, 231.5) moves to (279.5, 231.5)
+    final scene = cv.rotate(img, cv.ROTATE_90_CLOCKWISE);
+
+    final matcher = cv.TemplateMatcher(
+      templ,
+      angles: [0, 45, 90],
+      method: cv.TM_SQDIFF_NORMED,
+      levels: 2,
+    );
+    final (boxes, scores) = matcher.match(scene, threshold: 0.1, maxMatches: 1);
+    expect(boxes.length, 1);
+    expect(scores.first, lessThan(0.05));
+    expect(boxes.first.angle, closeTo(90, 1e-6));
+    expect(boxes.first.center.x, closeTo(279.5, 3));
+    expect(boxes.first.center.y, closeTo(231.5, 3));
+
+    expect(() => cv.TemplateMatcher(templ, method: cv.TM_CCOEFF), throwsException);
+    matcher.dispose();
+  });
+}
@@ -0,0 +1,60 @@
+import 'package:dartcv4/dartcv.dart' as cv;
+import 'package:test/test.dart';
+
+void main() {
+  test("cv.VideoCLAHE", () async {
+    final mat = cv.imread("test/images/circles.jpg", flags: cv.IMREAD_GRAYSCALE);
+    final clahe = cv.CLAHE.create(2, (8, 8));
+
+    // no smoothing, same as CLAHE
+    final video = cv.VideoCLAHE(clipLimit: 2, tileGridSize: (8, 8), smoothing: 0);
+    expect(video.tilesGridSize, (8, 8));
+    expect(video.clipLimit, closeTo(2, 1e-6));
+    for (final src in [mat, mat.convertTo(cv.MatType.CV_16UC1, alpha: 256)]) {
+      final expected = clahe.apply(src);
+      final dst = video.apply(src);
+      expect((dst.rows, dst.cols, dst.type), (src.rows, src.cols, src.type));
+      expect(cv.norm1(dst, expected, normType: cv.NORM_INF), lessThanOrEqualTo(1));
+    }
+
+    {
+      final dst = await video.applyAsync(mat);
+      expect(cv.norm1(dst, clahe.apply(mat), normType: cv.NORM_INF), lessThanOrEqualTo(1));
+    }
+    video.dispose();
+  });
+
+  test("cv.VideoCLAHE smoothing", () {
+    final mat = cv.imread("test/images/circles.jpg", flags: cv.IMREAD_GRAYSCALE);
+    final dark = mat.convertTo(cv.MatType.CV_8UC1, alpha: 0.5);
+    final clahe = cv.CLAHE.create(4, (4, 4));
+
+    final video = cv.VideoCLAHE(clipLimit: 4, tileGridSize: (4, 4), smoothing: 0.9);
+    expect(video.smoothing, closeTo(0.9, 1e-6));
+
+    // the first frame has no history
+    final first = video.apply(mat);
+    expect(cv.norm1(first, clahe.apply(mat), normType: cv.NORM_INF), lessThanOrEqualTo(1));
+    expect(video.frames, 1);
+
+    // the mapping of the second frame is mostly the one of the first frame
+    final second = video.apply(dark);
+    expect(video.frames, 2);
+    final fresh = clahe.apply(dark);
+    expect(cv.norm1(second, fresh, normType: cv.NORM_INF), greaterThan(1));
+
+    video.reset();
+    expect(video.frames, 0);
+    expect(cv.norm1(video.apply(dark), fresh, normType: cv.NORM_INF), lessThanOrEqualTo(1));
+
+    // size changes reset the state too
+    final small = cv.resize(mat, (mat.cols ~/ 2, mat.rows ~/ 2));
+    video.apply(small);
+    expect(video.frames, 1);
+
+    video.smoothing = 0;
+    expect(video.smoothing, 0);
+    expect(() => video.smoothing = 1, throwsException);
+    video.dispose();
+  });
+}
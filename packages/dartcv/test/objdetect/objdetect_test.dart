@@ -62,6 +62,27 @@ void main() async {
     expect(cls.isOldFormatCascade(), false);
   });
 
+  test('cv.CascadeClassifier.detectMultiScalePyramid', () async {
+    final img = cv.imread("test/images/face.jpg", flags: cv.IMREAD_GRAYSCALE);
+    final cls = cv.CascadeClassifier.fromFile("test/data/haarcascade_frontalface_default.xml");
+    final pyramid = cv.ImagePyramid(levels: 16, scaleFactor: 1.1, padding: 0)..build(img);
+
+    final expected = cls.detectMultiScale(img);
+    final rects = cls.detectMultiScalePyramid(pyramid);
+    expect(rects.length, expected.length);
+    // the centers are close, the sizes are quantized to the pyramid scales
+    final (a, b) = (rects.first, expected.first);
+    expect((a.x + a.width / 2 - b.x - b.width / 2).abs(), lessThan(b.width * 0.2));
+    expect((a.y + a.height / 2 - b.y - b.height / 2).abs(), lessThan(b.height * 0.2));
+
+    final rects1 = await cls.detectMultiScalePyramidAsync(pyramid);
+    expect(rects1.length, rects.length);
+
+    final raw = cls.detectMultiScalePyramid(pyramid, minNeighbors: 0);
+    expect(raw.length, greaterThanOrEqualTo(rects.length));
+    cls.dispose();
+  });
+
   test('cv.HOGDescriptor', () {
     final img = cv.imread("test/images/face.jpg", flags: cv.IMREAD_COLOR);
     expect(img.isEmpty, false);
@@ -54,6 +54,49 @@ void main() async {
     expect(error?.isEmpty, false);
   });
 
+  test('cv.calcOpticalFlowPyrLKPyramid', () async {
+    final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_GRAYSCALE);
+    final M = cv.Mat.from2DList([
+      [1.0, 0.0, 2.5],
+      [0.0, 1.0, -1.5],
+    ], cv.MatType.CV_64FC1);
+    final img2 = cv.warpAffine(img, M, (img.cols, img.rows));
+    final corners = cv.goodFeaturesToTrack(img, 20, 0.01, 10);
+
+    final (expected, expectedStatus, _) = cv.calcOpticalFlowPyrLK(img, img2, corners, cv.VecPoint2f());
+
+    // the same pyramids as calcOpticalFlowPyrLK builds internally
+    final prev = cv.ImagePyramid(levels: 4, padding: 21)..build(img);
+    final next = cv.ImagePyramid(levels: 4, padding: 21)..build(img2);
+    final (pts, status, err) = cv.calcOpticalFlowPyrLKPyramid(prev, next, corners, cv.VecPoint2f());
+    expect(pts.length, corners.length);
+    expect(err?.length, corners.length);
+    expect(status?.toList(), expectedStatus?.toList());
+    for (var i = 0; i < pts.length; i++) {
+      expect(pts[i].x, closeTo(expected[i].x, 1e-2));
+      expect(pts[i].y, closeTo(expected[i].y, 1e-2));
+    }
+
+    final (pts1, status1, _) = await cv.calcOpticalFlowPyrLKPyramidAsync(
+      prev,
+      next,
+      corners,
+      cv.VecPoint2f(),
+    );
+    expect(pts1.length, corners.length);
+    expect(status1.toList(), status?.toList());
+
+    // padding must cover winSize and levels must be scaled by 2
+    final small = cv.ImagePyramid(levels: 4, padding: 4)..build(img);
+    expect(() => cv.calcOpticalFlowPyrLKPyramid(small, next, corners, cv.VecPoint2f()), throwsArgumentError);
+    final orb = cv.ImagePyramid(levels: 4, scaleFactor: 1.2, padding: 21)..build(img);
+    expect(() => cv.calcOpticalFlowPyrLKPyramid(prev, orb, corners, cv.VecPoint2f()), throwsArgumentError);
+    expect(
+      () => cv.calcOpticalFlowPyrLKPyramidAsync(orb, next, corners, cv.VecPoint2f()),
+      throwsArgumentError,
+    );
+  });
+
   test('cv.findTransformECC', () {
     final img = cv.imread("test/images/lenna.png", flags: cv.IMREAD_GRAYSCALE);
     expect(img.isEmpty, false);